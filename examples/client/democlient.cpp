@@ -12,8 +12,8 @@ const char* help_options =
 "Options:\n"
 "  -help (-?)               - show this help.\n"
 "  -unit (-u) <unit>        - modbus device remote address/unit (default is 1)\n"
-"  -type (-t) <type>        - protocol type. Can be TCP, UDP, RTU, ASC, RTUvTCP, RTUvUDP, ASCvTCP, ASCvUDP (default is TCP)\n"
-"  -host (-h) <host>        - ip address for TCP (default is localhost)\n"
+"  -type (-t) <type>        - protocol type. Can be TCP, UDP, RTU, ASC, RTUvTCP, RTUvUDP, ASCvTCP, ASCvUDP, UNIX (default is TCP)\n"
+"  -host (-h) <host>        - ip address for TCP or socket path for UNIX (default is localhost)\n"
 "  -port (-p) <port>        - remote TCP port (502 is default)\n"
 "  -tm <timeout>            - timeout for TCP (millisec, default is 3000)\n"
 "  -serial (-sl)            - serial port name for RTU and ASC\n"
@@ -156,8 +156,13 @@ void parseOptions(int argc, char **argv)
                     options.type = Modbus::ASCvUDP;
                     continue;
                 }
+                else if (!strcmp(sOptValue, "UNIX"))
+                {
+                    options.type = Modbus::UNIX;
+                    continue;
+                }
             }
-            printf("'-type' option must have a value: TCP, UDP, RTU, ASC, RTUvTCP, RTUvUDP, ASCvTCP, ASCvUDP\n");
+            printf("'-type' option must have a value: TCP, UDP, RTU, ASC, RTUvTCP, RTUvUDP, ASCvTCP, ASCvUDP, UNIX\n");
             exit(1);
         }
         if (!strcmp(opt, "unit") || !strcmp(opt, "u"))
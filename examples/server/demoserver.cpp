@@ -13,8 +13,8 @@ const char* help_options =
 "\n"
 "Options:\n"
 "  -help (-?)          - show this help.\n"
-"  -type (-t) <type>   - protocol type. Can be TCP, UDP, RTU, ASC, RTUvTCP, RTUvUDP, ASCvTCP, ASCvUDP (default is TCP)\n"
-"  -addr (-host) <addr>- ip address for TCP (default is 0.0.0.0)\n"
+"  -type (-t) <type>   - protocol type. Can be TCP, UDP, RTU, ASC, RTUvTCP, RTUvUDP, ASCvTCP, ASCvUDP, UNIX (default is TCP)\n"
+"  -addr (-host) <addr>- ip address for TCP or socket path for UNIX (default is 0.0.0.0)\n"
 "  -port (-p) <port>   - remote TCP port (502 is default)\n"
 "  -tm <timeout>       - timeout for TCP (millisec, default is 3000)\n"
 "  -maxconn <count>    - max active TCP connections (default is 10)\n"
@@ -258,8 +258,13 @@ void parseOptions(int argc, char **argv)
                     options.type = Modbus::ASCvUDP;
                     continue;
                 }
+                else if (!strcmp(sOptValue, "UNIX"))
+                {
+                    options.type = Modbus::UNIX;
+                    continue;
+                }
             }
-            printf("'-type' option must have a value: TCP, UDP, RTU, ASC, RTUvTCP, RTUvUDP, ASCvTCP, ASCvUDP\n");
+            printf("'-type' option must have a value: TCP, UDP, RTU, ASC, RTUvTCP, RTUvUDP, ASCvTCP, ASCvUDP, UNIX\n");
             exit(1);
         }
         if (!strcmp(opt, "unit") || !strcmp(opt, "u"))
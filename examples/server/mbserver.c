@@ -10,8 +10,8 @@ const char* help_options =
 "Options:\n"
 "  -help (-?)           - show this help.\n"
 "  -unit (-u) <unit>    - modbus device address/unit (default is 1)\n"
-"  -type (-t) <type>    - protocol type. Can be TCP, UDP, RTU, ASC, RTUvTCP, RTUvUDP, ASCvTCP, ASCvUDP (default is TCP)\n"
-"  -addr (-host) <addr> - ip address for TCP (default is 0.0.0.0)\n"
+"  -type (-t) <type>    - protocol type. Can be TCP, UDP, RTU, ASC, RTUvTCP, RTUvUDP, ASCvTCP, ASCvUDP, UNIX (default is TCP)\n"
+"  -addr (-host) <addr> - ip address for TCP or socket path for UNIX (default is 0.0.0.0)\n"
 "  -port (-p) <port>    - remote TCP port (502 is default)\n"
 "  -tm <timeout>        - timeout for TCP (millisec, default is 3000)\n"
 "  -maxconn <count>     - max active TCP connections (default is 10)\n"
@@ -138,8 +138,13 @@ void parseOptions(int argc, char **argv)
                     options.type = ASCvUDP;
                     continue;
                 }
+                else if (!strcmp(sOptValue, "UNIX"))
+                {
+                    options.type = UNIX;
+                    continue;
+                }
             }
-            printf("'-type' option must have a value: TCP, UDP, RTU, ASC, RTUvTCP, RTUvUDP, ASCvTCP, ASCvUDP\n");
+            printf("'-type' option must have a value: TCP, UDP, RTU, ASC, RTUvTCP, RTUvUDP, ASCvTCP, ASCvUDP, UNIX\n");
             exit(1);
         }
         if (!strcmp(opt, "addr") || !strcmp(opt, "host"))
@@ -2,6 +2,29 @@
 
 #include <sstream>
 
+#if !defined(MB_ASCII_SIMD_DISABLE)
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+// Note: GCC/Clang compile SIMD paths with `target` attribute and select them at runtime,
+// so library built for generic x86 still uses SSSE3/AVX2 when CPU supports it
+#define MB_ASCII_SSSE3
+#define MB_ASCII_AVX2
+#define MB_ASCII_TARGET(isa) __attribute__((target(isa)))
+#define MB_ASCII_CPU_SUPPORTS(isa) (__builtin_cpu_init(), __builtin_cpu_supports(isa))
+#else
+#if defined(__AVX2__)
+#define MB_ASCII_AVX2
+#define MB_ASCII_SSSE3
+#elif defined(__SSSE3__)
+#define MB_ASCII_SSSE3
+#endif
+#define MB_ASCII_TARGET(isa)
+#define MB_ASCII_CPU_SUPPORTS(isa) true
+#endif
+#if defined(MB_ASCII_SSSE3)
+#include <immintrin.h>
+#endif
+#endif // MB_ASCII_SIMD_DISABLE
+
 #include "ModbusAscPort.h"
 #include "ModbusRtuPort.h"
 #include "ModbusTcpPort.h"
@@ -10,13 +33,16 @@
 #include "ModbusRtuOverTcpPort.h"
 #include "ModbusAscOverUdpPort.h"
 #include "ModbusRtuOverUdpPort.h"
+#include "ModbusUnixPort.h"
 
 #ifndef MB_CLIENT_DISABLE
 #include "ModbusClientPort.h"
+#include "ModbusClientPortPool.h"
 #endif // MB_CLIENT_DISABLE
 
 #ifndef MB_SERVER_DISABLE
 #include "ModbusTcpServer.h"
+#include "ModbusUnixServer.h"
 #include "ModbusServerResource.h"
 #include "ModbusGlobal.h"
 #endif // MB_SERVER_DISABLE
@@ -49,6 +75,28 @@ const NetDefaults &NetDefaults::instance()
     return d;
 }
 
+SocketOptions defaultSocketOptions()
+{
+    SocketOptions o;
+    memset(&o, 0, sizeof(o));
+    return o;
+}
+
+SocketOptions lowLatencySocketOptions()
+{
+    SocketOptions o = defaultSocketOptions();
+    o.noDelay           = 1;
+    o.quickAck          = 1;
+    o.fastOpen          = 1;
+    o.keepAlive         = 1;
+    o.keepAliveIdle     = 5;
+    o.keepAliveInterval = 1;
+    o.keepAliveCount    = 3;
+    o.userTimeout       = 5000;
+    o.busyPoll          = 50;
+    return o;
+}
+
 const SerialDefaults &SerialDefaults::instance()
 {
     static const SerialDefaults d;
@@ -79,6 +127,37 @@ uint8_t lrc(const uint8_t *bytes, uint32_t count)
     return static_cast<uint8_t>(-static_cast<int8_t>(lrc));
 }
 
+uint32_t serialCharTimeUs(int32_t baudRate, int8_t dataBits, Parity parity, StopBits stopBits)
+{
+    if (baudRate <= 0)
+        return 0;
+    // Note: count in half-bits to take into account 1.5 stop bits
+    uint32_t halfBits = 2 * (1 + static_cast<uint32_t>(dataBits)); // start bit + data bits
+    if (parity != NoParity)
+        halfBits += 2;
+    switch (stopBits)
+    {
+    case OneAndHalfStop: halfBits += 3; break;
+    case TwoStop       : halfBits += 4; break;
+    default            : halfBits += 2; break;
+    }
+    return static_cast<uint32_t>((static_cast<uint64_t>(halfBits) * 1000000 + 2 * baudRate - 1) / (2 * static_cast<uint64_t>(baudRate)));
+}
+
+uint32_t serialInterCharTimeoutUs(int32_t baudRate, int8_t dataBits, Parity parity, StopBits stopBits)
+{
+    if (baudRate > 19200)
+        return 750;
+    return (serialCharTimeUs(baudRate, dataBits, parity, stopBits) * 3 + 1) / 2;
+}
+
+uint32_t serialInterFrameDelayUs(int32_t baudRate, int8_t dataBits, Parity parity, StopBits stopBits)
+{
+    if (baudRate > 19200)
+        return 1750;
+    return (serialCharTimeUs(baudRate, dataBits, parity, stopBits) * 7 + 1) / 2;
+}
+
 StatusCode readMemRegs(uint32_t offset, uint32_t count, void *values, const void *memBuff, uint32_t memRegCount, uint32_t *outCount)
 {
     if (static_cast<uint32_t>(offset + count) > memRegCount)
@@ -223,45 +302,210 @@ StatusCode writeMemBits(uint32_t offset, uint32_t count, const void *values, voi
 }
 
 
+// Note: hex digit value for every ASCII symbol or 0xFF if symbol is not valid (upper) hex digit
+static const uint8_t asciiHexTable[256] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t asciiHexDigits[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+
+#if defined(MB_ASCII_SSSE3)
+// Encodes 16 bytes into 32 ASCII symbols
+MB_ASCII_TARGET("ssse3") static inline uint8_t ssse3BytesToAscii16(const uint8_t *bytesBuff, uint8_t *asciiBuff)
+{
+    const __m128i digits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(asciiHexDigits));
+    const __m128i mask   = _mm_set1_epi8(0x0F);
+    __m128i v  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytesBuff));
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), mask);
+    __m128i lo = _mm_and_si128(v, mask);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(asciiBuff   ), _mm_shuffle_epi8(digits, _mm_unpacklo_epi8(hi, lo)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(asciiBuff+16), _mm_shuffle_epi8(digits, _mm_unpackhi_epi8(hi, lo)));
+    __m128i s = _mm_sad_epu8(v, _mm_setzero_si128());
+    return static_cast<uint8_t>(_mm_cvtsi128_si32(s) + _mm_extract_epi16(s, 4));
+}
+
+// Converts 16 ASCII symbols into 16 nibbles, `valid` is set to all ones for valid hex digits
+MB_ASCII_TARGET("ssse3") static inline __m128i ssse3AsciiToNibbles(__m128i c, __m128i &valid)
+{
+    __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0'-1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9'+1)));
+    __m128i isAlpha = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('A'-1)), _mm_cmplt_epi8(c, _mm_set1_epi8('F'+1)));
+    valid = _mm_or_si128(isDigit, isAlpha);
+    return _mm_sub_epi8(_mm_sub_epi8(c, _mm_set1_epi8('0')), _mm_and_si128(isAlpha, _mm_set1_epi8('A'-'9'-1)));
+}
+
+// Decodes 32 ASCII symbols into 16 bytes. Returns `false` if there is not valid symbol.
+// Note: input is fully loaded before output is stored so decoding can be made in-place
+MB_ASCII_TARGET("ssse3") static inline bool ssse3AsciiToBytes16(const uint8_t *asciiBuff, uint8_t *bytesBuff, uint8_t *sum)
+{
+    __m128i v0, v1;
+    __m128i n0 = ssse3AsciiToNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(asciiBuff   )), v0);
+    __m128i n1 = ssse3AsciiToNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(asciiBuff+16)), v1);
+    if (_mm_movemask_epi8(_mm_and_si128(v0, v1)) != 0xFFFF)
+        return false;
+    const __m128i weights = _mm_set1_epi16(0x0110); // Note: (hi * 16) + (lo * 1)
+    __m128i v = _mm_packus_epi16(_mm_maddubs_epi16(n0, weights), _mm_maddubs_epi16(n1, weights));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bytesBuff), v);
+    __m128i s = _mm_sad_epu8(v, _mm_setzero_si128());
+    *sum += static_cast<uint8_t>(_mm_cvtsi128_si32(s) + _mm_extract_epi16(s, 4));
+    return true;
+}
+
+// Encodes whole 16-byte blocks of `bytesBuff`. Returns count of encoded bytes
+MB_ASCII_TARGET("ssse3") static uint32_t ssse3BytesToAscii(const uint8_t *bytesBuff, uint8_t *asciiBuff, uint32_t count, uint8_t *sum)
+{
+    uint32_t i = 0;
+    for (; i + 16 <= count; i += 16)
+        *sum += ssse3BytesToAscii16(&bytesBuff[i], &asciiBuff[i * 2]);
+    return i;
+}
+
+// Decodes whole 16-byte blocks starting from `*i` byte. Returns `false` if there is not valid symbol
+MB_ASCII_TARGET("ssse3") static bool ssse3AsciiToBytes(const uint8_t *asciiBuff, uint8_t *bytesBuff, uint32_t count, uint32_t *i, uint8_t *sum)
+{
+    for (; *i + 16 <= count; *i += 16)
+    {
+        if (!ssse3AsciiToBytes16(&asciiBuff[*i * 2], &bytesBuff[*i], sum))
+            return false;
+    }
+    return true;
+}
+
+static bool cpuSupportsSsse3()
+{
+    static const bool r = MB_ASCII_CPU_SUPPORTS("ssse3");
+    return r;
+}
+#endif // MB_ASCII_SSSE3
+
+#if defined(MB_ASCII_AVX2)
+// Converts 32 ASCII symbols into 32 nibbles, `valid` is set to all ones for valid hex digits
+MB_ASCII_TARGET("avx2") static inline __m256i avx2AsciiToNibbles(__m256i c, __m256i &valid)
+{
+    __m256i isDigit = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0'-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9'+1), c));
+    __m256i isAlpha = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('A'-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('F'+1), c));
+    valid = _mm256_or_si256(isDigit, isAlpha);
+    return _mm256_sub_epi8(_mm256_sub_epi8(c, _mm256_set1_epi8('0')), _mm256_and_si256(isAlpha, _mm256_set1_epi8('A'-'9'-1)));
+}
+
+// Decodes 64 ASCII symbols into 32 bytes. Returns `false` if there is not valid symbol.
+MB_ASCII_TARGET("avx2") static inline bool avx2AsciiToBytes32(const uint8_t *asciiBuff, uint8_t *bytesBuff, uint8_t *sum)
+{
+    __m256i v0, v1;
+    __m256i n0 = avx2AsciiToNibbles(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(asciiBuff   )), v0);
+    __m256i n1 = avx2AsciiToNibbles(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(asciiBuff+32)), v1);
+    if (_mm256_movemask_epi8(_mm256_and_si256(v0, v1)) != -1)
+        return false;
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+    __m256i v = _mm256_packus_epi16(_mm256_maddubs_epi16(n0, weights), _mm256_maddubs_epi16(n1, weights));
+    v = _mm256_permute4x64_epi64(v, 0xD8); // Note: restore order of 128-bit lanes after pack
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(bytesBuff), v);
+    __m256i s = _mm256_sad_epu8(v, _mm256_setzero_si256());
+    *sum += static_cast<uint8_t>(_mm256_extract_epi16(s, 0) + _mm256_extract_epi16(s, 4) +
+                                 _mm256_extract_epi16(s, 8) + _mm256_extract_epi16(s, 12));
+    return true;
+}
+
+// Decodes whole 32-byte blocks starting from `*i` byte. Returns `false` if there is not valid symbol
+MB_ASCII_TARGET("avx2") static bool avx2AsciiToBytes(const uint8_t *asciiBuff, uint8_t *bytesBuff, uint32_t count, uint32_t *i, uint8_t *sum)
+{
+    for (; *i + 32 <= count; *i += 32)
+    {
+        if (!avx2AsciiToBytes32(&asciiBuff[*i * 2], &bytesBuff[*i], sum))
+            return false;
+    }
+    return true;
+}
+
+static bool cpuSupportsAvx2()
+{
+    static const bool r = MB_ASCII_CPU_SUPPORTS("avx2");
+    return r;
+}
+#endif // MB_ASCII_AVX2
+
 uint32_t bytesToAscii(const uint8_t *bytesBuff, uint8_t* asciiBuff, uint32_t count)
 {
-    uint32_t i, j, qAscii = 0;
-    uint8_t tmp;
+    uint8_t sum = 0;
+    return bytesToAsciiLrc(bytesBuff, asciiBuff, count, &sum);
+}
 
-    for (i = 0; i < count; i++)
+uint32_t bytesToAsciiLrc(const uint8_t *bytesBuff, uint8_t* asciiBuff, uint32_t count, uint8_t *sum)
+{
+    uint32_t i = 0;
+    uint8_t s = *sum;
+#if defined(MB_ASCII_SSSE3)
+    if (cpuSupportsSsse3())
+        i = ssse3BytesToAscii(bytesBuff, asciiBuff, count, &s);
+#endif // MB_ASCII_SSSE3
+    for (; i < count; i++)
     {
-        for (j = 0; j < 2; j++)
-        {
-            tmp = (bytesBuff[i] >> ((1 - j) * 4)) & 0x0F;
-            asciiBuff[i * 2 + j] = ((tmp < 10) ? (0x30 | tmp) : (55 + tmp));
-            qAscii++;
-        }
+        uint8_t b = bytesBuff[i];
+        asciiBuff[i * 2    ] = asciiHexDigits[b >> 4];
+        asciiBuff[i * 2 + 1] = asciiHexDigits[b & 0x0F];
+        s += b;
     }
-    return qAscii;
+    *sum = s;
+    return count * 2;
 }
 
 uint32_t asciiToBytes(const uint8_t *asciiBuff, uint8_t* bytesBuff, uint32_t count)
 {
-    uint32_t i, j, qBytes = 0;
-    uint8_t tmp;
-    for (i = 0; i < count; i++)
+    uint8_t sum = 0;
+    uint32_t c = asciiToBytesLrc(asciiBuff, bytesBuff, count & ~1u, &sum);
+    if (c != count / 2) // Note: not valid symbol
+        return 0;
+    if (count & 1)
     {
-        j = i & 1;
-        if (!j)
-        {
-            bytesBuff[i / 2] = 0;
-            qBytes++;
-        }
-        tmp = asciiBuff[i];
-        if ((tmp >= '0') && (tmp <= '9'))
-            tmp &= 0x0F;
-        else if ((tmp >= 'A') && (tmp <= 'F'))
-            tmp -= 55;
-        else
+        // Note: odd symbol count - last symbol is most significant tetrabits of the last byte
+        uint8_t hi = asciiHexTable[asciiBuff[count - 1]];
+        if (hi == 0xFF)
+            return 0;
+        bytesBuff[c++] = static_cast<uint8_t>(hi << 4);
+    }
+    return c;
+}
+
+uint32_t asciiToBytesLrc(const uint8_t *asciiBuff, uint8_t* bytesBuff, uint32_t count, uint8_t *sum)
+{
+    uint32_t i = 0;
+    uint8_t s = *sum;
+    count /= 2;
+#if defined(MB_ASCII_AVX2)
+    if (cpuSupportsAvx2() && !avx2AsciiToBytes(asciiBuff, bytesBuff, count, &i, &s))
+        return 0;
+#endif // MB_ASCII_AVX2
+#if defined(MB_ASCII_SSSE3)
+    if (cpuSupportsSsse3() && !ssse3AsciiToBytes(asciiBuff, bytesBuff, count, &i, &s))
+        return 0;
+#endif // MB_ASCII_SSSE3
+    for (; i < count; i++)
+    {
+        uint8_t hi = asciiHexTable[asciiBuff[i * 2    ]];
+        uint8_t lo = asciiHexTable[asciiBuff[i * 2 + 1]];
+        if ((hi | lo) & 0xF0)
             return 0;
-        bytesBuff[i / 2] |= tmp << (4 * (1 - j));
+        uint8_t b = static_cast<uint8_t>((hi << 4) | lo);
+        bytesBuff[i] = b;
+        s += b;
     }
-    return qBytes;
+    *sum = s;
+    return count;
 }
 
 Char *sbytes(const uint8_t* buff, uint32_t count, Char *str, uint32_t strmaxlen)
@@ -373,6 +617,7 @@ const Char *sprotocolType(ProtocolType type)
     case RTUvTCP: return StringLiteral("RTUvTCP");
     case ASCvUDP: return StringLiteral("ASCvUDP");
     case RTUvUDP: return StringLiteral("RTUvUDP");
+    case UNIX   : return StringLiteral("UNIX"   );
     default: return nullptr;
     }
 }
@@ -387,6 +632,7 @@ ProtocolType toprotocolType(const Char * s)
     if (strcmp(s, StringLiteral("RTUvTCP")) == 0) return RTUvTCP;
     if (strcmp(s, StringLiteral("ASCvUDP")) == 0) return ASCvUDP;
     if (strcmp(s, StringLiteral("RTUvUDP")) == 0) return RTUvUDP;
+    if (strcmp(s, StringLiteral("UNIX"   )) == 0) return UNIX   ;
     return static_cast<ProtocolType>(-1);
 }   
 
@@ -554,6 +800,9 @@ ModbusPort *createPort(ProtocolType type, const void *settings, bool blocking)
     case RTUvUDP:
         port = new ModbusRtuOverUdpPort(blocking);
         break;
+    case UNIX:
+        port = new ModbusUnixPort(blocking);
+        break;
     default:
         return nullptr;
     }
@@ -572,13 +821,34 @@ ModbusClientPort *createClientPort(ProtocolType type, const void *settings, bool
     ModbusClientPort *clientPort = new ModbusClientPort(port);
     return clientPort;
 }
+
+ModbusClientPortPool *createClientPortPool(ProtocolType type, const NetSettings *settings, uint32_t size, bool blocking)
+{
+    switch (type)
+    {
+    case TCP:
+    case ASCvTCP:
+    case RTUvTCP:
+        break;
+    default:
+        return nullptr;
+    }
+    ModbusClientPortPool *pool = new ModbusClientPortPool();
+    for (uint32_t i = 0; i < size; i++)
+        pool->addPort(createPort(type, settings, blocking));
+    return pool;
+}
 #endif // MB_CLIENT_DISABLE
 
 #ifndef MB_SERVER_DISABLE
 
 ModbusServerPort *createServer(ModbusInterface *device, ProtocolType type, const NetSettings *settings, bool /*blocking*/)
 {
-    ModbusTcpServer *serv = new ModbusTcpServer(type, device);
+    ModbusTcpServer *serv;
+    if (type == UNIX)
+        serv = new ModbusUnixServer(device);
+    else
+        serv = new ModbusTcpServer(type, device);
     serv->setIpaddr        (settings->ipaddr );
     serv->setPort          (settings->port   );
     serv->setTimeout       (settings->timeout);
@@ -15,6 +15,7 @@
 
 class ModbusPort;
 class ModbusClientPort;
+class ModbusClientPortPool;
 class ModbusServerPort;
 
 // --------------------------------------------------------------------------------------------------------
@@ -447,6 +448,27 @@ using List = std::list<T>;
 /// \details Returns string representation of the last error
 MODBUS_EXPORT String getLastErrorText();
 
+/// \details Returns time to live (milliseconds) of host addresses resolved by TCP client ports. Default is 60000.
+MODBUS_EXPORT uint32_t hostCacheTtl();
+
+/// \details Sets time to live (milliseconds) of host addresses resolved by TCP client ports.
+/// Non-blocking ports resolve host names by background threads, blocking ports resolve them in the calling thread.
+/// Resolved addresses are shared by all ports. Cache is implemented for Unix platforms,
+/// on Windows host names are resolved on every connection.
+MODBUS_EXPORT void setHostCacheTtl(uint32_t msec);
+
+/// \details Clears cache of resolved host addresses, so the host names are resolved again on the next connection.
+MODBUS_EXPORT void clearHostCache();
+
+/// \details Returns socket options with all values set to system defaults.
+MODBUS_EXPORT SocketOptions defaultSocketOptions();
+
+/// \details Returns "low-latency" socket options profile for request/response traffic of small ADUs:
+/// Nagle and delayed ACK are disabled, TCP Fast Open is used on reconnect, dead peer is detected
+/// by keepalive (5 s idle, 3 probes with 1 s interval) and by unacknowledged data timeout (5 s),
+/// blocking read busy polls device queue for 50 us. Buffer sizes are kept system defaults.
+MODBUS_EXPORT SocketOptions lowLatencySocketOptions();
+
 /// \details Returns trim white spaces from the left and right side of the string `str`
 MODBUS_EXPORT String trim(const String &str);
 
@@ -634,32 +656,40 @@ inline bool fillUnitMap(const String &s, void *unitmap) { return fillUnitMap(s.d
 MODBUS_EXPORT String unitMapToString(const void *unitmap);
 
 /// \details Function for creation `ModbusPort` with defined parameters:
-/// \param[in]  type        Protocol type: ASC, RTU, TCP, UDP, ASCvTCP, RTUvTCP, ASCvUDP, ASCvUDP.
-/// \param[in]  settings    For TCP must be pointer: `NetSettings*`, `SerialSettings*` otherwise.
+/// \param[in]  type        Protocol type: ASC, RTU, TCP, UDP, ASCvTCP, RTUvTCP, ASCvUDP, ASCvUDP, UNIX.
+/// \param[in]  settings    For TCP must be pointer: `NetSettings*` (`host` is socket path for UNIX), `SerialSettings*` otherwise.
 /// \param[in]  blocking    If true blocking will be set, non blocking otherwise.
 MODBUS_EXPORT ModbusPort *createPort(ProtocolType type, const void *settings, bool blocking);
 
 #ifndef MB_CLIENT_DISABLE
 /// \details Function for creation `ModbusClientPort` with defined parameters:
-/// \param[in]  type        Protocol type: ASC, RTU, TCP, UDP, ASCvTCP, RTUvTCP, ASCvUDP, ASCvUDP.
-/// \param[in]  settings    For TCP must be pointer: `NetSettings*`, `SerialSettings*` otherwise.
+/// \param[in]  type        Protocol type: ASC, RTU, TCP, UDP, ASCvTCP, RTUvTCP, ASCvUDP, ASCvUDP, UNIX.
+/// \param[in]  settings    For TCP must be pointer: `NetSettings*` (`host` is socket path for UNIX), `SerialSettings*` otherwise.
 /// \param[in]  blocking    If true blocking will be set, non blocking otherwise.
 MODBUS_EXPORT ModbusClientPort *createClientPort(ProtocolType type, const void *settings, bool blocking);
+
+/// \details Function for creation `ModbusClientPortPool` of `size` connections to the same server:
+/// \param[in]  type        Protocol type: TCP, ASCvTCP, RTUvTCP.
+/// \param[in]  settings    Pointer to the `NetSettings` structure.
+/// \param[in]  size        Count of connections (members) of the pool.
+/// \param[in]  blocking    If true blocking will be set, non blocking otherwise.
+/// Returns `nullptr` if `type` is not a connection-oriented network protocol (TCP, ASCvTCP, RTUvTCP).
+MODBUS_EXPORT ModbusClientPortPool *createClientPortPool(ProtocolType type, const NetSettings *settings, uint32_t size, bool blocking);
 #endif // MB_CLIENT_DISABLE
 
 #ifndef MB_SERVER_DISABLE
 
 /// \details Function for creation `ModbusServerPort` for network (server) with defined parameters:
 /// \param[in]  device      Pointer to the `ModbusInterface` implementation to which all requests for Modbus functions are forwarded.
-/// \param[in]  type        Protocol type: TCP, ASCvTCP, RTUvTCP.
-/// \param[in]  settings    Pointer to the `NetSettings` structure.
+/// \param[in]  type        Protocol type: TCP, ASCvTCP, RTUvTCP, UNIX.
+/// \param[in]  settings    Pointer to the `NetSettings` structure (`ipaddr` is socket path for UNIX).
 /// \param[in]  blocking    If true blocking will be set, non blocking otherwise.
 MODBUS_EXPORT ModbusServerPort *createServer(ModbusInterface *device, ProtocolType type, const NetSettings *settings, bool blocking);
 
 /// \details Function for creation `ModbusServerPort` with defined parameters:
 /// \param[in]  device      Pointer to the `ModbusInterface` implementation to which all requests for Modbus functions are forwarded.
-/// \param[in]  type        Protocol type: ASC, RTU, TCP, UDP, ASCvTCP, RTUvTCP, ASCvUDP, ASCvUDP.
-/// \param[in]  settings    For TCP must be pointer: `NetSettings*`, `SerialSettings*` otherwise.
+/// \param[in]  type        Protocol type: ASC, RTU, TCP, UDP, ASCvTCP, RTUvTCP, ASCvUDP, ASCvUDP, UNIX.
+/// \param[in]  settings    For TCP must be pointer: `NetSettings*` (`host` is socket path for UNIX), `SerialSettings*` otherwise.
 /// \param[in]  blocking    If true blocking will be set, non blocking otherwise.
 MODBUS_EXPORT ModbusServerPort *createServerPort(ModbusInterface *device, ProtocolType type, const void *settings, bool blocking);
 
@@ -8,58 +8,136 @@ class ModbusAscFramePrivate : public ModbusFramePrivate
 public:
     ModbusAscFramePrivate() : ModbusFramePrivate(MB_ASC_IO_BUFF_SZ)
     {
+        this->delimiter = '\n';
+        this->pendingBuff = new uint8_t[MB_ASC_IO_BUFF_SZ];
+        this->pendingSz = 0;
+    }
+
+    ~ModbusAscFramePrivate()
+    {
+        delete[] this->pendingBuff;
     }
 
+public:
+    // Note: input delimiter (FC08/03) is the end of request message symbol (replacing LF),
+    // responses are always ended with LF
+    inline uint8_t inputDelimiter() const { return this->modeServer ? this->delimiter : '\n'; }
+    inline uint8_t outputDelimiter() const { return this->modeServer ? '\n' : this->delimiter; }
+
 public:
     StatusCode writeBuffer(uint8_t unit, uint8_t func, const uint8_t *buff, uint16_t szInBuff) override
     {
-        const uint16_t szIBuff = MB_ASC_IO_BUFF_SZ/2;
-        uint8_t ibuff[szIBuff];
-        // 3 is unit, func and LRC bytes
-        if (szInBuff > szIBuff-3)
+        // 3 is ':', CR and LF symbols, next 3 is unit, func and LRC bytes
+        if (szInBuff > (MB_ASC_IO_BUFF_SZ-3)/2-3)
             return this->setError(Status_BadWriteBufferOverflow, StringLiteral("ASCII. Write-buffer overflow"));
-        ibuff[0] = unit;
-        ibuff[1] = func;
-        memcpy(&ibuff[2], buff, szInBuff);
-        ibuff[szInBuff + 2] = lrc(ibuff, szInBuff+2);
-        this->sz = bytesToAscii(ibuff, &this->buff[1], szInBuff + 3);
+        // Note: client can't have pipelined responses before request, so it's garbage
+        if (!this->modeServer)
+            this->pendingSz = 0;
+        // Note: encode data directly into output buffer and calc LRC in the same pass
+        uint8_t sum = 0;
+        uint8_t *p = &this->buff[1];
+        const uint8_t hdr[2] = { unit, func };
+        p += bytesToAsciiLrc(hdr, p, 2, &sum);
+        p += bytesToAsciiLrc(buff, p, szInBuff, &sum);
+        const uint8_t lrc = static_cast<uint8_t>(-static_cast<int8_t>(sum));
+        p += bytesToAscii(&lrc, p, 1);
         this->buff[0] = ':' ;  // start ASCII-message character
-        this->buff[this->sz+1] = '\r';  // CR
-        this->buff[this->sz+2] = '\n';  // LF
-        this->sz += 3;
+        *p++ = '\r';  // CR
+        *p++ = outputDelimiter();  // LF
+        this->sz = static_cast<uint16_t>(p - this->buff);
         return Status_Good;
     }
 
     StatusCode readBuffer(uint8_t &unit, uint8_t &func, uint8_t *buff, uint16_t maxSzBuff, uint16_t *szOutBuff) override
     {
-        const uint16_t szIBuff = MB_ASC_IO_BUFF_SZ/2;
-        uint8_t ibuff[szIBuff];
-
         if (this->sz < 9) // Note: 9 = 1(':')+2(unit)+2(func)+2(lrc)+1('\r')+1('\n')
             return this->setError(Status_BadNotCorrectRequest, StringLiteral("ASCII. Not correct response. Responsed data length is too small"));
 
         if (this->buff[0] != ':')
             return this->setError(Status_BadAscMissColon, StringLiteral("ASCII. Missed colon ':' symbol"));
 
-        if ((this->buff[this->sz-2] != '\r') || (this->buff[this->sz-1] != '\n'))
+        if ((this->buff[this->sz-2] != '\r') || (this->buff[this->sz-1] != inputDelimiter()))
             return this->setError(Status_BadAscMissCrLf, StringLiteral("ASCII. Missed CR-LF ending symbols"));
 
-        if ((this->sz = asciiToBytes(&this->buff[1], ibuff, this->sz-3)) == 0)
+        const uint16_t szAscii = this->sz - 3; // Note: 3 = 1(':')+1('\r')+1('\n')
+        if (szAscii & 1)
             return this->setError(Status_BadAscChar, StringLiteral("ASCII. Bad ASCII symbol"));
 
-        if (lrc(ibuff, this->sz-1) != ibuff[this->sz-1])
-            return this->setError(Status_BadLrc, StringLiteral("ASCII. Error LRC"));
+        const uint16_t szData = szAscii/2 - 3; // Note: 3 = 1(unit)+1(func)+1(lrc)
+        if (szData > maxSzBuff)
+            return this->setError(Status_BadReadBufferOverflow, StringLiteral("ASCII. Read-buffer overflow"));
+
+        // Note: decode, validate and accumulate LRC in a single pass,
+        // data part is decoded directly into output buffer without intermediate copy
+        uint8_t sum = 0;
+        uint8_t hdr[3];
+        const uint8_t *p = &this->buff[1];
+        if (!asciiToBytesLrc(p, hdr, 4, &sum) ||
+            (szData && !asciiToBytesLrc(p+4, buff, szData*2, &sum)) ||
+            !asciiToBytesLrc(p+4+szData*2, &hdr[2], 2, &sum))
+            return this->setError(Status_BadAscChar, StringLiteral("ASCII. Bad ASCII symbol"));
 
-        unit = ibuff[0];
-        func = ibuff[1];
+        if (sum != 0) // Note: sum of all bytes including LRC must be zero
+            return this->setError(Status_BadLrc, StringLiteral("ASCII. Error LRC"));
 
-        this->sz -= 3; // Note: 3 = 1(unit)+1(func)+1(lrc)
-        if (this->sz > maxSzBuff)
-            return this->setError(Status_BadReadBufferOverflow, StringLiteral("ASCII. Read-buffer overflow"));
-        memcpy(buff, &ibuff[2], this->sz);
-        *szOutBuff = this->sz;
+        unit = hdr[0];
+        func = hdr[1];
+        *szOutBuff = szData;
         return Status_Good;
     }
+
+    bool isStreamFrame() const override { return true; }
+
+    bool isFrameEndDetected(uint16_t offset) override
+    {
+        const uint8_t delim = inputDelimiter();
+        // Note: previous symbol is checked again because CR-LF pair can be split between reads
+        for (uint16_t i = (offset ? offset - 1 : 0); i < this->sz; i++)
+        {
+            const uint8_t c = this->buff[i];
+            if (c == ':')
+            {
+                // Note: resynchronize on the last start symbol, all previous data is garbage
+                if (i)
+                {
+                    memmove(this->buff, &this->buff[i], this->sz - i);
+                    this->sz -= i;
+                    i = 0;
+                }
+            }
+            else if ((c == delim) && i && (this->buff[i-1] == '\r') && (this->buff[0] == ':'))
+            {
+                // Note: data after the end of the frame (next pipelined frame) is kept for the next read
+                this->pendingSz = this->sz - (i + 1);
+                memcpy(this->pendingBuff, &this->buff[i + 1], this->pendingSz);
+                this->sz = i + 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool startRead() override
+    {
+        this->sz = this->pendingSz;
+        this->pendingSz = 0;
+        if (this->sz == 0)
+            return false;
+        memcpy(this->buff, this->pendingBuff, this->sz);
+        return isFrameEndDetected(0);
+    }
+
+public:
+    uint8_t delimiter;
+    uint8_t *pendingBuff;
+    uint16_t pendingSz;
 };
 
+#ifndef MBF_DIAGNOSTICS_CHANGE_ASCII_INPUT_DELIMITER_DISABLE
+class ModbusPort;
+
+// Applies ASCII input delimiter (FC08/03) to the port if it uses ASCII framing
+void setPortAsciiInputDelimiter(ModbusPort *port, char delimiter);
+#endif // MBF_DIAGNOSTICS_CHANGE_ASCII_INPUT_DELIMITER_DISABLE
+
 #endif // MODBUSASCFRAME_P_H
\ No newline at end of file
@@ -11,3 +11,13 @@ ModbusAscOverTcpPort::ModbusAscOverTcpPort(bool blocking) :
     ModbusTcpPortBase(ModbusTcpPortBasePrivate::create(new ModbusAscFramePrivate(), nullptr, blocking))
 {
 }
+
+char ModbusAscOverTcpPort::asciiInputDelimiter() const
+{
+    return static_cast<char>(static_cast<ModbusAscFramePrivate*>(d_ptr->frame)->delimiter);
+}
+
+void ModbusAscOverTcpPort::setAsciiInputDelimiter(char delimiter)
+{
+    static_cast<ModbusAscFramePrivate*>(d_ptr->frame)->delimiter = static_cast<uint8_t>(delimiter);
+}
@@ -47,6 +47,15 @@ public:
     /// \details Returns the Modbus protocol type. For `ModbusAscOverTcpPort` returns `Modbus::ASCvTCP`.
     Modbus::ProtocolType type() const override { return Modbus::ASCvTCP; }
 
+public:
+    /// \details Returns ASCII input delimiter - end of request message symbol that replaces LF (LF by default).
+    /// \sa `ModbusClientPort::diagnosticsChangeAsciiInputDelimiter()`
+    char asciiInputDelimiter() const;
+
+    /// \details Sets ASCII input delimiter. In client mode port ends requests with this symbol,
+    /// in server mode port expects it at the end of incoming requests. Responses are always ended with CR-LF.
+    void setAsciiInputDelimiter(char delimiter);
+
 protected:
     using ModbusTcpPortBase::ModbusTcpPortBase;
 };
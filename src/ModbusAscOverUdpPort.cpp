@@ -6,3 +6,13 @@ ModbusAscOverUdpPort::ModbusAscOverUdpPort(bool blocking) :
     ModbusUdpPortBase(ModbusUdpPortBasePrivate::create(new ModbusAscFramePrivate(), blocking))
 {
 }
+
+char ModbusAscOverUdpPort::asciiInputDelimiter() const
+{
+    return static_cast<char>(static_cast<ModbusAscFramePrivate*>(d_ptr->frame)->delimiter);
+}
+
+void ModbusAscOverUdpPort::setAsciiInputDelimiter(char delimiter)
+{
+    static_cast<ModbusAscFramePrivate*>(d_ptr->frame)->delimiter = static_cast<uint8_t>(delimiter);
+}
@@ -39,6 +39,15 @@ public:
     /// \details Returns the Modbus protocol type. For `ModbusAscOverUdpPort` returns `Modbus::ASCvUDP`.
     Modbus::ProtocolType type() const override { return Modbus::ASCvUDP; }
 
+public:
+    /// \details Returns ASCII input delimiter - end of request message symbol that replaces LF (LF by default).
+    /// \sa `ModbusClientPort::diagnosticsChangeAsciiInputDelimiter()`
+    char asciiInputDelimiter() const;
+
+    /// \details Sets ASCII input delimiter. In client mode port ends requests with this symbol,
+    /// in server mode port expects it at the end of incoming requests. Responses are always ended with CR-LF.
+    void setAsciiInputDelimiter(char delimiter);
+
 protected:
     using ModbusUdpPortBase::ModbusUdpPortBase;
 };
@@ -24,7 +24,33 @@
 #include "ModbusSerialPort_p.h"
 #include "ModbusAscFrame_p.h"
 
+#include "ModbusAscOverTcpPort.h"
+#include "ModbusAscOverUdpPort.h"
+
 ModbusAscPort::ModbusAscPort(bool blocking) :
     ModbusSerialPort(ModbusSerialPortPrivate::create(new ModbusAscFramePrivate, blocking))
 {
 }
+
+char ModbusAscPort::asciiInputDelimiter() const
+{
+    return static_cast<char>(static_cast<ModbusAscFramePrivate*>(d_ptr->frame)->delimiter);
+}
+
+void ModbusAscPort::setAsciiInputDelimiter(char delimiter)
+{
+    static_cast<ModbusAscFramePrivate*>(d_ptr->frame)->delimiter = static_cast<uint8_t>(delimiter);
+}
+
+#ifndef MBF_DIAGNOSTICS_CHANGE_ASCII_INPUT_DELIMITER_DISABLE
+// Note: `dynamic_cast` is used because `type()` of user-defined port can't be trusted
+void setPortAsciiInputDelimiter(ModbusPort *port, char delimiter)
+{
+    if (ModbusAscPort *asc = dynamic_cast<ModbusAscPort*>(port))
+        asc->setAsciiInputDelimiter(delimiter);
+    else if (ModbusAscOverTcpPort *asctcp = dynamic_cast<ModbusAscOverTcpPort*>(port))
+        asctcp->setAsciiInputDelimiter(delimiter);
+    else if (ModbusAscOverUdpPort *ascudp = dynamic_cast<ModbusAscOverUdpPort*>(port))
+        ascudp->setAsciiInputDelimiter(delimiter);
+}
+#endif // MBF_DIAGNOSTICS_CHANGE_ASCII_INPUT_DELIMITER_DISABLE
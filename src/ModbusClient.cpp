@@ -9,6 +9,14 @@ ModbusClient::ModbusClient(uint8_t unit, ModbusClientPort *port) :
     ModbusClientPrivate *d = d_cast(d_ptr);
     d->unit            = unit;
     d->port            = port;
+    port->attachClient(this);
+}
+
+ModbusClient::~ModbusClient()
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    if (d->port)
+        d->port->detachClient(this);
 }
 
 
@@ -37,6 +45,32 @@ ModbusClientPort *ModbusClient::port() const
     return d_cast(d_ptr)->port;
 }
 
+uint32_t ModbusClient::requestTimeout() const
+{
+    return d_cast(d_ptr)->port->requestOptions(this).timeout;
+}
+
+void ModbusClient::setRequestTimeout(uint32_t timeout)
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    ModbusClientPort::RequestOptions options = d->port->requestOptions(this);
+    options.timeout = timeout;
+    d->port->setRequestOptions(this, options);
+}
+
+uint32_t ModbusClient::requestDeadline() const
+{
+    return d_cast(d_ptr)->port->requestOptions(this).deadline;
+}
+
+void ModbusClient::setRequestDeadline(uint32_t deadline)
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    ModbusClientPort::RequestOptions options = d->port->requestOptions(this);
+    options.deadline = deadline;
+    d->port->setRequestOptions(this, options);
+}
+
 #ifndef MBF_READ_COILS_DISABLE
 StatusCode ModbusClient::readCoils(uint16_t offset, uint16_t count, void *values)
 {
@@ -323,6 +357,94 @@ StatusCode ModbusClient::readDeviceIdentification(uint8_t readDeviceId, uint8_t
 }
 #endif // MBF_ENCAPSULATED_INTERFACE_TRANSPORT_DISABLE
 
+StatusCode ModbusClient::beginGroup()
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    return d->port->beginGroup(this);
+}
+
+void ModbusClient::endGroup()
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    d->port->endGroup(this);
+}
+
+#ifndef MBF_WRITE_MULTIPLE_COILS_DISABLE
+uint32_t ModbusClient::queueWriteSingleCoil(uint16_t offset, bool value)
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    return d->port->queueWriteSingleCoil(d->unit, offset, value);
+}
+#endif // MBF_WRITE_MULTIPLE_COILS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+uint32_t ModbusClient::queueWriteSingleRegister(uint16_t offset, uint16_t value)
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    return d->port->queueWriteSingleRegister(d->unit, offset, value);
+}
+#endif // MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+
+StatusCode ModbusClient::flushWrites()
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    return d->port->flushWrites(this);
+}
+
+StatusCode ModbusClient::processWrites()
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    return d->port->processWrites(this);
+}
+
+#ifndef MBF_READ_COILS_DISABLE
+StatusCode ModbusClient::readCoilsRange(uint16_t offset, uint16_t count, void *values)
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    return d->port->readCoilsRange(this, d->unit, offset, count, values);
+}
+#endif // MBF_READ_COILS_DISABLE
+
+#ifndef MBF_READ_DISCRETE_INPUTS_DISABLE
+StatusCode ModbusClient::readDiscreteInputsRange(uint16_t offset, uint16_t count, void *values)
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    return d->port->readDiscreteInputsRange(this, d->unit, offset, count, values);
+}
+#endif // MBF_READ_DISCRETE_INPUTS_DISABLE
+
+#ifndef MBF_READ_HOLDING_REGISTERS_DISABLE
+StatusCode ModbusClient::readHoldingRegistersRange(uint16_t offset, uint16_t count, uint16_t *values)
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    return d->port->readHoldingRegistersRange(this, d->unit, offset, count, values);
+}
+#endif // MBF_READ_HOLDING_REGISTERS_DISABLE
+
+#ifndef MBF_READ_INPUT_REGISTERS_DISABLE
+StatusCode ModbusClient::readInputRegistersRange(uint16_t offset, uint16_t count, uint16_t *values)
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    return d->port->readInputRegistersRange(this, d->unit, offset, count, values);
+}
+#endif // MBF_READ_INPUT_REGISTERS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_COILS_DISABLE
+StatusCode ModbusClient::writeMultipleCoilsRange(uint16_t offset, uint16_t count, const void *values)
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    return d->port->writeMultipleCoilsRange(this, d->unit, offset, count, values);
+}
+#endif // MBF_WRITE_MULTIPLE_COILS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+StatusCode ModbusClient::writeMultipleRegistersRange(uint16_t offset, uint16_t count, const uint16_t *values)
+{
+    ModbusClientPrivate *d = d_cast(d_ptr);
+    return d->port->writeMultipleRegistersRange(this, d->unit, offset, count, values);
+}
+#endif // MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+
 StatusCode ModbusClient::lastPortStatus() const
 {
     return d_cast(d_ptr)->port->lastStatus();
@@ -69,6 +69,10 @@ public:
     /// \param[in] port A pointer to the port object to which this client object belongs.
     ModbusClient(uint8_t unit, ModbusClientPort *port);
 
+    /// \details Class destructor. Cancels request and transaction group of the client and removes its request options.
+    /// If the port is destroyed before the client, the client is detached from the port and `port()` returns `nullptr`.
+    ~ModbusClient();
+
 public:
     /// \details Returns the type of the Modbus protocol.
     Modbus::ProtocolType type() const;
@@ -85,6 +89,20 @@ public:
     /// \details Returns a pointer to the port object to which this client object belongs.
     ModbusClientPort *port() const;
 
+    /// \details Returns response timeout of every request try of this client (in milliseconds).
+    /// 0 means port timeout (default).
+    uint32_t requestTimeout() const;
+
+    /// \details Sets response timeout of every request try of this client (see `ModbusClientPort::setRequestOptions()`).
+    void setRequestTimeout(uint32_t timeout);
+
+    /// \details Returns maximum time of every request of this client including all tries (in milliseconds).
+    /// 0 means no deadline (default).
+    uint32_t requestDeadline() const;
+
+    /// \details Sets maximum time of every request of this client including all tries (see `ModbusClientPort::setRequestOptions()`).
+    void setRequestDeadline(uint32_t deadline);
+
 public:
 
 #ifndef MBF_READ_COILS_DISABLE
@@ -305,6 +323,69 @@ public:
 
 #endif // MBF_ENCAPSULATED_INTERFACE_TRANSPORT_DISABLE
 
+public: // transaction groups
+    /// \details Same as `ModbusClientPort::beginGroup(ModbusObject *client)` for this client.
+    Modbus::StatusCode beginGroup();
+
+    /// \details Same as `ModbusClientPort::endGroup(ModbusObject *client)` for this client.
+    void endGroup();
+
+public: // write coalescing
+#ifndef MBF_WRITE_MULTIPLE_COILS_DISABLE
+    /// \details Same as `ModbusClientPort::queueWriteSingleCoil(uint8_t unit, uint16_t offset, bool value)`,
+    /// but the `unit` address of the remote Modbus device is missing. It is preset in the constructor.
+    uint32_t queueWriteSingleCoil(uint16_t offset, bool value);
+#endif // MBF_WRITE_MULTIPLE_COILS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+    /// \details Same as `ModbusClientPort::queueWriteSingleRegister(uint8_t unit, uint16_t offset, uint16_t value)`,
+    /// but the `unit` address of the remote Modbus device is missing. It is preset in the constructor.
+    uint32_t queueWriteSingleRegister(uint16_t offset, uint16_t value);
+#endif // MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+
+    /// \details Same as `ModbusClientPort::flushWrites()`. Note that queue of the port is common for all its clients.
+    Modbus::StatusCode flushWrites();
+
+    /// \details Same as `ModbusClientPort::processWrites()`. Note that queue of the port is common for all its clients.
+    Modbus::StatusCode processWrites();
+
+public: // range requests
+#ifndef MBF_READ_COILS_DISABLE
+    /// \details Same as `ModbusClientPort::readCoilsRange(uint8_t unit, uint16_t offset, uint16_t count, void *values)`,
+    /// but the `unit` address of the remote Modbus device is missing. It is preset in the constructor.
+    Modbus::StatusCode readCoilsRange(uint16_t offset, uint16_t count, void *values);
+#endif // MBF_READ_COILS_DISABLE
+
+#ifndef MBF_READ_DISCRETE_INPUTS_DISABLE
+    /// \details Same as `ModbusClientPort::readDiscreteInputsRange(uint8_t unit, uint16_t offset, uint16_t count, void *values)`,
+    /// but the `unit` address of the remote Modbus device is missing. It is preset in the constructor.
+    Modbus::StatusCode readDiscreteInputsRange(uint16_t offset, uint16_t count, void *values);
+#endif // MBF_READ_DISCRETE_INPUTS_DISABLE
+
+#ifndef MBF_READ_HOLDING_REGISTERS_DISABLE
+    /// \details Same as `ModbusClientPort::readHoldingRegistersRange(uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values)`,
+    /// but the `unit` address of the remote Modbus device is missing. It is preset in the constructor.
+    Modbus::StatusCode readHoldingRegistersRange(uint16_t offset, uint16_t count, uint16_t *values);
+#endif // MBF_READ_HOLDING_REGISTERS_DISABLE
+
+#ifndef MBF_READ_INPUT_REGISTERS_DISABLE
+    /// \details Same as `ModbusClientPort::readInputRegistersRange(uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values)`,
+    /// but the `unit` address of the remote Modbus device is missing. It is preset in the constructor.
+    Modbus::StatusCode readInputRegistersRange(uint16_t offset, uint16_t count, uint16_t *values);
+#endif // MBF_READ_INPUT_REGISTERS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_COILS_DISABLE
+    /// \details Same as `ModbusClientPort::writeMultipleCoilsRange(uint8_t unit, uint16_t offset, uint16_t count, const void *values)`,
+    /// but the `unit` address of the remote Modbus device is missing. It is preset in the constructor.
+    Modbus::StatusCode writeMultipleCoilsRange(uint16_t offset, uint16_t count, const void *values);
+#endif // MBF_WRITE_MULTIPLE_COILS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+    /// \details Same as `ModbusClientPort::writeMultipleRegistersRange(uint8_t unit, uint16_t offset, uint16_t count, const uint16_t *values)`,
+    /// but the `unit` address of the remote Modbus device is missing. It is preset in the constructor.
+    Modbus::StatusCode writeMultipleRegistersRange(uint16_t offset, uint16_t count, const uint16_t *values);
+#endif // MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+
 public:
     /// \details Returns the status of the last operation performed.
     Modbus::StatusCode lastPortStatus() const;
@@ -319,6 +400,9 @@ protected:
     /// \cond
     using ModbusObject::ModbusObject;
     /// \endcond
+
+private:
+    friend class ModbusClientPort;
 };
 
 #endif // MODBUSCLIENT_H
@@ -1,15 +1,139 @@
 #include "ModbusClientPort.h"
 #include "ModbusClientPort_p.h"
+#include "ModbusClient.h"
+#include "ModbusClient_p.h"
 
 #include "ModbusPort.h"
+#include "ModbusSerialPort.h"
+#include "ModbusAscFrame_p.h"
 
 inline ModbusClientPortPrivate *d_cast(ModbusObjectPrivate *d_ptr) { return static_cast<ModbusClientPortPrivate*>(d_ptr); }
 
+void ModbusClientPortPrivate::exchangeEnd()
+{
+    uint64_t tm = timerUs();
+    responseTimeUs = static_cast<uint32_t>(tm - exchangeTimestampUs);
+    bus.busyUs  += tm - exchangeTimestampUs;
+    bus.txBytes += txSize;
+    bus.rxBytes += rxSize;
+    bus.transactions++;
+    bus.syscalls += port->syscallCount() - bus.syscallsBegin;
+    // Note: `dynamic_cast` is used because `type()` of user-defined port can't be trusted
+    if (ModbusSerialPort *serial = dynamic_cast<ModbusSerialPort*>(port))
+    {
+        uint32_t frames = (txSize ? 1 : 0) + (rxSize ? 1 : 0);
+        bus.trafficUs += static_cast<uint64_t>(txSize + rxSize) * serial->charTimeUs() +
+                         static_cast<uint64_t>(frames) * serial->interFrameDelayUs();
+    }
+}
+
+bool ModbusClientPortPrivate::unitCompleted(uint8_t unit, StatusCode status)
+{
+    bool responded;
+    if (StatusIsGood(status) || StatusIsStandardError(status)) // Note: Modbus-exception is the valid response of the unit
+        responded = (rxSize > 0);
+    else if (isNoResponseStatus(status) || isBadResponseStatus(status))
+        responded = false;
+    else
+    {
+        // Note: port errors (open, write etc) are not related to the unit, so interrupted probe is repeated later
+        UnitStates::iterator it = units.find(unit);
+        if ((it != units.end()) && (it->second.stats.circuitState == ModbusClientPort::CircuitHalfOpen))
+        {
+            setCircuitState(it->second, ModbusClientPort::CircuitOpen);
+            return true;
+        }
+        return false;
+    }
+
+    UnitState &u = units[unit];
+    u.stats.requests++;
+    if (responded)
+    {
+        u.stats.responses++;
+        u.stats.consecutiveFailures = 0;
+        u.stats.lastResponseTimeUs = responseTimeUs;
+        if ((u.stats.responses == 1) || (responseTimeUs < u.stats.minResponseTimeUs))
+            u.stats.minResponseTimeUs = responseTimeUs;
+        if (responseTimeUs > u.stats.maxResponseTimeUs)
+            u.stats.maxResponseTimeUs = responseTimeUs;
+        u.sumResponseTimeUs += responseTimeUs;
+        u.stats.avgResponseTimeUs = static_cast<uint32_t>(u.sumResponseTimeUs / u.stats.responses);
+        u.probeInterval = 0;
+        if (u.stats.circuitState == ModbusClientPort::CircuitClosed)
+            return false;
+        setCircuitState(u, ModbusClientPort::CircuitClosed);
+        return true;
+    }
+    u.stats.failures++;
+    u.stats.consecutiveFailures++;
+    if (settings.busScheduler && (u.stats.consecutiveFailures >= settings.unitOfflineThreshold))
+    {
+        if (u.stats.offline) // probe is failed: back off
+            u.probeInterval = (u.probeInterval > settings.unitProbeIntervalMax / 2) ? settings.unitProbeIntervalMax : u.probeInterval * 2;
+        else
+            u.probeInterval = settings.unitProbeInterval;
+        u.probeDelay = jitter(u.probeInterval);
+        u.offlineTimestamp = timer();
+        setCircuitState(u, ModbusClientPort::CircuitOpen);
+        return true;
+    }
+    return false;
+}
+
+// Note: round-trip time estimator is the same as TCP one (RFC 6298, alpha=1/8, beta=1/4).
+// Only valid responses to the first try are sampled (Karn's algorithm), missed response doubles timeout
+void ModbusClientPortPrivate::rttCompleted(uint8_t unit, uint8_t func, StatusCode status)
+{
+    RttState *r;
+    if ((StatusIsGood(status) || StatusIsStandardError(status)) && (rxSize > 0))
+    {
+        if (lastTries > 1)
+            return;
+        r = &rtts[rttKey(unit, func)];
+        if (r->samples == 0)
+        {
+            r->srttUs   = responseTimeUs;
+            r->rttvarUs = responseTimeUs / 2;
+        }
+        else
+        {
+            uint32_t delta = (r->srttUs > responseTimeUs) ? (r->srttUs - responseTimeUs) : (responseTimeUs - r->srttUs);
+            r->rttvarUs = (r->rttvarUs * 3 + delta) / 4;
+            r->srttUs   = (r->srttUs * 7 + responseTimeUs) / 8;
+        }
+        r->samples++;
+        uint64_t var = static_cast<uint64_t>(settings.adaptiveTimeoutFactor) * r->rttvarUs;
+        if (var < 1000) // Note: timer granularity is 1 millisecond
+            var = 1000;
+        uint64_t timeout = (r->srttUs + var + 999) / 1000;
+        r->timeout = timeoutClamp(timeout > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(timeout));
+    }
+    else if (isNoResponseStatus(status))
+    {
+        RttStates::iterator it = rtts.find(rttKey(unit, func));
+        if (it == rtts.end())
+            return; // Note: timeout is already maximum
+        r = &it->second;
+        r->timeout = timeoutClamp((r->timeout > UINT32_MAX / 2) ? UINT32_MAX : r->timeout * 2);
+    }
+    else
+        return;
+    port->setTimeout(r->timeout);
+}
+
 ModbusClientPort::ModbusClientPort(ModbusPort *port) :
     ModbusObject(new ModbusClientPortPrivate(port))
 {
 }
 
+ModbusClientPort::~ModbusClientPort()
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    for (AttachedClients::const_iterator it = d->clients.begin(); it != d->clients.end(); ++it)
+        static_cast<ModbusClientPrivate*>((*it)->d_ptr)->port = nullptr;
+}
+
 ProtocolType ModbusClientPort::type() const
 {
     return d_cast(d_ptr)->port->type();
@@ -51,6 +175,519 @@ void ModbusClientPort::setBroadcastEnabled(bool enable)
     d_cast(d_ptr)->setBroadcastEnabled(enable);
 }
 
+bool ModbusClientPort::isBusSchedulerEnabled() const
+{
+    return d_cast(d_ptr)->settings.busScheduler;
+}
+
+void ModbusClientPort::setBusSchedulerEnabled(bool enable)
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    d->settings.busScheduler = enable;
+    if (!enable)
+    {
+        d->waiting.clear();
+        for (UnitStates::iterator it = d->units.begin(); it != d->units.end(); ++it)
+            d->setCircuitState(it->second, CircuitClosed);
+    }
+}
+
+uint32_t ModbusClientPort::unitOfflineThreshold() const
+{
+    return d_cast(d_ptr)->settings.unitOfflineThreshold;
+}
+
+void ModbusClientPort::setUnitOfflineThreshold(uint32_t count)
+{
+    if (count > 0)
+        d_cast(d_ptr)->settings.unitOfflineThreshold = count;
+}
+
+uint32_t ModbusClientPort::unitProbeInterval() const
+{
+    return d_cast(d_ptr)->settings.unitProbeInterval;
+}
+
+void ModbusClientPort::setUnitProbeInterval(uint32_t interval)
+{
+    d_cast(d_ptr)->settings.unitProbeInterval = interval;
+}
+
+uint32_t ModbusClientPort::unitProbeIntervalMax() const
+{
+    return d_cast(d_ptr)->settings.unitProbeIntervalMax;
+}
+
+void ModbusClientPort::setUnitProbeIntervalMax(uint32_t interval)
+{
+    d_cast(d_ptr)->settings.unitProbeIntervalMax = interval;
+}
+
+uint32_t ModbusClientPort::unitProbeJitter() const
+{
+    return d_cast(d_ptr)->settings.unitProbeJitter;
+}
+
+void ModbusClientPort::setUnitProbeJitter(uint32_t percent)
+{
+    d_cast(d_ptr)->settings.unitProbeJitter = (percent > 100) ? 100 : percent;
+}
+
+ModbusClientPort::CircuitState ModbusClientPort::unitCircuitState(uint8_t unit) const
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    UnitStates::const_iterator it = d->units.find(unit);
+    if (it == d->units.end())
+        return CircuitClosed;
+    return it->second.stats.circuitState;
+}
+
+bool ModbusClientPort::isUnitOffline(uint8_t unit) const
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    UnitStates::const_iterator it = d->units.find(unit);
+    return (it != d->units.end()) && it->second.stats.offline;
+}
+
+bool ModbusClientPort::unitStatistics(uint8_t unit, UnitStatistics *stats) const
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    UnitStates::const_iterator it = d->units.find(unit);
+    if (it == d->units.end())
+        return false;
+    if (stats)
+        *stats = it->second.stats;
+    return true;
+}
+
+void ModbusClientPort::resetUnitStatistics()
+{
+    d_cast(d_ptr)->units.clear();
+}
+
+ModbusClientPort::BusStatistics ModbusClientPort::busStatistics() const
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    BusStatistics s;
+    s.elapsedUs = timerUs() - d->bus.startUs;
+    s.busyUs    = d->bus.busyUs;
+    s.trafficUs = d->bus.trafficUs;
+    s.txBytes   = d->bus.txBytes;
+    s.rxBytes   = d->bus.rxBytes;
+    s.transactions = d->bus.transactions;
+    s.syscalls     = d->bus.syscalls;
+    return s;
+}
+
+double ModbusClientPort::syscallsPerTransaction() const
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    if (d->bus.transactions == 0)
+        return 0.0;
+    return static_cast<double>(d->bus.syscalls) / static_cast<double>(d->bus.transactions);
+}
+
+double ModbusClientPort::busUtilization() const
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    uint64_t elapsed = timerUs() - d->bus.startUs;
+    if (elapsed == 0)
+        return 0.0;
+    double r = static_cast<double>(d->bus.trafficUs) / static_cast<double>(elapsed);
+    return (r > 1.0) ? 1.0 : r;
+}
+
+void ModbusClientPort::resetBusStatistics()
+{
+    d_cast(d_ptr)->busStatisticsReset();
+}
+
+bool ModbusClientPort::isAdaptiveTimeoutEnabled() const
+{
+    return d_cast(d_ptr)->settings.adaptiveTimeout;
+}
+
+void ModbusClientPort::setAdaptiveTimeoutEnabled(bool enable)
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    if (d->settings.adaptiveTimeout == enable)
+        return;
+    d->settings.adaptiveTimeout = enable;
+    if (enable)
+        d->staticTimeout = d->port->timeout();
+    else
+        d->port->setTimeout(d->staticTimeout);
+}
+
+uint32_t ModbusClientPort::adaptiveTimeoutMin() const
+{
+    return d_cast(d_ptr)->settings.adaptiveTimeoutMin;
+}
+
+void ModbusClientPort::setAdaptiveTimeoutMin(uint32_t timeout)
+{
+    d_cast(d_ptr)->settings.adaptiveTimeoutMin = timeout;
+}
+
+uint32_t ModbusClientPort::adaptiveTimeoutMax() const
+{
+    return d_cast(d_ptr)->settings.adaptiveTimeoutMax;
+}
+
+void ModbusClientPort::setAdaptiveTimeoutMax(uint32_t timeout)
+{
+    d_cast(d_ptr)->settings.adaptiveTimeoutMax = timeout;
+}
+
+uint32_t ModbusClientPort::adaptiveTimeoutFactor() const
+{
+    return d_cast(d_ptr)->settings.adaptiveTimeoutFactor;
+}
+
+void ModbusClientPort::setAdaptiveTimeoutFactor(uint32_t k)
+{
+    d_cast(d_ptr)->settings.adaptiveTimeoutFactor = k;
+}
+
+bool ModbusClientPort::isAdaptiveTimeoutPerFunction() const
+{
+    return d_cast(d_ptr)->settings.adaptiveTimeoutPerFunction;
+}
+
+void ModbusClientPort::setAdaptiveTimeoutPerFunction(bool enable)
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    if (d->settings.adaptiveTimeoutPerFunction != enable)
+    {
+        d->settings.adaptiveTimeoutPerFunction = enable;
+        d->rtts.clear();
+    }
+}
+
+bool ModbusClientPort::rttEstimate(uint8_t unit, uint8_t func, RttEstimate *rtt) const
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    RttStates::const_iterator it = d->rtts.find(d->rttKey(unit, func));
+    if (it == d->rtts.end())
+        return false;
+    if (rtt)
+    {
+        rtt->srttUs   = it->second.srttUs;
+        rtt->rttvarUs = it->second.rttvarUs;
+        rtt->timeout  = it->second.timeout;
+        rtt->samples  = it->second.samples;
+    }
+    return true;
+}
+
+ModbusClientPort::RequestOptions ModbusClientPort::requestOptions(const ModbusObject *client) const
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    ClientOptions::const_iterator it = d->clientOptions.find(client);
+    if (it == d->clientOptions.end())
+        return RequestOptions{0, 0};
+    return it->second;
+}
+
+void ModbusClientPort::setRequestOptions(const ModbusObject *client, const RequestOptions &options)
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    if (options.timeout || options.deadline)
+        d->clientOptions[client] = options;
+    else
+        d->clientOptions.erase(client);
+}
+
+uint32_t ModbusClientPort::writeCoalescingWindow() const
+{
+    return d_cast(d_ptr)->settings.writeCoalescingWindow;
+}
+
+void ModbusClientPort::setWriteCoalescingWindow(uint32_t window)
+{
+    d_cast(d_ptr)->settings.writeCoalescingWindow = window;
+}
+
+uint32_t ModbusClientPort::queuedWriteCount() const
+{
+    return d_cast(d_ptr)->writeQueueCount();
+}
+
+Modbus::StatusCode ModbusClientPort::queuedWriteStatus(uint32_t ticket) const
+{
+    const ModbusClientPortPrivate *d = d_cast(d_ptr);
+    uint32_t i = ticket - d->writeStatusBase;
+    if (i < d->writeStatus.size())
+        return d->writeStatus[i];
+    return Status_Uncertain;
+}
+
+#ifndef MBF_WRITE_MULTIPLE_COILS_DISABLE
+uint32_t ModbusClientPort::queueWriteSingleCoil(uint8_t unit, uint16_t offset, bool value)
+{
+    return d_cast(d_ptr)->writeQueuePush(unit, MBF_WRITE_MULTIPLE_COILS, offset, value);
+}
+#endif // MBF_WRITE_MULTIPLE_COILS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+uint32_t ModbusClientPort::queueWriteSingleRegister(uint8_t unit, uint16_t offset, uint16_t value)
+{
+    return d_cast(d_ptr)->writeQueuePush(unit, MBF_WRITE_MULTIPLE_REGISTERS, offset, value);
+}
+#endif // MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+
+Modbus::StatusCode ModbusClientPort::flushWrites(ModbusObject *client)
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+
+    if (d->flight.client != client)
+    {
+        // Note: port is held by other client (its flush or single request is in progress)
+        if (d->flight.client || d->isSeizedByOther(client))
+        {
+            d->busDenied(client);
+            return Status_Processing;
+        }
+        if (d->writeQueue.empty() && !d->flight.count)
+            return Status_Good;
+        d->flight.client = client;
+        d->flight.status = Status_Good;
+    }
+
+    // Note: writes queued while the previous request is in progress are sent within the same flush
+    while (d->flight.count || !d->writeQueue.empty())
+    {
+        if (!d->flight.count)
+        {
+            const QueuedRun &run = d->writeQueue.front();
+            d->writeQueueTake(d->rangeBlock(run.unit, run.func));
+        }
+        uint8_t func = d->flight.func;
+        if (d->flight.count == 1)
+        {
+#ifndef MBF_WRITE_SINGLE_COIL_DISABLE
+            if (func == MBF_WRITE_MULTIPLE_COILS)
+                func = MBF_WRITE_SINGLE_COIL;
+#endif // MBF_WRITE_SINGLE_COIL_DISABLE
+#ifndef MBF_WRITE_SINGLE_REGISTER_DISABLE
+            if (func == MBF_WRITE_MULTIPLE_REGISTERS)
+                func = MBF_WRITE_SINGLE_REGISTER;
+#endif // MBF_WRITE_SINGLE_REGISTER_DISABLE
+        }
+        StatusCode r = rangeChunk(client, d->flight.unit, func, d->flight.offset, d->flight.count, d->flight.values);
+        if (StatusIsProcessing(r))
+            return r;
+        d->writeQueueComplete(r);
+        if (!StatusIsGood(r) && StatusIsGood(d->flight.status))
+            d->flight.status = r;
+    }
+    d->flight.client = nullptr;
+    return d->flight.status;
+}
+
+Modbus::StatusCode ModbusClientPort::processWrites(ModbusObject *client)
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    if (!d->flight.client && !d->flight.count &&
+        (d->writeQueue.empty() || (timer() - d->writeQueueTimestamp < d->settings.writeCoalescingWindow)))
+        return Status_Good;
+    return flushWrites(client);
+}
+
+uint16_t ModbusClientPort::unitMaxRegisters(uint8_t unit) const
+{
+    UnitConfigs::const_iterator it = d_cast(d_ptr)->unitConfigs.find(unit);
+    return (it != d_cast(d_ptr)->unitConfigs.end()) ? it->second.maxRegisters : 0;
+}
+
+void ModbusClientPort::setUnitMaxRegisters(uint8_t unit, uint16_t count)
+{
+    UnitConfig &l = d_cast(d_ptr)->unitConfigs[unit];
+    l.maxRegisters = count;
+    if (!l.maxRegisters && !l.maxDiscrets && !l.capabilities)
+        d_cast(d_ptr)->unitConfigs.erase(unit);
+}
+
+uint16_t ModbusClientPort::unitMaxDiscrets(uint8_t unit) const
+{
+    UnitConfigs::const_iterator it = d_cast(d_ptr)->unitConfigs.find(unit);
+    return (it != d_cast(d_ptr)->unitConfigs.end()) ? it->second.maxDiscrets : 0;
+}
+
+void ModbusClientPort::setUnitMaxDiscrets(uint8_t unit, uint16_t count)
+{
+    UnitConfig &l = d_cast(d_ptr)->unitConfigs[unit];
+    l.maxDiscrets = count;
+    if (!l.maxRegisters && !l.maxDiscrets && !l.capabilities)
+        d_cast(d_ptr)->unitConfigs.erase(unit);
+}
+
+uint32_t ModbusClientPort::unitCapabilities(uint8_t unit) const
+{
+    return d_cast(d_ptr)->unitCapabilities(unit);
+}
+
+void ModbusClientPort::setUnitCapabilities(uint8_t unit, uint32_t capabilities)
+{
+    UnitConfig &l = d_cast(d_ptr)->unitConfigs[unit];
+    l.capabilities = capabilities;
+    if (!l.maxRegisters && !l.maxDiscrets && !l.capabilities)
+        d_cast(d_ptr)->unitConfigs.erase(unit);
+}
+
+uint16_t ModbusClientPort::lastRangeChunkCount() const
+{
+    return static_cast<uint16_t>(d_cast(d_ptr)->rangeStatus.size());
+}
+
+Modbus::StatusCode ModbusClientPort::lastRangeChunkStatus(uint16_t chunk) const
+{
+    const ModbusClientPortPrivate *d = d_cast(d_ptr);
+    if (chunk < d->rangeStatus.size())
+        return d->rangeStatus[chunk];
+    return Status_Uncertain;
+}
+
+#ifndef MBF_READ_COILS_DISABLE
+Modbus::StatusCode ModbusClientPort::readCoilsRange(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, void *values)
+{
+    return rangeRequest(client, unit, MBF_READ_COILS, offset, count, values);
+}
+#endif // MBF_READ_COILS_DISABLE
+
+#ifndef MBF_READ_DISCRETE_INPUTS_DISABLE
+Modbus::StatusCode ModbusClientPort::readDiscreteInputsRange(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, void *values)
+{
+    return rangeRequest(client, unit, MBF_READ_DISCRETE_INPUTS, offset, count, values);
+}
+#endif // MBF_READ_DISCRETE_INPUTS_DISABLE
+
+#ifndef MBF_READ_HOLDING_REGISTERS_DISABLE
+Modbus::StatusCode ModbusClientPort::readHoldingRegistersRange(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values)
+{
+    return rangeRequest(client, unit, MBF_READ_HOLDING_REGISTERS, offset, count, values);
+}
+#endif // MBF_READ_HOLDING_REGISTERS_DISABLE
+
+#ifndef MBF_READ_INPUT_REGISTERS_DISABLE
+Modbus::StatusCode ModbusClientPort::readInputRegistersRange(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values)
+{
+    return rangeRequest(client, unit, MBF_READ_INPUT_REGISTERS, offset, count, values);
+}
+#endif // MBF_READ_INPUT_REGISTERS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_COILS_DISABLE
+Modbus::StatusCode ModbusClientPort::writeMultipleCoilsRange(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, const void *values)
+{
+    return rangeRequest(client, unit, MBF_WRITE_MULTIPLE_COILS, offset, count, const_cast<void*>(values));
+}
+#endif // MBF_WRITE_MULTIPLE_COILS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+Modbus::StatusCode ModbusClientPort::writeMultipleRegistersRange(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, const uint16_t *values)
+{
+    return rangeRequest(client, unit, MBF_WRITE_MULTIPLE_REGISTERS, offset, count, const_cast<uint16_t*>(values));
+}
+#endif // MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+
+Modbus::StatusCode ModbusClientPort::rangeChunk(ModbusObject *client, uint8_t unit, uint8_t func, uint16_t offset, uint16_t count, void *values)
+{
+    switch (func)
+    {
+#ifndef MBF_WRITE_SINGLE_COIL_DISABLE
+    case MBF_WRITE_SINGLE_COIL:
+        return writeSingleCoil(client, unit, offset, (*reinterpret_cast<uint8_t*>(values) & 1) != 0);
+#endif // MBF_WRITE_SINGLE_COIL_DISABLE
+#ifndef MBF_WRITE_SINGLE_REGISTER_DISABLE
+    case MBF_WRITE_SINGLE_REGISTER:
+        return writeSingleRegister(client, unit, offset, *reinterpret_cast<uint16_t*>(values));
+#endif // MBF_WRITE_SINGLE_REGISTER_DISABLE
+#ifndef MBF_READ_COILS_DISABLE
+    case MBF_READ_COILS:
+        return readCoils(client, unit, offset, count, values);
+#endif // MBF_READ_COILS_DISABLE
+#ifndef MBF_READ_DISCRETE_INPUTS_DISABLE
+    case MBF_READ_DISCRETE_INPUTS:
+        return readDiscreteInputs(client, unit, offset, count, values);
+#endif // MBF_READ_DISCRETE_INPUTS_DISABLE
+#ifndef MBF_READ_HOLDING_REGISTERS_DISABLE
+    case MBF_READ_HOLDING_REGISTERS:
+        return readHoldingRegisters(client, unit, offset, count, reinterpret_cast<uint16_t*>(values));
+#endif // MBF_READ_HOLDING_REGISTERS_DISABLE
+#ifndef MBF_READ_INPUT_REGISTERS_DISABLE
+    case MBF_READ_INPUT_REGISTERS:
+        return readInputRegisters(client, unit, offset, count, reinterpret_cast<uint16_t*>(values));
+#endif // MBF_READ_INPUT_REGISTERS_DISABLE
+#ifndef MBF_WRITE_MULTIPLE_COILS_DISABLE
+    case MBF_WRITE_MULTIPLE_COILS:
+        return writeMultipleCoils(client, unit, offset, count, values);
+#endif // MBF_WRITE_MULTIPLE_COILS_DISABLE
+#ifndef MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+    case MBF_WRITE_MULTIPLE_REGISTERS:
+        return writeMultipleRegisters(client, unit, offset, count, reinterpret_cast<uint16_t*>(values));
+#endif // MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+    default:
+        return Status_BadIllegalFunction;
+    }
+}
+
+Modbus::StatusCode ModbusClientPort::rangeRequest(ModbusObject *client, uint8_t unit, uint8_t func, uint16_t offset, uint16_t count, void *values)
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+
+    if (d->range.client != client)
+    {
+        // Note: port is held by other client (its range or single request is in progress)
+        if (d->range.client || d->isSeizedByOther(client))
+        {
+            d->busDenied(client);
+            return Status_Processing;
+        }
+        if (static_cast<uint32_t>(offset) + count > 0x10000)
+        {
+            this->getRequestStatus(client); // Note: seize the port to report an error
+            const size_t len = 100;
+            Char errbuff[len];
+            snprintf(errbuff, len, StringLiteral("FC%02hhu. Range (offset=%hu, count=%hu) is out of address space"), func, offset, count);
+            RAISE_ERROR_COMPLETED(Status_BadNotCorrectRequest, errbuff);
+        }
+        d->range.client = client;
+        d->range.func   = func;
+        d->range.block  = d->rangeBlock(unit, func);
+        d->range.done   = 0;
+        d->range.status = Status_Good;
+        d->rangeStatus.assign((count + d->range.block - 1) / d->range.block, Status_Uncertain);
+    }
+
+    const bool discrets = (func == MBF_READ_COILS) || (func == MBF_READ_DISCRETE_INPUTS) || (func == MBF_WRITE_MULTIPLE_COILS);
+    // Note: chunks are processed one after another within the single call, so the port is seized
+    // again by the same client right after the previous chunk is completed and other clients can't interleave
+    while (d->range.done < count)
+    {
+        uint16_t c = count - d->range.done;
+        if (c > d->range.block)
+            c = d->range.block;
+        uint8_t *v = reinterpret_cast<uint8_t*>(values) + (discrets ? d->range.done / 8 : d->range.done * sizeof(uint16_t));
+        StatusCode r = rangeChunk(client, unit, func, offset + d->range.done, c, v);
+        if (StatusIsProcessing(r))
+            return r;
+        d->rangeStatus[d->range.done / d->range.block] = r;
+        d->range.done += c;
+        if (!StatusIsGood(r))
+        {
+            if (StatusIsGood(d->range.status))
+                d->range.status = r;
+            // Note: Modbus-exception is the answer for the current chunk only, other errors
+            // (no response, port errors) make the rest of the range meaningless
+            if (!StatusIsStandardError(r))
+                break;
+        }
+    }
+    d->range.client = nullptr;
+    d->lastStatus = d->range.status;
+    return d->range.status;
+}
+
 #ifndef MBF_READ_COILS_DISABLE
 StatusCode ModbusClientPort::readCoils(uint8_t unit, uint16_t offset, uint16_t count, void *values)
 {
@@ -205,6 +842,11 @@ Modbus::StatusCode ModbusClientPort::readHoldingRegisters(ModbusObject *client,
 {
     ModbusClientPortPrivate *d = d_cast(d_ptr);
 
+#ifndef MBF_READ_WRITE_MULTIPLE_REGISTERS_DISABLE
+    if (d->isReadWriteFusion(client, unit, count))
+        return readHoldingRegistersFused(client, unit, offset, count, values);
+#endif // MBF_READ_WRITE_MULTIPLE_REGISTERS_DISABLE
+
     const uint16_t szBuff = 300;
 
     uint8_t buff[szBuff];
@@ -680,8 +1322,13 @@ Modbus::StatusCode ModbusClientPort::diagnosticsChangeAsciiInputDelimiter(Modbus
                           &szOutBuff);      // count of output data bytes
         if (StatusIsProcessing(r))
             return r;
-        if (!StatusIsGood(r) || d->isBroadcast())
+        if (!StatusIsGood(r))
+            RAISE_COMPLETED(r);
+        if (d->isBroadcast())
+        {
+            setPortAsciiInputDelimiter(d->port, delimiter);
             RAISE_COMPLETED(r);
+        }
 
         if (szOutBuff != 4)
             RAISE_ERROR_COMPLETED(Status_BadNotCorrectResponse, StringLiteral("FC08. ChangeAsciiInputDelimiter. Incorrect received data size"));
@@ -690,6 +1337,7 @@ Modbus::StatusCode ModbusClientPort::diagnosticsChangeAsciiInputDelimiter(Modbus
         if (outSubfunc != d->subfunc)
             RAISE_ERROR_COMPLETED(Status_BadNotCorrectResponse, StringLiteral("FC08. ChangeAsciiInputDelimiter. 'Subfunc' is not match received one"));
 
+        setPortAsciiInputDelimiter(d->port, delimiter);
         RAISE_COMPLETED(Modbus::Status_Good);
     default:
         return Status_Processing;
@@ -1932,6 +2580,50 @@ StatusCode ModbusClientPort::readWriteMultipleRegisters(ModbusObject *client, ui
         return Status_Processing;
     }
 }
+
+Modbus::StatusCode ModbusClientPort::readHoldingRegistersFused(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values)
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+
+    StatusCode r;
+    if (!d->flight.client)
+    {
+        d->writeQueueTake(MB_SPEC_MAX_READ_WRITE_REGISTERS);
+        d->flight.client = client;
+        d->flight.fused = true;
+        d->flight.func = MBF_READ_WRITE_MULTIPLE_REGISTERS;
+        d->flight.status = Status_Good;
+    }
+    if (d->flight.func == MBF_READ_WRITE_MULTIPLE_REGISTERS)
+    {
+        r = readWriteMultipleRegisters(client, unit, offset, count, values, d->flight.offset, d->flight.count, d->flight.values);
+        if (StatusIsProcessing(r))
+            return r;
+        d->flight.func = MBF_WRITE_MULTIPLE_REGISTERS;
+        if (r != Status_BadIllegalFunction)
+        {
+            d->flight.client = nullptr;
+            d->flight.fused = false;
+            d->writeQueueComplete(r);
+            return r;
+        }
+        // Note: unit does not support FC23, so taken writes are sent before the read to keep the order of requests
+        setUnitCapabilities(unit, d->unitCapabilities(unit) & ~CapabilityReadWriteMultipleRegisters);
+    }
+    uint8_t func = MBF_WRITE_MULTIPLE_REGISTERS;
+#ifndef MBF_WRITE_SINGLE_REGISTER_DISABLE
+    if (d->flight.count == 1)
+        func = MBF_WRITE_SINGLE_REGISTER;
+#endif // MBF_WRITE_SINGLE_REGISTER_DISABLE
+    r = rangeChunk(client, d->flight.unit, func, d->flight.offset, d->flight.count, d->flight.values);
+    if (StatusIsProcessing(r))
+        return r;
+    d->writeQueueComplete(r);
+    d->flight.client = nullptr;
+    d->flight.fused = false;
+    return readHoldingRegisters(client, unit, offset, count, values);
+}
+
 #endif // MBF_READ_WRITE_MULTIPLE_REGISTERS_DISABLE
 
 #ifndef MBF_READ_FIFO_QUEUE_DISABLE
@@ -2080,7 +2772,10 @@ void ModbusClientPort::setPort(ModbusPort *port)
         old->close();
         d->currentClient = nullptr;
         d->state = STATE_UNKNOWN;
+        d->timeoutOverridden = false;
         d->port = port;
+        if (d->settings.adaptiveTimeout)
+            d->staticTimeout = port->timeout();
         delete old;
     }
 }
@@ -2122,24 +2817,104 @@ const ModbusObject *ModbusClientPort::currentClient() const
 ModbusClientPort::RequestStatus ModbusClientPort::getRequestStatus(ModbusObject *client)
 {
     ModbusClientPortPrivate *d = d_cast(d_ptr);
+    d->groupCheck();
     if (d->currentClient)
     {
         if (d->currentClient == client)
             return Process;
+        d->busDenied(client);
         return Disable;
     }
+    else if (d->groupClient)
+    {
+        // Note: port is already granted to the transaction group, so it is not arbitrated again
+        if (d->groupClient != client)
+        {
+            d->busDenied(client);
+            return Disable;
+        }
+        d->currentClient = client;
+        d->groupTimestamp = timer();
+        return Enable;
+    }
     else
     {
         d->currentClient = client;
+        d->busGranted(client);
         return Enable;
     }
 }
 
+StatusCode ModbusClientPort::beginGroup(ModbusObject *client)
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    if (d->groupClient == client)
+        return Status_Good;
+    if (d->isSeizedByOther(client))
+    {
+        d->busDenied(client);
+        return Status_Processing;
+    }
+    d->groupClient = client;
+    d->groupTimestamp = timer();
+    d->busGranted(client);
+    return Status_Good;
+}
+
+void ModbusClientPort::endGroup(ModbusObject *client)
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    if (d->groupClient == client)
+        d->groupClient = nullptr;
+}
+
+const ModbusObject *ModbusClientPort::groupClient() const
+{
+    return d_cast(d_ptr)->groupClient;
+}
+
+uint32_t ModbusClientPort::groupTimeout() const
+{
+    return d_cast(d_ptr)->settings.groupTimeout;
+}
+
+void ModbusClientPort::setGroupTimeout(uint32_t timeout)
+{
+    d_cast(d_ptr)->settings.groupTimeout = timeout;
+}
+
 void ModbusClientPort::cancelRequest(ModbusObject *client)
 {
     ModbusClientPortPrivate *d = d_cast(d_ptr);
+    if (d->range.client == client)
+        d->range.client = nullptr;
+    if (d->flight.client == client)
+    {
+        d->flight.client = nullptr; // Note: request in flight is sent again by the next flush
+        d->flight.fused = false;
+        if (d->flight.func == MBF_READ_WRITE_MULTIPLE_REGISTERS)
+            d->flight.func = MBF_WRITE_MULTIPLE_REGISTERS;
+    }
     if (d->currentClient == client)
+    {
+        d->abandon();
         d->currentClient = nullptr;
+    }
+    if (d->groupClient == client)
+        d->groupClient = nullptr;
+}
+
+void ModbusClientPort::attachClient(ModbusClient *client)
+{
+    d_cast(d_ptr)->clients.insert(client);
+}
+
+void ModbusClientPort::detachClient(ModbusClient *client)
+{
+    ModbusClientPortPrivate *d = d_cast(d_ptr);
+    cancelRequest(client);
+    d->clientOptions.erase(client);
+    d->clients.erase(client);
 }
 
 void ModbusClientPort::signalOpened(const Modbus::Char *source)
@@ -2172,6 +2947,11 @@ void ModbusClientPort::signalCompleted(const Modbus::Char *source, Modbus::Statu
     emitSignal(__func__, &ModbusClientPort::signalCompleted, source, status);
 }
 
+void ModbusClientPort::signalUnitStateChanged(const Modbus::Char *source, uint8_t unit, ModbusClientPort::CircuitState state)
+{
+    emitSignal(__func__, &ModbusClientPort::signalUnitStateChanged, source, unit, state);
+}
+
 StatusCode ModbusClientPort::rawRequest(const void *inBuff, uint16_t szInBuff, void *outBuff, uint16_t maxSzBuff, uint16_t *szOutBuff)
 {
     RequestStatus rs = getRequestStatus(this);
@@ -2192,21 +2972,25 @@ StatusCode ModbusClientPort::rawRequest(const void *inBuff, uint16_t szInBuff, v
                 SET_PORT_ERROR(s);
                 RAISE_COMPLETED(s);
             }
+            d->requestBegin();
+            d->tryTimeoutApply();
             d->blockWriteBuffer();
         }
         StatusCode r = process();
         if (StatusIsProcessing(r))
             return r;
         d->lastTries = ++d->repeats;
-        if (StatusIsBad(r) && (d->repeats < d->settings.tries))
+        if (StatusIsBad(r) && (d->repeats < d->settings.tries) && !d->isDeadlineElapsed())
         {
             d->port->setNextRequestRepeated(true);
+            d->tryTimeoutApply();
             if (d->port->isNonBlocking())
                 return Status_Processing;
             continue;
         }
         d->freeWriteBuffer();
         d->repeats = 0;
+        d->requestEnd();
         //d->currentClient = nullptr;
         if (StatusIsBad(r))
             RAISE_COMPLETED(r);
@@ -2230,57 +3014,82 @@ StatusCode ModbusClientPort::request(uint8_t unit, uint8_t func, const uint8_t *
             d->unit = unit;
             d->func = func;
             d->lastTries = 0;
+            bool probe;
+            if (d->isUnitSkipped(unit, &probe))
+                RAISE_ERROR(Status_BadUnitOffline, StringLiteral("Unit is offline. Request is skipped by the bus scheduler"));
+            if (probe)
+                signalUnitStateChanged(d->getName(), unit, CircuitHalfOpen);
+            if (d->settings.adaptiveTimeout && !d->isBroadcast())
+                d->port->setTimeout(d->adaptiveTimeout(unit, func));
             auto r = d->port->writeBuffer(unit, func, inBuff, szInBuff);
             if (StatusIsBad(r))
                 RAISE_PORT_ERROR(r);
+            d->requestBegin();
+            d->tryTimeoutApply();
             d->blockWriteBuffer();
 
         }
         StatusCode r = process();
         if (StatusIsProcessing(r))
             return r;
+        // Note: missed response adjusts timeout of the next try, received response is sampled after it's validated
+        if (d->settings.adaptiveTimeout && !d->isBroadcast() && StatusIsBad(r))
+            d->rttCompleted(unit, func, r);
         d->lastTries = ++d->repeats;
-        if (StatusIsBad(r) && (d->repeats < d->settings.tries))
+        if (StatusIsBad(r) && (d->repeats < d->settings.tries) && !d->isDeadlineElapsed())
         {
             d->port->setNextRequestRepeated(true);
+            d->tryTimeoutApply();
             if (d->port->isNonBlocking())
                 return Status_Processing;
             continue;
         }
         d->freeWriteBuffer();
         d->repeats = 0;
+        d->requestEnd();
         //d->currentClient = nullptr;
-        if (StatusIsBad(r))
+        if (d->isBroadcast())
             return r;
-        if (!d->isBroadcast())
+        if (!StatusIsBad(r))
         {
             r = d->port->readBuffer(unit, func, outBuff, maxSzBuff, szOutBuff);
-            if (!StatusIsBad(r))
+            if (StatusIsBad(r))
             {
-                if (unit != d->unit)
-                    RAISE_ERROR(Status_BadNotCorrectResponse, StringLiteral("Not correct response. Requested unit (unit) is not equal to responsed"));
-
-                if ((func & MBF_EXCEPTION) == MBF_EXCEPTION)
+                SET_PORT_ERROR(r);
+            }
+            else if (unit != d->unit)
+            {
+                r = Status_BadNotCorrectResponse;
+                SET_ERROR(r, StringLiteral("Not correct response. Requested unit (unit) is not equal to responsed"));
+            }
+            else if ((func & MBF_EXCEPTION) == MBF_EXCEPTION)
+            {
+                if (*szOutBuff > 0)
                 {
-                    if (*szOutBuff > 0)
-                    {
-                        auto errcode = outBuff[0];
-                        const size_t len = 62;
-                        Char errbuff[len];
-                        snprintf(errbuff, len, StringLiteral("Returned Modbus-exception with code 0x%hhX"), errcode);
-                        r = static_cast<StatusCode>(Status_Bad | errcode);
-                        RAISE_ERROR(r, errbuff);
-                    }
-                    else
-                        RAISE_ERROR(Status_BadNotCorrectResponse, StringLiteral("Returned Modbus-exception but code missed"));
+                    auto errcode = outBuff[0];
+                    const size_t len = 62;
+                    Char errbuff[len];
+                    snprintf(errbuff, len, StringLiteral("Returned Modbus-exception with code 0x%hhX"), errcode);
+                    r = static_cast<StatusCode>(Status_Bad | errcode);
+                    SET_ERROR(r, errbuff);
                 }
-
-                if (func != d->func)
-                    RAISE_ERROR(Status_BadNotCorrectResponse, StringLiteral("Not correct response. Requested function is not equal to responsed"));
-                return r;
+                else
+                {
+                    r = Status_BadNotCorrectResponse;
+                    SET_ERROR(r, StringLiteral("Returned Modbus-exception but code missed"));
+                }
+            }
+            else if (func != d->func)
+            {
+                r = Status_BadNotCorrectResponse;
+                SET_ERROR(r, StringLiteral("Not correct response. Requested function is not equal to responsed"));
             }
-            RAISE_PORT_ERROR(r);
+            if (d->settings.adaptiveTimeout)
+                d->rttCompleted(d->unit, d->func, r);
         }
+        // Note: unit health and circuit breaker get the final status, so corrupted or foreign response is a failure
+        if (d->unitCompleted(d->unit, r))
+            signalUnitStateChanged(d->getName(), d->unit, d->units[d->unit].stats.circuitState);
         return r;
     }
 }
@@ -2350,6 +3159,7 @@ StatusCode ModbusClientPort::process()
             MB_FALLTHROUGH
         case STATE_BEGIN_WRITE:
             d->timestampRefresh();
+            d->exchangeBegin();
             if (!d->port->isOpen())
             {
                 d->state = STATE_CLOSED;
@@ -2368,9 +3178,13 @@ StatusCode ModbusClientPort::process()
                 return r;
             }
             else
-                signalTx(d->getName(), d->port->writeBufferData(), d->port->writeBufferSize());
+            {
+                d->txSize = d->port->writeBufferSize();
+                signalTx(d->getName(), d->port->writeBufferData(), d->txSize);
+            }
             if (d->isBroadcast())
             {
+                d->exchangeEnd();
                 d->state = STATE_OPENED;
                 return r;
             }
@@ -2387,12 +3201,17 @@ StatusCode ModbusClientPort::process()
             d->setPortStatus(r);
             if (StatusIsBad(r))
             {
+                d->exchangeEnd();
                 signalError(d->getName(), r, d->port->lastErrorText());
+                // Note: unit has already had full timeout to respond, bus scheduler takes care of backoff
+                d->skipTimeoutWait = d->settings.busScheduler && isNoResponseStatus(r);
                 d->state = STATE_TIMEOUT;
             }
             else
             {
                 auto szRead = d->port->readBufferSize();
+                d->rxSize = szRead;
+                d->exchangeEnd();
                 if (szRead > 0)
                     signalRx(d->getName(), d->port->readBufferData(), szRead);
                 if (d->port->isOpen())
@@ -2408,13 +3227,14 @@ StatusCode ModbusClientPort::process()
         case STATE_TIMEOUT:
         {
             uint32_t t = timer() - d->timestamp;
-            if (t < d->port->timeout())
+            if ((t < d->port->timeout()) && !d->skipTimeoutWait)
             {
                 if (d->port->isBlocking())
                     msleep(d->port->timeout() - t);
                 else
                     return Status_Processing;
             }
+            d->skipTimeoutWait = false;
             d->state = STATE_UNKNOWN;
             fRepeatAgain = true;
         }
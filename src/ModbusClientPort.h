@@ -11,6 +11,7 @@
 #include "ModbusObject.h"
 
 class ModbusPort;
+class ModbusClient;
 
 /*! \brief The `ModbusClientPort` class implements the algorithm of the client partof the Modbus communication protocol port.
 
@@ -63,6 +64,59 @@ class ModbusPort;
     the same function until it completes (returns Good status) or fails (returns error status).
     This allows integration with event loops and asynchronous architectures without blocking.
     
+    Bus scheduler:
+    All clients that share one `ModbusClientPort` share one line (e.g. RTU bus), so a silent unit
+    costs a full port timeout on every request. When the bus scheduler is enabled
+    (`setBusSchedulerEnabled()`), every unit has a circuit breaker (`CircuitState`). A unit that did not
+    respond to `unitOfflineThreshold()` consecutive requests is considered offline (`CircuitOpen`) and its
+    requests are rejected immediately with `Status_BadUnitOffline`. After `unitProbeInterval()`
+    (randomized by `unitProbeJitter()` percent) the next request to the unit is sent as a probe when no
+    other client waits for the port (`CircuitHalfOpen`). Successful probe closes the circuit, failed one
+    opens it again and doubles the interval up to `unitProbeIntervalMax()`. While the scheduler is enabled
+    a missed response does not add the extra port timeout wait before the next request.
+    Every change of the unit state is reported by `signalUnitStateChanged()`. Per-unit response
+    statistics (`unitStatistics()`) and bus occupancy (`busStatistics()`, `busUtilization()`) are
+    collected regardless of the scheduler state.
+
+    Adaptive timeout:
+    When adaptive timeout is enabled (`setAdaptiveTimeoutEnabled()`), the client port keeps smoothed
+    round-trip time SRTT and its variation RTTVAR for every unit (optionally for every unit and function)
+    the same way TCP does (RFC 6298) and sets `ModbusPort::timeout()` before every request to
+    `SRTT + k*RTTVAR` clamped to [`adaptiveTimeoutMin()`, `adaptiveTimeoutMax()`]. Only responses to the
+    first try are sampled, every missed response doubles the timeout of the unit until next sample.
+    Blocking ports apply their timeout when opened, so the mode is effective for non-blocking ports.
+
+    Request options:
+    Every client of the port can have its own response timeout and deadline (`setRequestOptions()`).
+    The timeout replaces port (or adaptive) timeout for every try of the client request, the deadline
+    limits total time of the request including all tries: the timeout of every try is cut to the rest
+    of the deadline and no more tries are made after the deadline is elapsed. Port timeout is restored
+    when the request is completed.
+
+    Range requests:
+    Functions with `Range` suffix (e.g. `readHoldingRegistersRange()`) accept ranges longer than one
+    request allows. The range is split into requests of `unitMaxRegisters()` registers (`unitMaxDiscrets()`
+    discretes), which are sent one after another while the port is held by the client, so requests of
+    other clients are not interleaved. Status of every request (chunk) is available with
+    `lastRangeChunkStatus()`. Chunk that failed with Modbus-exception does not stop the range, other errors
+    (e.g. no response) do, the rest chunks are not processed and have `Status_Uncertain` status then.
+
+    Write coalescing:
+    Writes queued with `queueWriteSingleCoil()`/`queueWriteSingleRegister()` are not sent immediately.
+    They are collected until `flushWrites()` is called or `writeCoalescingWindow()` elapses for `processWrites()`.
+    Writes are sent in the order they were queued. A write is merged with the previous one(s) into one
+    `writeMultipleCoils()`/`writeMultipleRegisters()` request if it has the same unit and function and its address
+    follows them (single address is written by `writeSingleCoil()`/`writeSingleRegister()`). A write to the address
+    which is already pending in the same request replaces its value (last writer wins). Every queued write gets a ticket,
+    and `queuedWriteStatus()` returns the status of the request which carried it.
+
+    Transaction groups:
+    `beginGroup()` seizes the port for the client until `endGroup()` is called (or the client makes no request
+    during `groupTimeout()`, is destroyed or its request is cancelled). Requests of the client
+    within the group are processed one after another without re-arbitration, requests of other clients
+    are blocked (`Status_Processing` is returned to them), so multi-step interactions (e.g. select page
+    register then read page) can not be interleaved.
+
     Resource sharing mechanism:
     The port maintains a queue of client requests. When a client calls a function, it
     checks if the port is available using getRequestStatus(). If available (Enable status),
@@ -118,12 +172,81 @@ public:
         Process
     };
 
+    /*! \brief Optional features of the remote unit used by the client port to reduce count of requests.
+     */
+    enum UnitCapability
+    {
+        CapabilityNone                        = 0x00, ///< No optional features
+        CapabilityReadWriteMultipleRegisters  = 0x01  ///< Unit supports FC23, queued register writes are sent together with `readHoldingRegisters()`
+    };
+
+    /*! \brief State of the circuit breaker of the remote unit.
+     */
+    enum CircuitState
+    {
+        CircuitClosed  , ///< Unit is online, requests are passed to the bus
+        CircuitOpen    , ///< Unit is offline, requests are rejected with `Status_BadUnitOffline`
+        CircuitHalfOpen  ///< Unit is offline, single probe request is passed to the bus
+    };
+
+    /*! \brief Response statistics and health state of the remote unit collected by the client port.
+     */
+    struct UnitStatistics
+    {
+        uint32_t requests           ; ///< Count of completed requests to the unit (broadcast requests are not counted)
+        uint32_t responses          ; ///< Count of requests the unit has responded to (including Modbus-exception responses)
+        uint32_t failures           ; ///< Count of requests the unit has not responded to (timeout) or responded with corrupted or not matching response
+        uint32_t consecutiveFailures; ///< Count of consecutive failed requests
+        uint32_t skipped            ; ///< Count of requests rejected by the bus scheduler while the unit is offline
+        uint32_t lastResponseTimeUs ; ///< Response time of the last answered request (in microseconds)
+        uint32_t minResponseTimeUs  ; ///< Minimum response time (in microseconds)
+        uint32_t maxResponseTimeUs  ; ///< Maximum response time (in microseconds)
+        uint32_t avgResponseTimeUs  ; ///< Average response time (in microseconds)
+        bool     offline            ; ///< `true` if the unit is considered offline by the bus scheduler
+        CircuitState circuitState   ; ///< Current state of the circuit breaker of the unit
+    };
+
+    /*! \brief Round-trip time estimate of the unit used for adaptive timeout.
+     */
+    struct RttEstimate
+    {
+        uint32_t srttUs  ; ///< Smoothed round-trip time (in microseconds)
+        uint32_t rttvarUs; ///< Round-trip time variation (in microseconds)
+        uint32_t timeout ; ///< Current timeout for the unit (in milliseconds)
+        uint32_t samples ; ///< Count of round-trip time samples
+    };
+
+    /*! \brief Options applied to every request of the client (see `setRequestOptions()`).
+     */
+    struct RequestOptions
+    {
+        uint32_t timeout ; ///< Response timeout of every try (in milliseconds), 0 - port (or adaptive) timeout is used
+        uint32_t deadline; ///< Maximum time of the request including all tries (in milliseconds), 0 - no deadline
+    };
+
+    /*! \brief Occupancy statistics of the line (bus) used by the client port.
+     */
+    struct BusStatistics
+    {
+        uint64_t elapsedUs; ///< Time since statistics were reset (in microseconds)
+        uint64_t busyUs   ; ///< Time the bus was held by request/response exchanges, including waiting for response (in microseconds)
+        uint64_t trafficUs; ///< Time of transmitted and received characters including t3.5 gaps (in microseconds, serial ports only)
+        uint32_t txBytes  ; ///< Count of transmitted bytes (ADU)
+        uint32_t rxBytes  ; ///< Count of received bytes (ADU)
+        uint32_t transactions; ///< Count of completed request/response exchanges
+        uint32_t syscalls    ; ///< Count of system calls made by the port during exchanges (see `ModbusPort::syscallCount()`)
+    };
+
 public:
     /// \details Constructor of the class.
     /// \param[in]  port A pointer to the port object which belongs to this client object.
     /// Lifecycle of the `port` object is managed by this `ModbusClientPort`-object
     ModbusClientPort(ModbusPort *port);
 
+    /// \details Destructor of the class. `ModbusClient` objects attached to the port are detached,
+    /// so they can be destroyed after the port.
+    ~ModbusClientPort();
+
 public:
     /// \details Returns type of Modbus protocol.
     Modbus::ProtocolType type() const;
@@ -161,6 +284,109 @@ public:
     /// \sa `isBroadcastEnabled()`
     void setBroadcastEnabled(bool enable);
 
+    /// \details Returns `true` if bus scheduler (skipping and probing of offline units) is enabled, `false` otherwise (default).
+    bool isBusSchedulerEnabled() const;
+
+    /// \details Enables/disables bus scheduler. When disabled, unit statistics are still collected but units are never skipped.
+    void setBusSchedulerEnabled(bool enable);
+
+    /// \details Returns count of consecutive requests without response after which unit is considered offline (default is 2).
+    uint32_t unitOfflineThreshold() const;
+
+    /// \details Sets count of consecutive requests without response after which unit is considered offline.
+    void setUnitOfflineThreshold(uint32_t count);
+
+    /// \details Returns initial interval (in milliseconds) between probe requests to the offline unit (default is 1000).
+    uint32_t unitProbeInterval() const;
+
+    /// \details Sets initial interval (in milliseconds) between probe requests to the offline unit.
+    void setUnitProbeInterval(uint32_t interval);
+
+    /// \details Returns maximum interval (in milliseconds) between probe requests to the offline unit (default is 60000).
+    uint32_t unitProbeIntervalMax() const;
+
+    /// \details Sets maximum interval (in milliseconds) between probe requests to the offline unit.
+    void setUnitProbeIntervalMax(uint32_t interval);
+
+    /// \details Returns random deviation (in percent) of the probe interval (default is 20).
+    /// Jitter prevents probes of several offline units from being synchronized.
+    uint32_t unitProbeJitter() const;
+
+    /// \details Sets random deviation (in percent, 0-100) of the probe interval.
+    void setUnitProbeJitter(uint32_t percent);
+
+    /// \details Returns current state of the circuit breaker of the `unit`.
+    CircuitState unitCircuitState(uint8_t unit) const;
+
+    /// \details Returns `true` if `unit` is considered offline by the bus scheduler.
+    bool isUnitOffline(uint8_t unit) const;
+
+    /// \details Copies statistics of `unit` into `stats`. Returns `false` if there were no requests to the `unit`.
+    bool unitStatistics(uint8_t unit, UnitStatistics *stats) const;
+
+    /// \details Clears statistics and health state of all units.
+    void resetUnitStatistics();
+
+    /// \details Returns occupancy statistics of the bus.
+    BusStatistics busStatistics() const;
+
+    /// \details Returns bus utilization: ratio of time of characters on the line to elapsed time (0.0 - 1.0, serial ports only).
+    double busUtilization() const;
+
+    /// \details Returns average count of system calls made by the port per request/response exchange
+    /// (0 if there were no exchanges or the port doesn't count system calls).
+    double syscallsPerTransaction() const;
+
+    /// \details Clears bus occupancy statistics.
+    void resetBusStatistics();
+
+    /// \details Returns `true` if adaptive (measured round-trip time based) timeout is enabled, `false` otherwise (default).
+    bool isAdaptiveTimeoutEnabled() const;
+
+    /// \details Enables/disables adaptive timeout. When enabled the client port controls `ModbusPort::timeout()`,
+    /// when disabled the port timeout is restored to the value it had before adaptive timeout was enabled.
+    void setAdaptiveTimeoutEnabled(bool enable);
+
+    /// \details Returns lower bound of the adaptive timeout (in milliseconds, default is 10).
+    uint32_t adaptiveTimeoutMin() const;
+
+    /// \details Sets lower bound of the adaptive timeout (in milliseconds).
+    void setAdaptiveTimeoutMin(uint32_t timeout);
+
+    /// \details Returns upper bound of the adaptive timeout (in milliseconds).
+    /// Default is 0 which means port timeout at the moment adaptive timeout was enabled.
+    /// The upper bound is also used for units with no round-trip time samples.
+    uint32_t adaptiveTimeoutMax() const;
+
+    /// \details Sets upper bound of the adaptive timeout (in milliseconds).
+    void setAdaptiveTimeoutMax(uint32_t timeout);
+
+    /// \details Returns factor `k` for round-trip time variation in `timeout = SRTT + k*RTTVAR` (default is 4).
+    uint32_t adaptiveTimeoutFactor() const;
+
+    /// \details Sets factor `k` for round-trip time variation in `timeout = SRTT + k*RTTVAR`.
+    void setAdaptiveTimeoutFactor(uint32_t k);
+
+    /// \details Returns `true` if round-trip time is estimated for every pair of unit and function,
+    /// `false` if it is estimated for every unit only (default).
+    bool isAdaptiveTimeoutPerFunction() const;
+
+    /// \details Enables/disables round-trip time estimation for every pair of unit and function.
+    /// Clears all collected estimates.
+    void setAdaptiveTimeoutPerFunction(bool enable);
+
+    /// \details Copies round-trip time estimate for `unit` (and `func` if estimation per function is enabled) into `rtt`.
+    /// Returns `false` if there is no estimate.
+    bool rttEstimate(uint8_t unit, uint8_t func, RttEstimate *rtt) const;
+
+public: // request options
+    /// \details Returns request options of the `client` (all zeros if options are not set).
+    RequestOptions requestOptions(const ModbusObject *client) const;
+
+    /// \details Sets options for the next requests of the `client`. Options with all zero fields are removed.
+    /// Requests made by functions without `client` parameter belong to the port itself (`this`).
+    void setRequestOptions(const ModbusObject *client, const RequestOptions &options);
+
 public: // Main interface
 
 #ifndef MBF_READ_COILS_DISABLE
@@ -254,6 +480,9 @@ public: // Main interface
 #endif // MBF_DIAGNOSTICS_RETURN_DIAGNOSTIC_REGISTER_DISABLE
 
 #ifndef MBF_DIAGNOSTICS_CHANGE_ASCII_INPUT_DELIMITER_DISABLE
+    /// \details Sends FC08/03 request. If request is successful and current port uses ASCII framing
+    /// then port's ASCII input delimiter is changed to `delimiter` too.
+    /// \sa `ModbusAscPort::setAsciiInputDelimiter()`
     Modbus::StatusCode diagnosticsChangeAsciiInputDelimiter(uint8_t unit, char delimiter) override;
 
     /// \details Same as `ModbusClientPort::diagnosticsChangeAsciiInputDelimiter(uint8_t unit, char delimiter)` but has `client` as first parameter to seize current `ModbusClientPort` resource.
@@ -428,6 +657,127 @@ public: // Main interface
 
 #endif // MBF_ENCAPSULATED_INTERFACE_TRANSPORT_DISABLE
 
+public: // write coalescing
+    /// \details Returns time window (in milliseconds) to collect queued writes before `processWrites()` sends them.
+    /// Default is 0 (queued writes are sent by the next `processWrites()` call).
+    uint32_t writeCoalescingWindow() const;
+
+    /// \details Sets time window (in milliseconds) to collect queued writes before `processWrites()` sends them.
+    void setWriteCoalescingWindow(uint32_t window);
+
+    /// \details Returns count of queued addresses which are not sent yet (address written several times within one merged request is counted once).
+    uint32_t queuedWriteCount() const;
+
+    /// \details Returns status of the queued write with `ticket`: `Status_Processing` while it is pending or in progress,
+    /// the status of the request which carried it when completed or `Status_Uncertain` if `ticket` is unknown.
+    Modbus::StatusCode queuedWriteStatus(uint32_t ticket) const;
+
+#ifndef MBF_WRITE_MULTIPLE_COILS_DISABLE
+    /// \details Puts coil `value` with `offset` of the `unit` into the write queue. Returns ticket of the write.
+    uint32_t queueWriteSingleCoil(uint8_t unit, uint16_t offset, bool value);
+#endif // MBF_WRITE_MULTIPLE_COILS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+    /// \details Puts register `value` with `offset` of the `unit` into the write queue. Returns ticket of the write.
+    uint32_t queueWriteSingleRegister(uint8_t unit, uint16_t offset, uint16_t value);
+#endif // MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+
+    /// \details Sends all queued writes as merged requests one after another.
+    /// Returns `Status_Processing` while in progress, then `Status_Good` or the first bad status of the merged requests.
+    inline Modbus::StatusCode flushWrites() { return flushWrites(this); }
+
+    /// \details Same as `flushWrites()` but has `client` as first parameter to seize current `ModbusClientPort` resource.
+    Modbus::StatusCode flushWrites(ModbusObject *client);
+
+    /// \details Same as `flushWrites()` but sends queued writes only when `writeCoalescingWindow()` is elapsed
+    /// since the oldest of them was queued. Returns `Status_Good` if there is nothing to send yet.
+    inline Modbus::StatusCode processWrites() { return processWrites(this); }
+
+    /// \details Same as `processWrites()` but has `client` as first parameter to seize current `ModbusClientPort` resource.
+    Modbus::StatusCode processWrites(ModbusObject *client);
+
+public: // range requests
+    /// \details Returns maximum count of registers in one request of range functions for the `unit`.
+    /// Default is 0 which means maximum by Modbus specification (125 to read, 123 to write).
+    uint16_t unitMaxRegisters(uint8_t unit) const;
+
+    /// \details Sets maximum count of registers in one request of range functions for the `unit`.
+    void setUnitMaxRegisters(uint8_t unit, uint16_t count);
+
+    /// \details Returns maximum count of discretes (coils, inputs) in one request of range functions for the `unit`.
+    /// Default is 0 which means maximum by Modbus specification (2000 to read, 1968 to write).
+    /// The value is rounded down to multiple of 8, so every chunk begins from the byte boundary of the values buffer.
+    uint16_t unitMaxDiscrets(uint8_t unit) const;
+
+    /// \details Sets maximum count of discretes (coils, inputs) in one request of range functions for the `unit`.
+    void setUnitMaxDiscrets(uint8_t unit, uint16_t count);
+
+    /// \details Returns capabilities of the `unit` (combination of `UnitCapability` flags). Default is `CapabilityNone`.
+    uint32_t unitCapabilities(uint8_t unit) const;
+
+    /// \details Sets capabilities of the `unit` (combination of `UnitCapability` flags).
+    /// If `CapabilityReadWriteMultipleRegisters` is set, `readHoldingRegisters()` of the `unit` takes
+    /// pending queued register writes of the same unit (see "Write coalescing") and sends them
+    /// with the read as one `readWriteMultipleRegisters()` request. If the unit answers
+    /// with `Status_BadIllegalFunction` the flag is cleared, the taken writes are sent first
+    /// and then registers are read by the usual request.
+    void setUnitCapabilities(uint8_t unit, uint32_t capabilities);
+
+    /// \details Returns count of requests (chunks) of the last range function.
+    uint16_t lastRangeChunkCount() const;
+
+    /// \details Returns status of the `chunk` request of the last range function.
+    /// `Status_Uncertain` is returned for chunk which was not processed.
+    Modbus::StatusCode lastRangeChunkStatus(uint16_t chunk) const;
+
+#ifndef MBF_READ_COILS_DISABLE
+    /// \details Same as `readCoils()` but `count` is not limited by one request (see "Range requests").
+    inline Modbus::StatusCode readCoilsRange(uint8_t unit, uint16_t offset, uint16_t count, void *values) { return readCoilsRange(this, unit, offset, count, values); }
+
+    /// \details Same as `readCoilsRange(uint8_t unit, uint16_t offset, uint16_t count, void *values)` but has `client` as first parameter to seize current `ModbusClientPort` resource.
+    Modbus::StatusCode readCoilsRange(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, void *values);
+#endif // MBF_READ_COILS_DISABLE
+
+#ifndef MBF_READ_DISCRETE_INPUTS_DISABLE
+    /// \details Same as `readDiscreteInputs()` but `count` is not limited by one request (see "Range requests").
+    inline Modbus::StatusCode readDiscreteInputsRange(uint8_t unit, uint16_t offset, uint16_t count, void *values) { return readDiscreteInputsRange(this, unit, offset, count, values); }
+
+    /// \details Same as `readDiscreteInputsRange(uint8_t unit, uint16_t offset, uint16_t count, void *values)` but has `client` as first parameter to seize current `ModbusClientPort` resource.
+    Modbus::StatusCode readDiscreteInputsRange(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, void *values);
+#endif // MBF_READ_DISCRETE_INPUTS_DISABLE
+
+#ifndef MBF_READ_HOLDING_REGISTERS_DISABLE
+    /// \details Same as `readHoldingRegisters()` but `count` is not limited by one request (see "Range requests").
+    inline Modbus::StatusCode readHoldingRegistersRange(uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values) { return readHoldingRegistersRange(this, unit, offset, count, values); }
+
+    /// \details Same as `readHoldingRegistersRange(uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values)` but has `client` as first parameter to seize current `ModbusClientPort` resource.
+    Modbus::StatusCode readHoldingRegistersRange(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values);
+#endif // MBF_READ_HOLDING_REGISTERS_DISABLE
+
+#ifndef MBF_READ_INPUT_REGISTERS_DISABLE
+    /// \details Same as `readInputRegisters()` but `count` is not limited by one request (see "Range requests").
+    inline Modbus::StatusCode readInputRegistersRange(uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values) { return readInputRegistersRange(this, unit, offset, count, values); }
+
+    /// \details Same as `readInputRegistersRange(uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values)` but has `client` as first parameter to seize current `ModbusClientPort` resource.
+    Modbus::StatusCode readInputRegistersRange(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values);
+#endif // MBF_READ_INPUT_REGISTERS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_COILS_DISABLE
+    /// \details Same as `writeMultipleCoils()` but `count` is not limited by one request (see "Range requests").
+    inline Modbus::StatusCode writeMultipleCoilsRange(uint8_t unit, uint16_t offset, uint16_t count, const void *values) { return writeMultipleCoilsRange(this, unit, offset, count, values); }
+
+    /// \details Same as `writeMultipleCoilsRange(uint8_t unit, uint16_t offset, uint16_t count, const void *values)` but has `client` as first parameter to seize current `ModbusClientPort` resource.
+    Modbus::StatusCode writeMultipleCoilsRange(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, const void *values);
+#endif // MBF_WRITE_MULTIPLE_COILS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+    /// \details Same as `writeMultipleRegisters()` but `count` is not limited by one request (see "Range requests").
+    inline Modbus::StatusCode writeMultipleRegistersRange(uint8_t unit, uint16_t offset, uint16_t count, const uint16_t *values) { return writeMultipleRegistersRange(this, unit, offset, count, values); }
+
+    /// \details Same as `writeMultipleRegistersRange(uint8_t unit, uint16_t offset, uint16_t count, const uint16_t *values)` but has `client` as first parameter to seize current `ModbusClientPort` resource.
+    Modbus::StatusCode writeMultipleRegistersRange(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, const uint16_t *values);
+#endif // MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+
 public:
     /// \details Returns the status of the last operation performed.
     Modbus::StatusCode lastStatus() const;
@@ -459,8 +809,32 @@ public:
     RequestStatus getRequestStatus(ModbusObject *client);
 
     /// \details Cancels the previous request specified by the `*rp` pointer for the client.
+    /// If the request of the `client` is in progress it is abandoned: write buffer is released and the next request
+    /// starts a new transaction, so late response to the abandoned request is dropped by the port
+    /// (see `ModbusTcpPort::staleResponseCount()`). Transaction group of the `client` is ended too.
     void cancelRequest(ModbusObject *client);
 
+    /// \details Begins transaction group of the `client`: the port is held by the `client` until `endGroup()`
+    /// or `cancelRequest()` is called, or the `client` makes no request during `groupTimeout()`.
+    /// Returns `Status_Good` if the port is seized (or already held by this `client`) and `Status_Processing`
+    /// if the port is busy by other client, so the function must be called again later.
+    Modbus::StatusCode beginGroup(ModbusObject *client);
+
+    /// \details Ends transaction group of the `client` and releases the port for other clients.
+    /// Request of the `client` which is in progress is not affected.
+    void endGroup(ModbusObject *client);
+
+    /// \details Returns a pointer to the client object which holds the port by transaction group or `nullptr` if there is no group.
+    const ModbusObject *groupClient() const;
+
+    /// \details Returns time (in milliseconds) after the last request of the transaction group client
+    /// when the group is released automatically. Default is 10000, 0 means no limit.
+    uint32_t groupTimeout() const;
+
+    /// \details Sets time (in milliseconds) after the last request of the transaction group client
+    /// when the group is released automatically (e.g. the client forgot to call `endGroup()`).
+    void setGroupTimeout(uint32_t timeout);
+
     /// \details Make raw request to the server.
     /// \param[in]  inBuff    Pointer to the input buffer to write.
     /// \param[in]  szInBuff  Size of input buffer.
@@ -488,9 +862,17 @@ public: // SIGNALS
     /// \details Calls each callback of the port when operation is completed.
     void signalCompleted(const Modbus::Char *source, Modbus::StatusCode status);
 
+    /// \details Calls each callback of the port when state of the circuit breaker of the `unit` is changed.
+    void signalUnitStateChanged(const Modbus::Char *source, uint8_t unit, ModbusClientPort::CircuitState state);
+
 private:
     Modbus::StatusCode request(uint8_t unit, uint8_t func, const uint8_t *inBuff, uint16_t szInBuff, uint8_t *outBuff, uint16_t maxSzBuff, uint16_t *szOutBuff);
     Modbus::StatusCode process();
+    Modbus::StatusCode rangeRequest(ModbusObject *client, uint8_t unit, uint8_t func, uint16_t offset, uint16_t count, void *values);
+    Modbus::StatusCode readHoldingRegistersFused(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values);
+    Modbus::StatusCode rangeChunk(ModbusObject *client, uint8_t unit, uint8_t func, uint16_t offset, uint16_t count, void *values);
+    void attachClient(ModbusClient *client);
+    void detachClient(ModbusClient *client);
     friend class ModbusClient;
 };
 
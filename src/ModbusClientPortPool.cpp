@@ -0,0 +1,706 @@
+#include "ModbusClientPortPool.h"
+#include "ModbusClientPortPool_p.h"
+
+#include "ModbusClientPort.h"
+#include "ModbusPort.h"
+
+using namespace Modbus;
+
+static inline ModbusClientPortPoolPrivate *d_cast(ModbusObjectPrivate *d_ptr) { return static_cast<ModbusClientPortPoolPrivate*>(d_ptr); }
+
+ModbusClientPortPool::ModbusClientPortPool() :
+    ModbusObject(new ModbusClientPortPoolPrivate())
+{
+}
+
+ModbusClientPortPool::~ModbusClientPortPool()
+{
+    ModbusClientPortPoolPrivate *d = d_cast(d_ptr);
+    for (PoolMember &m : d->members)
+        delete m.port;
+}
+
+int ModbusClientPortPool::addPort(ModbusPort *port)
+{
+    ModbusClientPortPoolPrivate *d = d_cast(d_ptr);
+    PoolMember m;
+    m.port = new ModbusClientPort(port);
+    m.outstanding = 0;
+    d->members.push_back(m);
+    return static_cast<int>(d->members.size()) - 1;
+}
+
+int ModbusClientPortPool::memberCount() const
+{
+    return static_cast<int>(d_cast(d_ptr)->members.size());
+}
+
+ModbusClientPort *ModbusClientPortPool::member(int i) const
+{
+    ModbusClientPortPoolPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(i))
+        return nullptr;
+    return d->members[i].port;
+}
+
+uint32_t ModbusClientPortPool::outstandingCount(int i) const
+{
+    ModbusClientPortPoolPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(i))
+        return 0;
+    return d->members[i].outstanding;
+}
+
+int ModbusClientPortPool::openCount() const
+{
+    ModbusClientPortPoolPrivate *d = d_cast(d_ptr);
+    int c = 0;
+    for (const PoolMember &m : d->members)
+    {
+        if (m.port->isOpen())
+            ++c;
+    }
+    return c;
+}
+
+StatusCode ModbusClientPortPool::open()
+{
+    ModbusClientPortPoolPrivate *d = d_cast(d_ptr);
+    StatusCode res = Status_Good;
+    for (PoolMember &m : d->members)
+    {
+        // Note: busy member opens its connection itself as part of the request
+        if (m.outstanding || m.port->isOpen())
+            continue;
+        StatusCode r = m.port->port()->open();
+        if (r == Status_Processing)
+        {
+            if (!StatusIsBad(res))
+                res = r;
+        }
+        else if (StatusIsBad(r))
+            res = r;
+    }
+    return res;
+}
+
+StatusCode ModbusClientPortPool::close()
+{
+    ModbusClientPortPoolPrivate *d = d_cast(d_ptr);
+    StatusCode res = Status_Good;
+    for (PoolMember &m : d->members)
+    {
+        StatusCode r = m.port->close();
+        if (StatusIsBad(r))
+            res = r;
+    }
+    return res;
+}
+
+void ModbusClientPortPool::cancelRequest(ModbusObject *client)
+{
+    ModbusClientPortPoolPrivate *d = d_cast(d_ptr);
+    auto it = d->bindings.find(client);
+    if (it == d->bindings.end())
+        return;
+    PoolMember &m = d->members[it->second];
+    m.port->cancelRequest(client);
+    --m.outstanding;
+    d->bindings.erase(it);
+}
+
+ModbusClientPort *ModbusClientPortPool::boundMember(const ModbusObject *client) const
+{
+    ModbusClientPortPoolPrivate *d = d_cast(d_ptr);
+    auto it = d->bindings.find(const_cast<ModbusObject*>(client));
+    if (it == d->bindings.end())
+        return nullptr;
+    return d->members[it->second].port;
+}
+
+ModbusClientPort *ModbusClientPortPool::acquire(ModbusObject *client)
+{
+    ModbusClientPortPoolPrivate *d = d_cast(d_ptr);
+    auto it = d->bindings.find(client);
+    if (it != d->bindings.end())
+        return d->members[it->second].port;
+    if (d->members.empty())
+        return nullptr;
+    int i = d->leastOutstanding();
+    PoolMember &m = d->members[i];
+    ++m.outstanding;
+    d->bindings[client] = i;
+    return m.port;
+}
+
+StatusCode ModbusClientPortPool::release(ModbusObject *client, StatusCode status)
+{
+    if (status == Status_Processing)
+        return status;
+    ModbusClientPortPoolPrivate *d = d_cast(d_ptr);
+    auto it = d->bindings.find(client);
+    if (it != d->bindings.end())
+    {
+        --d->members[it->second].outstanding;
+        d->bindings.erase(it);
+    }
+    return status;
+}
+
+#ifndef MBF_READ_COILS_DISABLE
+StatusCode ModbusClientPortPool::readCoils(uint8_t unit, uint16_t offset, uint16_t count, void *values)
+{
+    return readCoils(this, unit, offset, count, values);
+}
+
+StatusCode ModbusClientPortPool::readCoils(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, void *values)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->readCoils(client, unit, offset, count, values));
+}
+
+StatusCode ModbusClientPortPool::readCoilsAsBoolArray(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, bool *values)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->readCoilsAsBoolArray(client, unit, offset, count, values));
+}
+
+#endif // MBF_READ_COILS_DISABLE
+
+#ifndef MBF_READ_DISCRETE_INPUTS_DISABLE
+StatusCode ModbusClientPortPool::readDiscreteInputs(uint8_t unit, uint16_t offset, uint16_t count, void *values)
+{
+    return readDiscreteInputs(this, unit, offset, count, values);
+}
+
+StatusCode ModbusClientPortPool::readDiscreteInputs(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, void *values)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->readDiscreteInputs(client, unit, offset, count, values));
+}
+
+StatusCode ModbusClientPortPool::readDiscreteInputsAsBoolArray(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, bool *values)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->readDiscreteInputsAsBoolArray(client, unit, offset, count, values));
+}
+
+#endif // MBF_READ_DISCRETE_INPUTS_DISABLE
+
+#ifndef MBF_READ_HOLDING_REGISTERS_DISABLE
+StatusCode ModbusClientPortPool::readHoldingRegisters(uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values)
+{
+    return readHoldingRegisters(this, unit, offset, count, values);
+}
+
+StatusCode ModbusClientPortPool::readHoldingRegisters(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->readHoldingRegisters(client, unit, offset, count, values));
+}
+
+#endif // MBF_READ_HOLDING_REGISTERS_DISABLE
+
+#ifndef MBF_READ_INPUT_REGISTERS_DISABLE
+StatusCode ModbusClientPortPool::readInputRegisters(uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values)
+{
+    return readInputRegisters(this, unit, offset, count, values);
+}
+
+StatusCode ModbusClientPortPool::readInputRegisters(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->readInputRegisters(client, unit, offset, count, values));
+}
+
+#endif // MBF_READ_INPUT_REGISTERS_DISABLE
+
+#ifndef MBF_WRITE_SINGLE_COIL_DISABLE
+StatusCode ModbusClientPortPool::writeSingleCoil(uint8_t unit, uint16_t offset, bool value)
+{
+    return writeSingleCoil(this, unit, offset, value);
+}
+
+StatusCode ModbusClientPortPool::writeSingleCoil(ModbusObject *client, uint8_t unit, uint16_t offset, bool value)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->writeSingleCoil(client, unit, offset, value));
+}
+
+#endif // MBF_WRITE_SINGLE_COIL_DISABLE
+
+#ifndef MBF_WRITE_SINGLE_REGISTER_DISABLE
+StatusCode ModbusClientPortPool::writeSingleRegister(uint8_t unit, uint16_t offset, uint16_t value)
+{
+    return writeSingleRegister(this, unit, offset, value);
+}
+
+StatusCode ModbusClientPortPool::writeSingleRegister(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t value)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->writeSingleRegister(client, unit, offset, value));
+}
+
+#endif // MBF_WRITE_SINGLE_REGISTER_DISABLE
+
+#ifndef MBF_READ_EXCEPTION_STATUS_DISABLE
+StatusCode ModbusClientPortPool::readExceptionStatus(uint8_t unit, uint8_t *value)
+{
+    return readExceptionStatus(this, unit, value);
+}
+
+StatusCode ModbusClientPortPool::readExceptionStatus(ModbusObject *client, uint8_t unit, uint8_t *value)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->readExceptionStatus(client, unit, value));
+}
+
+#endif // MBF_READ_EXCEPTION_STATUS_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_DISABLE
+#ifndef MBF_DIAGNOSTICS_RETURN_QUERY_DATA_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsReturnQueryData(uint8_t unit, const void *indata, uint8_t insize, void *outdata, uint8_t *outsize)
+{
+    return diagnosticsReturnQueryData(this, unit, indata, insize, outdata, outsize);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsReturnQueryData(ModbusObject *client, uint8_t unit, const void *indata, uint8_t insize, void *outdata, uint8_t *outsize)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsReturnQueryData(client, unit, indata, insize, outdata, outsize));
+}
+
+#endif // MBF_DIAGNOSTICS_RETURN_QUERY_DATA_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RESTART_COMMUNICATIONS_OPTION_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsRestartCommunicationsOption(uint8_t unit, bool clearEventLog)
+{
+    return diagnosticsRestartCommunicationsOption(this, unit, clearEventLog);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsRestartCommunicationsOption(ModbusObject *client, uint8_t unit, bool clearEventLog)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsRestartCommunicationsOption(client, unit, clearEventLog));
+}
+
+#endif // MBF_DIAGNOSTICS_RESTART_COMMUNICATIONS_OPTION_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_DIAGNOSTIC_REGISTER_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsReturnDiagnosticRegister(uint8_t unit, uint16_t *value)
+{
+    return diagnosticsReturnDiagnosticRegister(this, unit, value);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsReturnDiagnosticRegister(ModbusObject *client, uint8_t unit, uint16_t *value)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsReturnDiagnosticRegister(client, unit, value));
+}
+
+#endif // MBF_DIAGNOSTICS_RETURN_DIAGNOSTIC_REGISTER_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_CHANGE_ASCII_INPUT_DELIMITER_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsChangeAsciiInputDelimiter(uint8_t unit, char delimiter)
+{
+    return diagnosticsChangeAsciiInputDelimiter(this, unit, delimiter);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsChangeAsciiInputDelimiter(ModbusObject *client, uint8_t unit, char delimiter)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsChangeAsciiInputDelimiter(client, unit, delimiter));
+}
+
+#endif // MBF_DIAGNOSTICS_CHANGE_ASCII_INPUT_DELIMITER_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_FORCE_LISTEN_ONLY_MODE_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsForceListenOnlyMode(uint8_t unit)
+{
+    return diagnosticsForceListenOnlyMode(this, unit);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsForceListenOnlyMode(ModbusObject *client, uint8_t unit)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsForceListenOnlyMode(client, unit));
+}
+
+#endif // MBF_DIAGNOSTICS_FORCE_LISTEN_ONLY_MODE_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_CLEAR_COUNTERS_AND_DIAGNOSTIC_REGISTER_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsClearCountersAndDiagnosticRegister(uint8_t unit)
+{
+    return diagnosticsClearCountersAndDiagnosticRegister(this, unit);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsClearCountersAndDiagnosticRegister(ModbusObject *client, uint8_t unit)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsClearCountersAndDiagnosticRegister(client, unit));
+}
+
+#endif // MBF_DIAGNOSTICS_CLEAR_COUNTERS_AND_DIAGNOSTIC_REGISTER_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_BUS_MESSAGE_COUNT_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsReturnBusMessageCount(uint8_t unit, uint16_t *count)
+{
+    return diagnosticsReturnBusMessageCount(this, unit, count);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsReturnBusMessageCount(ModbusObject *client, uint8_t unit, uint16_t *count)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsReturnBusMessageCount(client, unit, count));
+}
+
+#endif // MBF_DIAGNOSTICS_RETURN_BUS_MESSAGE_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_BUS_COMMUNICATION_ERROR_COUNT_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsReturnBusCommunicationErrorCount(uint8_t unit, uint16_t *count)
+{
+    return diagnosticsReturnBusCommunicationErrorCount(this, unit, count);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsReturnBusCommunicationErrorCount(ModbusObject *client, uint8_t unit, uint16_t *count)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsReturnBusCommunicationErrorCount(client, unit, count));
+}
+
+#endif // MBF_DIAGNOSTICS_RETURN_BUS_COMMUNICATION_ERROR_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_BUS_EXCEPTION_ERROR_COUNT_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsReturnBusExceptionErrorCount(uint8_t unit, uint16_t *count)
+{
+    return diagnosticsReturnBusExceptionErrorCount(this, unit, count);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsReturnBusExceptionErrorCount(ModbusObject *client, uint8_t unit, uint16_t *count)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsReturnBusExceptionErrorCount(client, unit, count));
+}
+
+#endif // MBF_DIAGNOSTICS_RETURN_BUS_EXCEPTION_ERROR_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_SERVER_MESSAGE_COUNT_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsReturnServerMessageCount(uint8_t unit, uint16_t *count)
+{
+    return diagnosticsReturnServerMessageCount(this, unit, count);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsReturnServerMessageCount(ModbusObject *client, uint8_t unit, uint16_t *count)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsReturnServerMessageCount(client, unit, count));
+}
+
+#endif // MBF_DIAGNOSTICS_RETURN_SERVER_MESSAGE_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_SERVER_NO_RESPONSE_COUNT_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsReturnServerNoResponseCount(uint8_t unit, uint16_t *count)
+{
+    return diagnosticsReturnServerNoResponseCount(this, unit, count);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsReturnServerNoResponseCount(ModbusObject *client, uint8_t unit, uint16_t *count)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsReturnServerNoResponseCount(client, unit, count));
+}
+
+#endif // MBF_DIAGNOSTICS_RETURN_SERVER_NO_RESPONSE_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_SERVER_NAK_COUNT_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsReturnServerNAKCount(uint8_t unit, uint16_t *count)
+{
+    return diagnosticsReturnServerNAKCount(this, unit, count);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsReturnServerNAKCount(ModbusObject *client, uint8_t unit, uint16_t *count)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsReturnServerNAKCount(client, unit, count));
+}
+
+#endif // MBF_DIAGNOSTICS_RETURN_SERVER_NAK_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_SERVER_BUSY_COUNT_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsReturnServerBusyCount(uint8_t unit, uint16_t *count)
+{
+    return diagnosticsReturnServerBusyCount(this, unit, count);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsReturnServerBusyCount(ModbusObject *client, uint8_t unit, uint16_t *count)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsReturnServerBusyCount(client, unit, count));
+}
+
+#endif // MBF_DIAGNOSTICS_RETURN_SERVER_BUSY_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_SERVER_CHARACTER_OVERRUN_COUNT_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsReturnBusCharacterOverrunCount(uint8_t unit, uint16_t *count)
+{
+    return diagnosticsReturnBusCharacterOverrunCount(this, unit, count);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsReturnBusCharacterOverrunCount(ModbusObject *client, uint8_t unit, uint16_t *count)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsReturnBusCharacterOverrunCount(client, unit, count));
+}
+
+#endif // MBF_DIAGNOSTICS_RETURN_SERVER_CHARACTER_OVERRUN_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_CLEAR_OVERRUN_COUNTER_AND_FLAG_DISABLE
+StatusCode ModbusClientPortPool::diagnosticsClearOverrunCounterAndFlag(uint8_t unit)
+{
+    return diagnosticsClearOverrunCounterAndFlag(this, unit);
+}
+
+StatusCode ModbusClientPortPool::diagnosticsClearOverrunCounterAndFlag(ModbusObject *client, uint8_t unit)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->diagnosticsClearOverrunCounterAndFlag(client, unit));
+}
+
+#endif // MBF_DIAGNOSTICS_CLEAR_OVERRUN_COUNTER_AND_FLAG_DISABLE
+
+#endif // MBF_DIAGNOSTICS_DISABLE
+
+#ifndef MBF_GET_COMM_EVENT_COUNTER_DISABLE
+StatusCode ModbusClientPortPool::getCommEventCounter(uint8_t unit, uint16_t *status, uint16_t *eventCount)
+{
+    return getCommEventCounter(this, unit, status, eventCount);
+}
+
+StatusCode ModbusClientPortPool::getCommEventCounter(ModbusObject *client, uint8_t unit, uint16_t *status, uint16_t *eventCount)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->getCommEventCounter(client, unit, status, eventCount));
+}
+
+#endif // MBF_GET_COMM_EVENT_COUNTER_DISABLE
+
+#ifndef MBF_GET_COMM_EVENT_LOG_DISABLE
+StatusCode ModbusClientPortPool::getCommEventLog(uint8_t unit, uint16_t *status, uint16_t *eventCount, uint16_t *messageCount, void *eventBuff, uint8_t *eventBuffSize)
+{
+    return getCommEventLog(this, unit, status, eventCount, messageCount, eventBuff, eventBuffSize);
+}
+
+StatusCode ModbusClientPortPool::getCommEventLog(ModbusObject *client, uint8_t unit, uint16_t *status, uint16_t *eventCount, uint16_t *messageCount, void *eventBuff, uint8_t *eventBuffSize)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->getCommEventLog(client, unit, status, eventCount, messageCount, eventBuff, eventBuffSize));
+}
+
+#endif // MBF_GET_COMM_EVENT_LOG_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_COILS_DISABLE
+StatusCode ModbusClientPortPool::writeMultipleCoils(uint8_t unit, uint16_t offset, uint16_t count, const void *values)
+{
+    return writeMultipleCoils(this, unit, offset, count, values);
+}
+
+StatusCode ModbusClientPortPool::writeMultipleCoils(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, const void *values)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->writeMultipleCoils(client, unit, offset, count, values));
+}
+
+StatusCode ModbusClientPortPool::writeMultipleCoilsAsBoolArray(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, const bool *values)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->writeMultipleCoilsAsBoolArray(client, unit, offset, count, values));
+}
+
+#endif // MBF_WRITE_MULTIPLE_COILS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+StatusCode ModbusClientPortPool::writeMultipleRegisters(uint8_t unit, uint16_t offset, uint16_t count, const uint16_t *values)
+{
+    return writeMultipleRegisters(this, unit, offset, count, values);
+}
+
+StatusCode ModbusClientPortPool::writeMultipleRegisters(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, const uint16_t *values)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->writeMultipleRegisters(client, unit, offset, count, values));
+}
+
+#endif // MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+
+#ifndef MBF_REPORT_SERVER_ID_DISABLE
+StatusCode ModbusClientPortPool::reportServerID(uint8_t unit, void *data, uint8_t *dataSize)
+{
+    return reportServerID(this, unit, data, dataSize);
+}
+
+StatusCode ModbusClientPortPool::reportServerID(ModbusObject *client, uint8_t unit, void *data, uint8_t *dataSize)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->reportServerID(client, unit, data, dataSize));
+}
+
+#endif // MBF_REPORT_SERVER_ID_DISABLE
+
+#ifndef MBF_READ_FILE_RECORD_DISABLE
+StatusCode ModbusClientPortPool::readFileRecord(uint8_t unit, const Modbus::FileRecord *records, uint8_t recordsCount, void *outData, uint8_t *outSize)
+{
+    return readFileRecord(this, unit, records, recordsCount, outData, outSize);
+}
+
+StatusCode ModbusClientPortPool::readFileRecord(ModbusObject *client, uint8_t unit, const Modbus::FileRecord *records, uint8_t recordsCount, void *outData, uint8_t *outSize)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->readFileRecord(client, unit, records, recordsCount, outData, outSize));
+}
+
+#endif // MBF_READ_FILE_RECORD_DISABLE
+
+#ifndef MBF_WRITE_FILE_RECORD_DISABLE
+StatusCode ModbusClientPortPool::writeFileRecord(uint8_t unit, const Modbus::FileRecord *records, uint8_t recordsCount, const void *inData, uint8_t *inSize)
+{
+    return writeFileRecord(this, unit, records, recordsCount, inData, inSize);
+}
+
+StatusCode ModbusClientPortPool::writeFileRecord(ModbusObject *client, uint8_t unit, const Modbus::FileRecord *records, uint8_t recordsCount, const void *inData, uint8_t *inSize)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->writeFileRecord(client, unit, records, recordsCount, inData, inSize));
+}
+
+#endif // MBF_WRITE_FILE_RECORD_DISABLE
+
+#ifndef MBF_MASK_WRITE_REGISTER_DISABLE
+StatusCode ModbusClientPortPool::maskWriteRegister(uint8_t unit, uint16_t offset, uint16_t andMask, uint16_t orMask)
+{
+    return maskWriteRegister(this, unit, offset, andMask, orMask);
+}
+
+StatusCode ModbusClientPortPool::maskWriteRegister(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t andMask, uint16_t orMask)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->maskWriteRegister(client, unit, offset, andMask, orMask));
+}
+
+#endif // MBF_MASK_WRITE_REGISTER_DISABLE
+
+#ifndef MBF_READ_WRITE_MULTIPLE_REGISTERS_DISABLE
+StatusCode ModbusClientPortPool::readWriteMultipleRegisters(uint8_t unit, uint16_t readOffset, uint16_t readCount, uint16_t *readValues, uint16_t writeOffset, uint16_t writeCount, const uint16_t *writeValues)
+{
+    return readWriteMultipleRegisters(this, unit, readOffset, readCount, readValues, writeOffset, writeCount, writeValues);
+}
+
+StatusCode ModbusClientPortPool::readWriteMultipleRegisters(ModbusObject *client, uint8_t unit, uint16_t readOffset, uint16_t readCount, uint16_t *readValues, uint16_t writeOffset, uint16_t writeCount, const uint16_t *writeValues)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->readWriteMultipleRegisters(client, unit, readOffset, readCount, readValues, writeOffset, writeCount, writeValues));
+}
+
+#endif // MBF_READ_WRITE_MULTIPLE_REGISTERS_DISABLE
+
+#ifndef MBF_READ_FIFO_QUEUE_DISABLE
+StatusCode ModbusClientPortPool::readFIFOQueue(uint8_t unit, uint16_t fifoadr, uint16_t *values, uint16_t *count)
+{
+    return readFIFOQueue(this, unit, fifoadr, values, count);
+}
+
+StatusCode ModbusClientPortPool::readFIFOQueue(ModbusObject *client, uint8_t unit, uint16_t fifoadr, uint16_t *values, uint16_t *count)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->readFIFOQueue(client, unit, fifoadr, values, count));
+}
+
+#endif // MBF_READ_FIFO_QUEUE_DISABLE
+
+#ifndef MBF_ENCAPSULATED_INTERFACE_TRANSPORT_DISABLE
+#ifndef MBF_MEI_READ_DEVICE_IDENTIFICATION_DISABLE
+StatusCode ModbusClientPortPool::readDeviceIdentification(uint8_t unit, uint8_t readDeviceId, uint8_t objectId, void *data, uint8_t *dataSize, uint8_t *numberOfObjects, uint8_t *conformityLevel, bool *moreFollows, uint8_t *nextObjectId)
+{
+    return readDeviceIdentification(this, unit, readDeviceId, objectId, data, dataSize, numberOfObjects, conformityLevel, moreFollows, nextObjectId);
+}
+
+StatusCode ModbusClientPortPool::readDeviceIdentification(ModbusObject *client, uint8_t unit, uint8_t readDeviceId, uint8_t objectId, void *data, uint8_t *dataSize, uint8_t *numberOfObjects, uint8_t *conformityLevel, bool *moreFollows, uint8_t *nextObjectId)
+{
+    ModbusClientPort *m = acquire(client);
+    if (!m)
+        return Status_BadPortClosed;
+    return release(client, m->readDeviceIdentification(client, unit, readDeviceId, objectId, data, dataSize, numberOfObjects, conformityLevel, moreFollows, nextObjectId));
+}
+
+#endif // MBF_MEI_READ_DEVICE_IDENTIFICATION_DISABLE
+
+#endif // MBF_ENCAPSULATED_INTERFACE_TRANSPORT_DISABLE
@@ -0,0 +1,353 @@
+/*!
+ * \file   ModbusClientPortPool.h
+ * \brief  Header file of the pool of client ports connected to the same Modbus server.
+ *
+ * \author serhmarch
+ * \date   October 2026
+ */
+#ifndef MODBUSCLIENTPORTPOOL_H
+#define MODBUSCLIENTPORTPOOL_H
+
+#include "ModbusObject.h"
+
+class ModbusPort;
+class ModbusClientPort;
+
+/*! \brief The `ModbusClientPortPool` class holds several connections to the same server and dispatches requests between them.
+
+    \details Many Modbus/TCP servers process requests of different connections in parallel, but serve every
+    connection strictly serially. One `ModbusClientPort` can have only one outstanding request, so clients that
+    share it wait for each other. `ModbusClientPortPool` owns several `ModbusClientPort` objects (members),
+    each with its own connection (`ModbusPort`) to the same server, and has the same Modbus function interface
+    as `ModbusClientPort` (`ModbusInterface` functions and functions with `client` as first parameter).
+
+    Every request of the `client` is dispatched to the member with the least count of outstanding requests
+    (clients which requests are in progress or wait for the member). Members with an open connection are
+    preferred to closed ones. The `client` stays bound to the member until its request is completed, so in the
+    non-blocking mode requests of different clients are processed by different connections in parallel.
+
+    Every member reconnects independently: a broken connection fails only the requests of its member
+    and is reopened by the next request dispatched to it. `open()` opens connections of all idle members
+    in advance (warm-up), so the first requests don't wait for connection.
+
+    `ModbusInterface` functions of the pool use the pool itself as the client.
+    Settings and signals of the members are available through `member()`.
+
+    The pool is not a `ModbusClientPort`, so it can't be used by `ModbusClient`, `ModbusSubscription`
+    and `ModbusPollScheduler`. Range functions, queued writes, request options and other per-port settings
+    are not available through the pool, they can be used with each member (`member()`) separately.
+
+    \code{.cpp}
+    Modbus::NetSettings settings;
+    settings.host    = "192.168.1.10";
+    settings.port    = 502;
+    settings.timeout = 3000;
+    settings.maxconn = 0;
+    ModbusClientPortPool *pool = Modbus::createClientPortPool(Modbus::TCP, &settings, 4, false);
+    pool->open();
+    ...
+    // every client is served by its own connection
+    pool->readHoldingRegisters(&client1, 1, 0, 10, values1);
+    pool->readHoldingRegisters(&client2, 1, 100, 10, values2);
+    \endcode
+ */
+class MODBUS_EXPORT ModbusClientPortPool : public ModbusObject, public ModbusInterface
+{
+public:
+    /// \details Constructor of the empty pool. Members are added by `addPort()`.
+    ModbusClientPortPool();
+
+    /// \details Destructor of the pool. Deletes all members and their ports.
+    ~ModbusClientPortPool();
+
+public:
+    /// \details Adds new member which uses `port` (the pool takes ownership of the `port`). Returns index of the member.
+    int addPort(ModbusPort *port);
+
+    /// \details Returns count of members.
+    int memberCount() const;
+
+    /// \details Returns member with index `i` or `nullptr` if `i` is out of range.
+    ModbusClientPort *member(int i) const;
+
+    /// \details Returns count of outstanding requests (bound clients) of the member `i`.
+    uint32_t outstandingCount(int i) const;
+
+    /// \details Returns count of members with open connection.
+    int openCount() const;
+
+    /// \details Opens connections of all idle members (warm-up).
+    /// Returns `Status_Processing` while any connection is being opened (non-blocking mode), `Status_Good` when all
+    /// connections are open, and error status of the last failed member otherwise (other members stay usable).
+    Modbus::StatusCode open();
+
+    /// \details Closes connections of all members.
+    Modbus::StatusCode close();
+
+    /// \details Cancels the request of the `client` (if any) and unbinds it from the member.
+    void cancelRequest(ModbusObject *client);
+
+    /// \details Returns member the `client` is bound to or `nullptr` if the `client` has no request in progress.
+    ModbusClientPort *boundMember(const ModbusObject *client) const;
+
+public: // Main interface
+
+#ifndef MBF_READ_COILS_DISABLE
+    Modbus::StatusCode readCoils(uint8_t unit, uint16_t offset, uint16_t count, void *values) override;
+
+    /// \details Same as `ModbusClientPort::readCoils()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode readCoils(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, void *values);
+
+    /// \details Same as `ModbusClientPort::readCoilsAsBoolArray()`.
+    inline Modbus::StatusCode readCoilsAsBoolArray(uint8_t unit, uint16_t offset, uint16_t count, bool *values) { return readCoilsAsBoolArray(this, unit, offset, count, values); }
+
+    /// \details Same as `ModbusClientPort::readCoilsAsBoolArray()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode readCoilsAsBoolArray(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, bool *values);
+#endif // MBF_READ_COILS_DISABLE
+
+#ifndef MBF_READ_DISCRETE_INPUTS_DISABLE
+    Modbus::StatusCode readDiscreteInputs(uint8_t unit, uint16_t offset, uint16_t count, void *values) override;
+
+    /// \details Same as `ModbusClientPort::readDiscreteInputs()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode readDiscreteInputs(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, void *values);
+
+    /// \details Same as `ModbusClientPort::readDiscreteInputsAsBoolArray()`.
+    inline Modbus::StatusCode readDiscreteInputsAsBoolArray(uint8_t unit, uint16_t offset, uint16_t count, bool *values) { return readDiscreteInputsAsBoolArray(this, unit, offset, count, values); }
+
+    /// \details Same as `ModbusClientPort::readDiscreteInputsAsBoolArray()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode readDiscreteInputsAsBoolArray(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, bool *values);
+#endif // MBF_READ_DISCRETE_INPUTS_DISABLE
+
+#ifndef MBF_READ_HOLDING_REGISTERS_DISABLE
+    Modbus::StatusCode readHoldingRegisters(uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values) override;
+
+    /// \details Same as `ModbusClientPort::readHoldingRegisters()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode readHoldingRegisters(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values);
+#endif // MBF_READ_HOLDING_REGISTERS_DISABLE
+
+#ifndef MBF_READ_INPUT_REGISTERS_DISABLE
+    Modbus::StatusCode readInputRegisters(uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values) override;
+
+    /// \details Same as `ModbusClientPort::readInputRegisters()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode readInputRegisters(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, uint16_t *values);
+#endif // MBF_READ_INPUT_REGISTERS_DISABLE
+
+#ifndef MBF_WRITE_SINGLE_COIL_DISABLE
+    Modbus::StatusCode writeSingleCoil(uint8_t unit, uint16_t offset, bool value) override;
+
+    /// \details Same as `ModbusClientPort::writeSingleCoil()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode writeSingleCoil(ModbusObject *client, uint8_t unit, uint16_t offset, bool value);
+#endif // MBF_WRITE_SINGLE_COIL_DISABLE
+
+#ifndef MBF_WRITE_SINGLE_REGISTER_DISABLE
+    Modbus::StatusCode writeSingleRegister(uint8_t unit, uint16_t offset, uint16_t value) override;
+
+    /// \details Same as `ModbusClientPort::writeSingleRegister()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode writeSingleRegister(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t value);
+#endif // MBF_WRITE_SINGLE_REGISTER_DISABLE
+
+#ifndef MBF_READ_EXCEPTION_STATUS_DISABLE
+    Modbus::StatusCode readExceptionStatus(uint8_t unit, uint8_t *value) override;
+
+    /// \details Same as `ModbusClientPort::readExceptionStatus()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode readExceptionStatus(ModbusObject *client, uint8_t unit, uint8_t *value);
+#endif // MBF_READ_EXCEPTION_STATUS_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_DISABLE
+#ifndef MBF_DIAGNOSTICS_RETURN_QUERY_DATA_DISABLE
+    Modbus::StatusCode diagnosticsReturnQueryData(uint8_t unit, const void *indata, uint8_t insize, void *outdata, uint8_t *outsize) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsReturnQueryData()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsReturnQueryData(ModbusObject *client, uint8_t unit, const void *indata, uint8_t insize, void *outdata, uint8_t *outsize);
+#endif // MBF_DIAGNOSTICS_RETURN_QUERY_DATA_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RESTART_COMMUNICATIONS_OPTION_DISABLE
+    Modbus::StatusCode diagnosticsRestartCommunicationsOption(uint8_t unit, bool clearEventLog) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsRestartCommunicationsOption()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsRestartCommunicationsOption(ModbusObject *client, uint8_t unit, bool clearEventLog);
+#endif // MBF_DIAGNOSTICS_RESTART_COMMUNICATIONS_OPTION_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_DIAGNOSTIC_REGISTER_DISABLE
+    Modbus::StatusCode diagnosticsReturnDiagnosticRegister(uint8_t unit, uint16_t *value) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsReturnDiagnosticRegister()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsReturnDiagnosticRegister(ModbusObject *client, uint8_t unit, uint16_t *value);
+#endif // MBF_DIAGNOSTICS_RETURN_DIAGNOSTIC_REGISTER_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_CHANGE_ASCII_INPUT_DELIMITER_DISABLE
+    Modbus::StatusCode diagnosticsChangeAsciiInputDelimiter(uint8_t unit, char delimiter) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsChangeAsciiInputDelimiter()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsChangeAsciiInputDelimiter(ModbusObject *client, uint8_t unit, char delimiter);
+#endif // MBF_DIAGNOSTICS_CHANGE_ASCII_INPUT_DELIMITER_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_FORCE_LISTEN_ONLY_MODE_DISABLE
+    Modbus::StatusCode diagnosticsForceListenOnlyMode(uint8_t unit) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsForceListenOnlyMode()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsForceListenOnlyMode(ModbusObject *client, uint8_t unit);
+#endif // MBF_DIAGNOSTICS_FORCE_LISTEN_ONLY_MODE_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_CLEAR_COUNTERS_AND_DIAGNOSTIC_REGISTER_DISABLE
+    Modbus::StatusCode diagnosticsClearCountersAndDiagnosticRegister(uint8_t unit) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsClearCountersAndDiagnosticRegister()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsClearCountersAndDiagnosticRegister(ModbusObject *client, uint8_t unit);
+#endif // MBF_DIAGNOSTICS_CLEAR_COUNTERS_AND_DIAGNOSTIC_REGISTER_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_BUS_MESSAGE_COUNT_DISABLE
+    Modbus::StatusCode diagnosticsReturnBusMessageCount(uint8_t unit, uint16_t *count) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsReturnBusMessageCount()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsReturnBusMessageCount(ModbusObject *client, uint8_t unit, uint16_t *count);
+#endif // MBF_DIAGNOSTICS_RETURN_BUS_MESSAGE_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_BUS_COMMUNICATION_ERROR_COUNT_DISABLE
+    Modbus::StatusCode diagnosticsReturnBusCommunicationErrorCount(uint8_t unit, uint16_t *count) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsReturnBusCommunicationErrorCount()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsReturnBusCommunicationErrorCount(ModbusObject *client, uint8_t unit, uint16_t *count);
+#endif // MBF_DIAGNOSTICS_RETURN_BUS_COMMUNICATION_ERROR_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_BUS_EXCEPTION_ERROR_COUNT_DISABLE
+    Modbus::StatusCode diagnosticsReturnBusExceptionErrorCount(uint8_t unit, uint16_t *count) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsReturnBusExceptionErrorCount()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsReturnBusExceptionErrorCount(ModbusObject *client, uint8_t unit, uint16_t *count);
+#endif // MBF_DIAGNOSTICS_RETURN_BUS_EXCEPTION_ERROR_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_SERVER_MESSAGE_COUNT_DISABLE
+    Modbus::StatusCode diagnosticsReturnServerMessageCount(uint8_t unit, uint16_t *count) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsReturnServerMessageCount()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsReturnServerMessageCount(ModbusObject *client, uint8_t unit, uint16_t *count);
+#endif // MBF_DIAGNOSTICS_RETURN_SERVER_MESSAGE_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_SERVER_NO_RESPONSE_COUNT_DISABLE
+    Modbus::StatusCode diagnosticsReturnServerNoResponseCount(uint8_t unit, uint16_t *count) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsReturnServerNoResponseCount()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsReturnServerNoResponseCount(ModbusObject *client, uint8_t unit, uint16_t *count);
+#endif // MBF_DIAGNOSTICS_RETURN_SERVER_NO_RESPONSE_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_SERVER_NAK_COUNT_DISABLE
+    Modbus::StatusCode diagnosticsReturnServerNAKCount(uint8_t unit, uint16_t *count) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsReturnServerNAKCount()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsReturnServerNAKCount(ModbusObject *client, uint8_t unit, uint16_t *count);
+#endif // MBF_DIAGNOSTICS_RETURN_SERVER_NAK_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_SERVER_BUSY_COUNT_DISABLE
+    Modbus::StatusCode diagnosticsReturnServerBusyCount(uint8_t unit, uint16_t *count) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsReturnServerBusyCount()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsReturnServerBusyCount(ModbusObject *client, uint8_t unit, uint16_t *count);
+#endif // MBF_DIAGNOSTICS_RETURN_SERVER_BUSY_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_RETURN_SERVER_CHARACTER_OVERRUN_COUNT_DISABLE
+    Modbus::StatusCode diagnosticsReturnBusCharacterOverrunCount(uint8_t unit, uint16_t *count) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsReturnBusCharacterOverrunCount()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsReturnBusCharacterOverrunCount(ModbusObject *client, uint8_t unit, uint16_t *count);
+#endif // MBF_DIAGNOSTICS_RETURN_SERVER_CHARACTER_OVERRUN_COUNT_DISABLE
+
+#ifndef MBF_DIAGNOSTICS_CLEAR_OVERRUN_COUNTER_AND_FLAG_DISABLE
+    Modbus::StatusCode diagnosticsClearOverrunCounterAndFlag(uint8_t unit) override;
+
+    /// \details Same as `ModbusClientPort::diagnosticsClearOverrunCounterAndFlag()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode diagnosticsClearOverrunCounterAndFlag(ModbusObject *client, uint8_t unit);
+#endif // MBF_DIAGNOSTICS_CLEAR_OVERRUN_COUNTER_AND_FLAG_DISABLE
+#endif // MBF_DIAGNOSTICS_DISABLE
+
+#ifndef MBF_GET_COMM_EVENT_COUNTER_DISABLE
+    Modbus::StatusCode getCommEventCounter(uint8_t unit, uint16_t *status, uint16_t *eventCount) override;
+
+    /// \details Same as `ModbusClientPort::getCommEventCounter()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode getCommEventCounter(ModbusObject *client, uint8_t unit, uint16_t *status, uint16_t *eventCount);
+#endif // MBF_GET_COMM_EVENT_COUNTER_DISABLE
+
+#ifndef MBF_GET_COMM_EVENT_LOG_DISABLE
+    Modbus::StatusCode getCommEventLog(uint8_t unit, uint16_t *status, uint16_t *eventCount, uint16_t *messageCount, void *eventBuff, uint8_t *eventBuffSize) override;
+
+    /// \details Same as `ModbusClientPort::getCommEventLog()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode getCommEventLog(ModbusObject *client, uint8_t unit, uint16_t *status, uint16_t *eventCount, uint16_t *messageCount, void *eventBuff, uint8_t *eventBuffSize);
+#endif // MBF_GET_COMM_EVENT_LOG_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_COILS_DISABLE
+    Modbus::StatusCode writeMultipleCoils(uint8_t unit, uint16_t offset, uint16_t count, const void *values) override;
+
+    /// \details Same as `ModbusClientPort::writeMultipleCoils()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode writeMultipleCoils(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, const void *values);
+
+    /// \details Same as `ModbusClientPort::writeMultipleCoilsAsBoolArray()`.
+    inline Modbus::StatusCode writeMultipleCoilsAsBoolArray(uint8_t unit, uint16_t offset, uint16_t count, const bool *values) { return writeMultipleCoilsAsBoolArray(this, unit, offset, count, values); }
+
+    /// \details Same as `ModbusClientPort::writeMultipleCoilsAsBoolArray()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode writeMultipleCoilsAsBoolArray(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, const bool *values);
+#endif // MBF_WRITE_MULTIPLE_COILS_DISABLE
+
+#ifndef MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+    Modbus::StatusCode writeMultipleRegisters(uint8_t unit, uint16_t offset, uint16_t count, const uint16_t *values) override;
+
+    /// \details Same as `ModbusClientPort::writeMultipleRegisters()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode writeMultipleRegisters(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t count, const uint16_t *values);
+#endif // MBF_WRITE_MULTIPLE_REGISTERS_DISABLE
+
+#ifndef MBF_REPORT_SERVER_ID_DISABLE
+    Modbus::StatusCode reportServerID(uint8_t unit, void *data, uint8_t *dataSize) override;
+
+    /// \details Same as `ModbusClientPort::reportServerID()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode reportServerID(ModbusObject *client, uint8_t unit, void *data, uint8_t *dataSize);
+#endif // MBF_REPORT_SERVER_ID_DISABLE
+
+#ifndef MBF_READ_FILE_RECORD_DISABLE
+    Modbus::StatusCode readFileRecord(uint8_t unit, const Modbus::FileRecord *records, uint8_t recordsCount, void *outData, uint8_t *outSize = nullptr) override;
+
+    /// \details Same as `ModbusClientPort::readFileRecord()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode readFileRecord(ModbusObject *client, uint8_t unit, const Modbus::FileRecord *records, uint8_t recordsCount, void *outData, uint8_t *outSize = nullptr);
+#endif // MBF_READ_FILE_RECORD_DISABLE
+
+#ifndef MBF_WRITE_FILE_RECORD_DISABLE
+    Modbus::StatusCode writeFileRecord(uint8_t unit, const Modbus::FileRecord *records, uint8_t recordsCount, const void *inData, uint8_t *inSize = nullptr) override;
+
+    /// \details Same as `ModbusClientPort::writeFileRecord()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode writeFileRecord(ModbusObject *client, uint8_t unit, const Modbus::FileRecord *records, uint8_t recordsCount, const void *inData, uint8_t *inSize = nullptr);
+#endif // MBF_WRITE_FILE_RECORD_DISABLE
+
+#ifndef MBF_MASK_WRITE_REGISTER_DISABLE
+    Modbus::StatusCode maskWriteRegister(uint8_t unit, uint16_t offset, uint16_t andMask, uint16_t orMask) override;
+
+    /// \details Same as `ModbusClientPort::maskWriteRegister()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode maskWriteRegister(ModbusObject *client, uint8_t unit, uint16_t offset, uint16_t andMask, uint16_t orMask);
+#endif // MBF_MASK_WRITE_REGISTER_DISABLE
+
+#ifndef MBF_READ_WRITE_MULTIPLE_REGISTERS_DISABLE
+    Modbus::StatusCode readWriteMultipleRegisters(uint8_t unit, uint16_t readOffset, uint16_t readCount, uint16_t *readValues, uint16_t writeOffset, uint16_t writeCount, const uint16_t *writeValues) override;
+
+    /// \details Same as `ModbusClientPort::readWriteMultipleRegisters()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode readWriteMultipleRegisters(ModbusObject *client, uint8_t unit, uint16_t readOffset, uint16_t readCount, uint16_t *readValues, uint16_t writeOffset, uint16_t writeCount, const uint16_t *writeValues);
+#endif // MBF_READ_WRITE_MULTIPLE_REGISTERS_DISABLE
+
+#ifndef MBF_READ_FIFO_QUEUE_DISABLE
+    Modbus::StatusCode readFIFOQueue(uint8_t unit, uint16_t fifoadr, uint16_t *values, uint16_t *count) override;
+
+    /// \details Same as `ModbusClientPort::readFIFOQueue()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode readFIFOQueue(ModbusObject *client, uint8_t unit, uint16_t fifoadr, uint16_t *values, uint16_t *count);
+#endif // MBF_READ_FIFO_QUEUE_DISABLE
+
+#ifndef MBF_ENCAPSULATED_INTERFACE_TRANSPORT_DISABLE
+#ifndef MBF_MEI_READ_DEVICE_IDENTIFICATION_DISABLE
+    Modbus::StatusCode readDeviceIdentification(uint8_t unit, uint8_t readDeviceId, uint8_t objectId, void *data, uint8_t *dataSize, uint8_t *numberOfObjects = nullptr, uint8_t *conformityLevel = nullptr, bool *moreFollows = nullptr, uint8_t *nextObjectId = nullptr) override;
+
+    /// \details Same as `ModbusClientPort::readDeviceIdentification()`, request is sent by the member bound to the `client`.
+    Modbus::StatusCode readDeviceIdentification(ModbusObject *client, uint8_t unit, uint8_t readDeviceId, uint8_t objectId, void *data, uint8_t *dataSize, uint8_t *numberOfObjects = nullptr, uint8_t *conformityLevel = nullptr, bool *moreFollows = nullptr, uint8_t *nextObjectId = nullptr);
+#endif // MBF_MEI_READ_DEVICE_IDENTIFICATION_DISABLE
+#endif // MBF_ENCAPSULATED_INTERFACE_TRANSPORT_DISABLE
+
+private:
+    ModbusClientPort *acquire(ModbusObject *client);
+    Modbus::StatusCode release(ModbusObject *client, Modbus::StatusCode status);
+};
+
+#endif // MODBUSCLIENTPORTPOOL_H
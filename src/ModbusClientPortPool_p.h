@@ -0,0 +1,51 @@
+#ifndef MODBUSCLIENTPORTPOOL_P_H
+#define MODBUSCLIENTPORTPOOL_P_H
+
+#include <vector>
+#include <map>
+
+#include "ModbusObject_p.h"
+
+#include "ModbusClientPortPool.h"
+#include "ModbusClientPort.h"
+
+namespace ModbusClientPortPoolPrivateNS {
+
+struct PoolMember
+{
+    ModbusClientPort *port;
+    uint32_t outstanding; // count of clients bound to the member
+};
+
+} // namespace ModbusClientPortPoolPrivateNS
+
+using namespace ModbusClientPortPoolPrivateNS;
+
+class ModbusClientPortPoolPrivate : public ModbusObjectPrivate
+{
+public:
+    inline bool isValid(int i) const { return (i >= 0) && (i < static_cast<int>(members.size())); }
+
+    // Returns index of the member with the least count of outstanding requests, open members are preferred
+    inline int leastOutstanding() const
+    {
+        int res = 0;
+        uint32_t min = static_cast<uint32_t>(-1);
+        for (size_t i = 0; i < members.size(); ++i)
+        {
+            uint32_t score = members[i].outstanding * 2 + (members[i].port->isOpen() ? 0 : 1);
+            if (score < min)
+            {
+                min = score;
+                res = static_cast<int>(i);
+            }
+        }
+        return res;
+    }
+
+public:
+    std::vector<PoolMember> members;
+    std::map<ModbusObject*, int> bindings; // client -> index of the member
+};
+
+#endif // MODBUSCLIENTPORTPOOL_P_H
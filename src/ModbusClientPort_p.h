@@ -1,10 +1,16 @@
 #ifndef MODBUSCLIENTPORT_P_H
 #define MODBUSCLIENTPORT_P_H
 
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <deque>
+
 #include "ModbusObject_p.h"
 
 #include "ModbusObject.h"
 #include "ModbusPort.h"
+#include "ModbusClientPort.h"
 
 namespace ModbusClientPortPrivateNS {
 
@@ -24,6 +30,93 @@ enum State
     STATE_END = STATE_CLOSED
 };
 
+struct UnitState
+{
+    ModbusClientPort::UnitStatistics stats;
+    uint64_t sumResponseTimeUs;
+    uint32_t probeInterval;
+    uint32_t probeDelay;
+    Timer offlineTimestamp;
+};
+
+typedef std::unordered_map<uint8_t, UnitState> UnitStates;
+
+struct RttState
+{
+    uint32_t srttUs;
+    uint32_t rttvarUs;
+    uint32_t timeout;
+    uint32_t samples;
+};
+
+typedef std::unordered_map<uint16_t, RttState> RttStates;
+typedef std::unordered_map<ModbusObject*, uint32_t> WaitingClients;
+typedef std::unordered_map<const ModbusObject*, ModbusClientPort::RequestOptions> ClientOptions;
+typedef std::unordered_set<ModbusClient*> AttachedClients;
+
+struct UnitConfig
+{
+    uint16_t maxRegisters;
+    uint16_t maxDiscrets;
+    uint32_t capabilities;
+};
+
+typedef std::unordered_map<uint8_t, UnitConfig> UnitConfigs;
+
+struct QueuedWrite
+{
+    uint16_t value;
+    std::vector<uint32_t> tickets;
+};
+
+// Contiguous addresses of the same unit and function beginning from `offset`
+struct QueuedRun
+{
+    uint8_t unit;
+    uint8_t func;
+    uint16_t offset;
+    std::vector<QueuedWrite> writes;
+};
+
+// Note: runs are kept in issue order and are sent in the same order
+typedef std::deque<QueuedRun> WriteQueue;
+
+// Count of completed write statuses kept for `queuedWriteStatus()`
+const uint32_t WriteStatusHistory = 4096;
+
+// Returns `true` if `status` means that response is received but it's corrupted or doesn't match the request
+inline bool isBadResponseStatus(Modbus::StatusCode status)
+{
+    switch (status)
+    {
+    case Modbus::Status_BadEmptyResponse:
+    case Modbus::Status_BadNotCorrectResponse:
+    case Modbus::Status_BadReadBufferOverflow:
+    case Modbus::Status_BadAscMissColon:
+    case Modbus::Status_BadAscMissCrLf:
+    case Modbus::Status_BadAscChar:
+    case Modbus::Status_BadLrc:
+    case Modbus::Status_BadCrc:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Returns `true` if `status` means that remote device did not respond
+inline bool isNoResponseStatus(Modbus::StatusCode status)
+{
+    switch (status)
+    {
+    case Modbus::Status_BadSerialReadTimeout:
+    case Modbus::Status_BadTcpReadTimeout:
+    case Modbus::Status_BadUdpReadTimeout:
+        return true;
+    default:
+        return false;
+    }
+}
+
 } // namespace ModbusClientPortPrivateNS
 
 using namespace ModbusClientPortPrivateNS;
@@ -41,6 +134,8 @@ public:
         this->orMask = 0;
         this->block = false;;
         this->currentClient = nullptr;
+        this->groupClient = nullptr;
+        this->groupTimestamp = 0;
         this->port = port;
         this->repeats = 0;
         this->lastStatus = Modbus::Status_Uncertain;
@@ -51,6 +146,47 @@ public:
         this->lastStatusTimestamp = 0;
         this->settings.tries = 1;
         this->settings.broadcastEnabled = true;
+        this->settings.busScheduler = false;
+        this->settings.unitOfflineThreshold = 2;
+        this->settings.unitProbeInterval = 1000;
+        this->settings.unitProbeIntervalMax = 60000;
+        this->settings.unitProbeJitter = 20;
+        this->settings.adaptiveTimeout = false;
+        this->settings.adaptiveTimeoutMin = 10;
+        this->settings.adaptiveTimeoutMax = 0;
+        this->settings.adaptiveTimeoutFactor = 4;
+        this->settings.adaptiveTimeoutPerFunction = false;
+        this->settings.writeCoalescingWindow = 0;
+        this->settings.groupTimeout = 10000;
+        this->staticTimeout = 0;
+        this->grantSeq = 0;
+        this->busContended = false;
+        this->skipTimeoutWait = false;
+        this->rand = static_cast<uint32_t>(timerUs()) | 1;
+        this->exchangeTimestampUs = 0;
+        this->responseTimeUs = 0;
+        this->txSize = 0;
+        this->rxSize = 0;
+        this->options.timeout = 0;
+        this->options.deadline = 0;
+        this->requestTimestamp = 0;
+        this->restoreTimeout = 0;
+        this->timeoutOverridden = false;
+        this->range.client = nullptr;
+        this->range.func = 0;
+        this->range.block = 0;
+        this->range.done = 0;
+        this->range.status = Modbus::Status_Good;
+        this->writeQueueTimestamp = 0;
+        this->flight.client = nullptr;
+        this->flight.fused = false;
+        this->flight.unit = 0;
+        this->flight.func = 0;
+        this->flight.offset = 0;
+        this->flight.count = 0;
+        this->flight.status = Modbus::Status_Good;
+        this->writeStatusBase = 1;
+        busStatisticsReset();
 
         port->setServerMode(false);
     }
@@ -70,6 +206,24 @@ public:
     inline void blockWriteBuffer() { block = true; }
     inline void freeWriteBuffer() { block = false; }
     inline const Char *getName() const { return currentClient->objectName(); }
+    // Returns `true` if the port is held by other client than `client` (by its request or transaction group)
+    inline bool isSeizedByOther(ModbusObject *client)
+    {
+        groupCheck();
+        return (currentClient && (currentClient != client)) || (groupClient && (groupClient != client));
+    }
+
+    // Note: transaction group is released if its client makes no request during `groupTimeout`
+    // (e.g. `endGroup()` was not called), request of the group in progress keeps it
+    inline void groupCheck()
+    {
+        if (!groupClient)
+            return;
+        if (currentClient == groupClient)
+            groupTimestamp = timer();
+        else if (settings.groupTimeout && (timer() - groupTimestamp >= settings.groupTimeout))
+            groupClient = nullptr;
+    }
 
     inline StatusCode setPortError(StatusCode status)
     {
@@ -115,6 +269,309 @@ public:
         return lastStatus;
     }
 
+public: // bus scheduler
+    inline void busStatisticsReset()
+    {
+        bus.startUs   = timerUs();
+        bus.busyUs    = 0;
+        bus.trafficUs = 0;
+        bus.txBytes   = 0;
+        bus.rxBytes   = 0;
+        bus.transactions  = 0;
+        bus.syscalls      = 0;
+        bus.syscallsBegin = 0;
+    }
+
+    // Note: clients denied during current or previous grant are considered as waiting for the bus
+    inline void busDenied(ModbusObject *client)
+    {
+        if (settings.busScheduler)
+            waiting[client] = grantSeq;
+    }
+
+    inline void busGranted(ModbusObject *client)
+    {
+        if (!settings.busScheduler)
+            return;
+        waiting.erase(client);
+        busContended = false;
+        for (WaitingClients::iterator it = waiting.begin(); it != waiting.end(); )
+        {
+            if (it->second + 1 < grantSeq)
+                it = waiting.erase(it);
+            else
+            {
+                busContended = true;
+                ++it;
+            }
+        }
+        ++grantSeq;
+    }
+
+    inline void setCircuitState(UnitState &u, ModbusClientPort::CircuitState state)
+    {
+        u.stats.circuitState = state;
+        u.stats.offline = (state != ModbusClientPort::CircuitClosed);
+    }
+
+    // Returns `interval` randomized by `unitProbeJitter` percent
+    inline uint32_t jitter(uint32_t interval)
+    {
+        uint32_t spread = static_cast<uint32_t>((static_cast<uint64_t>(interval) * settings.unitProbeJitter) / 100);
+        if (spread == 0)
+            return interval;
+        rand ^= rand << 13; rand ^= rand >> 17; rand ^= rand << 5; // xorshift32
+        return interval - spread + static_cast<uint32_t>(rand % (static_cast<uint64_t>(spread) * 2 + 1));
+    }
+
+    // Returns `true` if request to offline `unit` must be skipped. Offline unit is probed (circuit becomes half-open)
+    // when its probe delay is elapsed and bus is idle (or probe delay is elapsed twice). `probe` is set to `true` then
+    inline bool isUnitSkipped(uint8_t unit, bool *probe)
+    {
+        *probe = false;
+        if (!settings.busScheduler || (unit == 0))
+            return false;
+        UnitStates::iterator it = units.find(unit);
+        if (it == units.end() || (it->second.stats.circuitState == ModbusClientPort::CircuitClosed))
+            return false;
+        UnitState &u = it->second;
+        Timer t = timer() - u.offlineTimestamp;
+        if ((u.stats.circuitState == ModbusClientPort::CircuitOpen) &&
+            (t >= u.probeDelay) && (!busContended || (t >= u.probeDelay * 2)))
+        {
+            setCircuitState(u, ModbusClientPort::CircuitHalfOpen);
+            *probe = true;
+            return false;
+        }
+        u.stats.skipped++;
+        return true;
+    }
+
+    inline void exchangeBegin()
+    {
+        exchangeTimestampUs = timerUs();
+        txSize = 0;
+        rxSize = 0;
+        bus.syscallsBegin = port->syscallCount();
+    }
+
+    // Abandons request in progress, so the next one starts from the beginning with new transaction id
+    inline void abandon()
+    {
+        requestEnd();
+        freeWriteBuffer();
+        repeats = 0;
+        skipTimeoutWait = false;
+        port->setNextRequestRepeated(false);
+        if ((state == STATE_WRITE) || (state == STATE_BEGIN_READ) || (state == STATE_READ) || (state == STATE_TIMEOUT))
+            state = STATE_UNKNOWN;
+    }
+
+    void exchangeEnd();
+    // Returns `true` if state of the circuit breaker of the unit is changed
+    bool unitCompleted(uint8_t unit, StatusCode status);
+
+public: // adaptive timeout
+    inline uint16_t rttKey(uint8_t unit, uint8_t func) const { return static_cast<uint16_t>((unit << 8) | (settings.adaptiveTimeoutPerFunction ? func : 0)); }
+    inline uint32_t timeoutMax() const { return settings.adaptiveTimeoutMax ? settings.adaptiveTimeoutMax : staticTimeout; }
+    inline uint32_t timeoutClamp(uint32_t timeout) const
+    {
+        uint32_t mx = timeoutMax();
+        if (timeout > mx)
+            timeout = mx;
+        if (timeout < settings.adaptiveTimeoutMin)
+            timeout = settings.adaptiveTimeoutMin;
+        return timeout;
+    }
+
+    inline uint32_t adaptiveTimeout(uint8_t unit, uint8_t func) const
+    {
+        RttStates::const_iterator it = rtts.find(rttKey(unit, func));
+        if (it == rtts.end())
+            return timeoutClamp(timeoutMax());
+        return it->second.timeout;
+    }
+
+    void rttCompleted(uint8_t unit, uint8_t func, StatusCode status);
+
+public: // request options
+    inline void requestBegin()
+    {
+        ClientOptions::const_iterator it = clientOptions.find(currentClient);
+        if (it != clientOptions.end())
+            options = it->second;
+        else
+        {
+            options.timeout = 0;
+            options.deadline = 0;
+        }
+        requestTimestamp = timer();
+        timeoutOverridden = (options.timeout || options.deadline);
+        if (timeoutOverridden)
+            restoreTimeout = port->timeout();
+    }
+
+    inline bool isDeadlineElapsed() const { return options.deadline && (timer() - requestTimestamp >= options.deadline); }
+
+    // Sets port timeout for the next try of the current request
+    inline void tryTimeoutApply()
+    {
+        if (!timeoutOverridden)
+            return;
+        uint32_t timeout = options.timeout;
+        if (!timeout)
+            timeout = (settings.adaptiveTimeout && !isBroadcast()) ? adaptiveTimeout(unit, func) : restoreTimeout;
+        if (options.deadline)
+        {
+            Timer t = timer() - requestTimestamp;
+            uint32_t rest = (t < options.deadline) ? options.deadline - t : 1;
+            if (timeout > rest)
+                timeout = rest;
+        }
+        port->setTimeout(timeout);
+    }
+
+    inline void requestEnd()
+    {
+        if (timeoutOverridden)
+        {
+            port->setTimeout(restoreTimeout);
+            timeoutOverridden = false;
+        }
+    }
+
+public: // write coalescing
+    // Puts write into the queue and returns its ticket. Write is merged into the last run of the queue
+    // if its address is inside the run (last writer wins) or follows it, otherwise new run is started,
+    // so writes are never reordered
+    inline uint32_t writeQueuePush(uint8_t unit, uint8_t func, uint16_t offset, uint16_t value)
+    {
+        if (writeQueue.empty())
+            writeQueueTimestamp = timer();
+        while ((writeStatus.size() >= WriteStatusHistory) && !StatusIsProcessing(writeStatus.front()))
+        {
+            writeStatus.pop_front();
+            ++writeStatusBase;
+        }
+        uint32_t ticket = writeStatusBase + static_cast<uint32_t>(writeStatus.size());
+        writeStatus.push_back(Modbus::Status_Processing);
+        QueuedRun *run = writeQueue.empty() ? nullptr : &writeQueue.back();
+        if (!run || (run->unit != unit) || (run->func != func) || (offset < run->offset) ||
+            (static_cast<size_t>(offset - run->offset) > run->writes.size()) ||
+            (offset - run->offset >= rangeBlock(unit, func)))
+        {
+            writeQueue.push_back(QueuedRun());
+            run = &writeQueue.back();
+            run->unit   = unit;
+            run->func   = func;
+            run->offset = offset;
+        }
+        size_t i = offset - run->offset;
+        if (i == run->writes.size())
+            run->writes.push_back(QueuedWrite());
+        run->writes[i].value = value;
+        run->writes[i].tickets.push_back(ticket);
+        return ticket;
+    }
+
+    // Returns count of queued addresses (address written several times within one run is counted once)
+    inline uint32_t writeQueueCount() const
+    {
+        uint32_t c = 0;
+        for (WriteQueue::const_iterator it = writeQueue.begin(); it != writeQueue.end(); ++it)
+            c += static_cast<uint32_t>(it->writes.size());
+        return c;
+    }
+
+    // Moves no more than `block` addresses of the first run of the queue into the request in flight
+    inline void writeQueueTake(uint16_t block)
+    {
+        QueuedRun &run = writeQueue.front();
+        flight.unit   = run.unit;
+        flight.func   = run.func;
+        flight.offset = run.offset;
+        flight.count  = (run.writes.size() < block) ? static_cast<uint16_t>(run.writes.size()) : block;
+        flight.tickets.clear();
+        const bool coils = (flight.func == MBF_WRITE_MULTIPLE_COILS);
+        uint8_t *bits = reinterpret_cast<uint8_t*>(flight.values);
+        if (coils)
+            memset(flight.values, 0, sizeof(flight.values));
+        for (uint16_t i = 0; i < flight.count; i++)
+        {
+            const QueuedWrite &w = run.writes[i];
+            if (coils)
+            {
+                if (w.value)
+                    bits[i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+            }
+            else
+                flight.values[i] = w.value;
+            flight.tickets.insert(flight.tickets.end(), w.tickets.begin(), w.tickets.end());
+        }
+        if (flight.count == run.writes.size())
+            writeQueue.pop_front();
+        else
+        {
+            run.writes.erase(run.writes.begin(), run.writes.begin() + flight.count);
+            run.offset += flight.count;
+        }
+    }
+
+    // Returns `true` if pending register writes of the `unit` are fused (or can be fused) with the holding registers read into FC23 request
+    inline bool isReadWriteFusion(ModbusObject *client, uint8_t unit, uint16_t count)
+    {
+        if (flight.client)
+            return (flight.client == client) && flight.fused;
+        if (flight.count || currentClient || isSeizedByOther(client) || (count > MB_SPEC_MAX_READ_REGISTERS) ||
+            !(unitCapabilities(unit) & ModbusClientPort::CapabilityReadWriteMultipleRegisters))
+            return false;
+        // Note: only the first run can be fused, otherwise it would be sent before the writes queued earlier
+        return !writeQueue.empty() && (writeQueue.front().unit == unit) && (writeQueue.front().func == MBF_WRITE_MULTIPLE_REGISTERS);
+    }
+
+    inline uint32_t unitCapabilities(uint8_t unit) const
+    {
+        UnitConfigs::const_iterator it = unitConfigs.find(unit);
+        return (it != unitConfigs.end()) ? it->second.capabilities : 0;
+    }
+
+    // Completes every original write of the request in flight with the `status` of the merged request
+    inline void writeQueueComplete(StatusCode status)
+    {
+        for (std::vector<uint32_t>::const_iterator it = flight.tickets.begin(); it != flight.tickets.end(); ++it)
+        {
+            uint32_t i = *it - writeStatusBase;
+            if (i < writeStatus.size())
+                writeStatus[i] = status;
+        }
+        flight.tickets.clear();
+        flight.count = 0;
+    }
+
+public: // range requests
+    // Returns count of registers/discretes in one request (chunk) of the range function `func` for the `unit`
+    inline uint16_t rangeBlock(uint8_t unit, uint8_t func) const
+    {
+        UnitConfigs::const_iterator it = unitConfigs.find(unit);
+        uint16_t c, mx;
+        switch (func)
+        {
+        case MBF_READ_COILS:
+        case MBF_READ_DISCRETE_INPUTS:
+        case MBF_WRITE_MULTIPLE_COILS:
+            mx = (func == MBF_WRITE_MULTIPLE_COILS) ? MB_SPEC_MAX_WRITE_DISCRETS : MB_SPEC_MAX_READ_DISCRETS;
+            c = (it != unitConfigs.end()) ? it->second.maxDiscrets : 0;
+            if (!c || (c > mx))
+                c = mx;
+            c &= ~7; // Note: chunk of bits must begin from the byte boundary
+            return c ? c : 8;
+        default:
+            mx = (func == MBF_WRITE_MULTIPLE_REGISTERS) ? MB_SPEC_MAX_WRITE_REGISTERS : MB_SPEC_MAX_READ_REGISTERS;
+            c = (it != unitConfigs.end()) ? it->second.maxRegisters : 0;
+            return (!c || (c > mx)) ? mx : c;
+        }
+    }
+
 public:
     ModbusPort *port;
     State state;
@@ -144,6 +601,8 @@ public:
     };
     bool block;
     ModbusObject *currentClient;
+    ModbusObject *groupClient;
+    Timer groupTimestamp;
     uint32_t repeats;
     uint8_t buff[MB_VALUE_BUFF_SZ];
     StatusCode lastStatus;
@@ -154,10 +613,82 @@ public:
     Timer timestamp;
     Timestamp lastStatusTimestamp;
 
+    UnitStates units;
+    RttStates rtts;
+    uint32_t staticTimeout;
+    WaitingClients waiting;
+    uint32_t grantSeq;
+    bool busContended;
+    bool skipTimeoutWait;
+    uint32_t rand;
+    uint64_t exchangeTimestampUs;
+    uint32_t responseTimeUs;
+    uint16_t txSize;
+    uint16_t rxSize;
+
+    UnitConfigs unitConfigs;
+    struct
+    {
+        ModbusObject *client;
+        uint8_t func;
+        uint16_t block;
+        uint16_t done;
+        StatusCode status;
+    } range;
+    std::vector<StatusCode> rangeStatus;
+
+    WriteQueue writeQueue;
+    Timer writeQueueTimestamp;
+    struct
+    {
+        ModbusObject *client;
+        bool fused; // writes in flight belong to `readHoldingRegisters()` of the `client`
+        uint8_t unit;
+        uint8_t func;
+        uint16_t offset;
+        uint16_t count;
+        uint16_t values[MB_MAX_REGISTERS];
+        std::vector<uint32_t> tickets;
+        StatusCode status;
+    } flight;
+    std::deque<StatusCode> writeStatus;
+    uint32_t writeStatusBase;
+
+    ClientOptions clientOptions;
+    AttachedClients clients;
+    ModbusClientPort::RequestOptions options;
+    Timer requestTimestamp;
+    uint32_t restoreTimeout;
+    bool timeoutOverridden;
+
+    struct
+    {
+        uint64_t startUs;
+        uint64_t busyUs;
+        uint64_t trafficUs;
+        uint32_t txBytes;
+        uint32_t rxBytes;
+        uint32_t transactions;
+        uint32_t syscalls;
+        uint32_t syscallsBegin;
+    } bus;
+
     struct
     {
         uint32_t tries;
         bool broadcastEnabled;
+        bool busScheduler;
+        uint32_t unitOfflineThreshold;
+        uint32_t unitProbeInterval;
+        uint32_t unitProbeIntervalMax;
+        uint32_t unitProbeJitter;
+        bool adaptiveTimeout;
+        uint32_t adaptiveTimeoutMin;
+        uint32_t adaptiveTimeoutMax;
+        uint32_t adaptiveTimeoutFactor;
+        bool adaptiveTimeoutPerFunction;
+        uint32_t writeCoalescingWindow;
+        uint32_t groupTimeout;
     } settings;
 
 };
@@ -32,6 +32,25 @@ public:
     virtual Modbus::StatusCode writeBuffer(uint8_t unit, uint8_t func, const uint8_t *buff, uint16_t szInBuff) = 0;
     virtual Modbus::StatusCode readBuffer(uint8_t &unit, uint8_t &func, uint8_t *buff, uint16_t maxSzBuff, uint16_t *szOutBuff) = 0;
 
+    // Returns `true` if the end of frame can be detected by its content,
+    // so stream transport can accumulate data until `isFrameEndDetected()`
+    virtual bool isStreamFrame() const { return false; }
+
+    // Checks data received into buffer starting from `offset` and returns `true` if complete frame is detected
+    virtual bool isFrameEndDetected(uint16_t offset) { (void)offset; return false; }
+
+    // Prepares buffer to read next frame. Stream frame puts there data received after the end of
+    // previous frame (pipelined frame). Returns `true` if buffer already contains complete frame
+    virtual bool startRead() { this->sz = 0; return false; }
+
+    // Returns `true` if response can be matched with its request (e.g. by transaction id),
+    // so late response to the abandoned request can be recognized and dropped
+    virtual bool isTransactional() const { return false; }
+
+    // Removes complete responses to abandoned requests from the beginning of the buffer.
+    // Returns count of removed responses
+    virtual uint16_t dropStaleFrames() { return 0; }
+
 public:
     // buffer
     const uint16_t c_buffSz;
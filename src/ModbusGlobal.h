@@ -261,6 +261,21 @@
 /// \brief 2040 = 255(count_of_bytes in function readCoils etc) * 8 (bits in byte)
 #define MB_MAX_DISCRETS 2040
 
+/// \brief 125 - maximum count of registers to read in one request by Modbus specification (FC03, FC04)
+#define MB_SPEC_MAX_READ_REGISTERS 125
+
+/// \brief 123 - maximum count of registers to write in one request by Modbus specification (FC16)
+#define MB_SPEC_MAX_WRITE_REGISTERS 123
+
+/// \brief 2000 - maximum count of discretes to read in one request by Modbus specification (FC01, FC02)
+#define MB_SPEC_MAX_READ_DISCRETS 2000
+
+/// \brief 1968 - maximum count of coils to write in one request by Modbus specification (FC15)
+#define MB_SPEC_MAX_WRITE_DISCRETS 1968
+
+/// \brief 121 - maximum count of registers to write in one read/write request by Modbus specification (FC23)
+#define MB_SPEC_MAX_READ_WRITE_REGISTERS 121
+
 /// \brief Same as `MB_MAX_BYTES`
 #define MB_VALUE_BUFF_SZ 255
 
@@ -386,6 +401,7 @@ typedef enum _StatusCode
     Status_BadWriteBufferOverflow   ,                     ///< Error. Write buffer overflow
     Status_BadReadBufferOverflow    ,                     ///< Error. Request receive buffer overflow
     Status_BadPortClosed            ,                     ///< Error. Port is closed when trying to read/write data
+    Status_BadUnitOffline           ,                     ///< Error. Remote unit is offline, request is skipped by client port (bus scheduler)
 
     //-------- Modbus common errors end ---------
 
@@ -449,6 +465,7 @@ typedef enum _ProtocolType
     RTUvTCP, ///< RTU over TCP version of Modbus communication protocol.
     ASCvUDP, ///< ASCII over UDP version of Modbus communication protocol.
     RTUvUDP, ///< RTU over UDP version of Modbus communication protocol.
+    UNIX   , ///< TCP version (MBAP header) of Modbus communication protocol over Unix domain socket (same host).
 }
 #ifdef __cplusplus
 ;
@@ -540,6 +557,23 @@ typedef struct
     uint32_t    timeoutInterByte; ///< Value for the serial port's timeout waiting next byte of packet
 } SerialSettings;
 
+/// \brief Struct to define options of TCP/UDP sockets. Zero value of the option means system default (option is not set).
+/// \details Options that are not supported by the platform are ignored. See `Modbus::lowLatencySocketOptions()` for preset profile.
+typedef struct
+{
+    uint8_t  noDelay          ; ///< Disables Nagle algorithm (`TCP_NODELAY`), so small ADUs are sent immediately
+    uint8_t  quickAck         ; ///< Disables delayed ACK (`TCP_QUICKACK`, Linux), rearmed once per received frame
+    uint8_t  fastOpen         ; ///< Enables TCP Fast Open (`TCP_FASTOPEN_CONNECT` for client, `TCP_FASTOPEN` for server, Linux), so reconnect sends request with SYN
+    uint8_t  keepAlive        ; ///< Enables TCP keepalive probes (`SO_KEEPALIVE`)
+    uint32_t keepAliveIdle    ; ///< Idle time before the first keepalive probe (seconds, `TCP_KEEPIDLE`)
+    uint32_t keepAliveInterval; ///< Interval between keepalive probes (seconds, `TCP_KEEPINTVL`)
+    uint32_t keepAliveCount   ; ///< Count of unanswered probes after which connection is dropped (`TCP_KEEPCNT`)
+    uint32_t userTimeout      ; ///< Maximum time transmitted data may remain unacknowledged before connection is dropped (milliseconds, `TCP_USER_TIMEOUT`)
+    uint32_t sendBufferSize   ; ///< Size of socket send buffer (bytes, `SO_SNDBUF`)
+    uint32_t recvBufferSize   ; ///< Size of socket receive buffer (bytes, `SO_RCVBUF`)
+    uint32_t busyPoll         ; ///< Time of busy polling of device queue on blocking read (microseconds, `SO_BUSY_POLL`, Linux)
+} SocketOptions;
+
 /// \brief Struct to define settings for TCP/UDP connection
 typedef struct 
 {
@@ -620,6 +654,18 @@ MODBUS_EXPORT uint16_t crc16(const uint8_t *byteArr, uint32_t count);
 /// \returns Returns an 8-bit unsigned integer value of the checksum
 MODBUS_EXPORT uint8_t lrc(const uint8_t *byteArr, uint32_t count);
 
+/// \details Returns time of transmission of one character (in microseconds) for the serial line
+/// with specified parameters: start bit + data bits + parity bit (if any) + stop bits.
+MODBUS_EXPORT uint32_t serialCharTimeUs(int32_t baudRate, int8_t dataBits, Parity parity, StopBits stopBits);
+
+/// \details Returns Modbus RTU inter-character time-out t1.5 (in microseconds) for the serial line with specified parameters.
+/// For baud rates greater than 19200 fixed value 750 us is used.
+MODBUS_EXPORT uint32_t serialInterCharTimeoutUs(int32_t baudRate, int8_t dataBits, Parity parity, StopBits stopBits);
+
+/// \details Returns Modbus RTU inter-frame delay t3.5 (in microseconds) for the serial line with specified parameters.
+/// For baud rates greater than 19200 fixed value 1750 us is used.
+MODBUS_EXPORT uint32_t serialInterFrameDelayUs(int32_t baudRate, int8_t dataBits, Parity parity, StopBits stopBits);
+
 /// \details Function for copy (read) values from memory input `memBuff` and put it to the output buffer `values` for 16 bit registers:
 /// \param[in]  offset      Memory offset to read from `memBuff` in 16-bit registers size.
 /// \param[in]  count       Count of 16-bit registers to read from memory `memBuff`.
@@ -678,6 +724,19 @@ MODBUS_EXPORT uint32_t bytesToAscii(const uint8_t* bytesBuff, uint8_t* asciiBuff
 /// \returns Returns size of \c bytesBuff in bytes which calc as \c {output = count / 2}
 MODBUS_EXPORT uint32_t asciiToBytes(const uint8_t* asciiBuff, uint8_t* bytesBuff, uint32_t count);
 
+/// \details Same as `bytesToAscii` but also adds every byte of \c bytesBuff to the \c sum accumulator
+/// (modulo 256) in the same pass, so LRC of the encoded data can be calculated as `-sum`.
+/// \returns Returns size of \c asciiBuff in bytes which calc as \c {output = count * 2}
+MODBUS_EXPORT uint32_t bytesToAsciiLrc(const uint8_t* bytesBuff, uint8_t* asciiBuff, uint32_t count, uint8_t *sum);
+
+/// \details Same as `asciiToBytes` but also adds every decoded byte to the \c sum accumulator
+/// (modulo 256) in the same pass. Decoding, validation of hex digits and LRC accumulation are made
+/// at once. \c bytesBuff can point to the same memory as \c asciiBuff (in-place decoding).
+/// \note \c count must be even.
+/// \returns Returns size of \c bytesBuff in bytes which calc as \c {output = count / 2} or 0 if
+/// \c asciiBuff contains not valid (upper) hex digit symbol.
+MODBUS_EXPORT uint32_t asciiToBytesLrc(const uint8_t* asciiBuff, uint8_t* bytesBuff, uint32_t count, uint8_t *sum);
+
 /// \details Make string representation of bytes array and separate bytes by space
 MODBUS_EXPORT Char *sbytes(const uint8_t* buff, uint32_t count, Char *str, uint32_t strmaxlen);
 
@@ -740,6 +799,9 @@ MODBUS_EXPORT FlowControl toflowControl(const Char *s);
 /// \details Get timer value in milliseconds.
 MODBUS_EXPORT Timer timer();
 
+/// \details Get monotonic timer value in microseconds.
+MODBUS_EXPORT uint64_t timerUs();
+
 /// \details Get current timestamp in UNIX format in milliseconds.
 MODBUS_EXPORT Timestamp currentTimestamp();
 
@@ -749,6 +811,9 @@ MODBUS_EXPORT void setConsoleColor(Color color);
 /// \details Make current thread sleep with 'msec' milliseconds.
 MODBUS_EXPORT void msleep(uint32_t msec);
 
+/// \details Make current thread sleep with 'usec' microseconds.
+MODBUS_EXPORT void microsleep(uint32_t usec);
+
 #ifdef __cplusplus
 } //extern "C"
 #endif
@@ -8,7 +8,8 @@ class ModbusNetFramePrivate : public ModbusFramePrivate
 public:
     ModbusNetFramePrivate() : ModbusFramePrivate(MB_NET_IO_BUFF_SZ),
         autoIncrement(true),
-        transaction(0)
+        transaction(0),
+        staleCount(0)
     {
     }
 
@@ -73,9 +74,34 @@ public:
         return Status_Good;
     }
 
+    bool isTransactional() const override { return !this->modeServer; }
+
+    uint16_t dropStaleFrames() override
+    {
+        if (this->modeServer)
+            return 0;
+        uint16_t c = 0;
+        while (this->sz >= 6)
+        {
+            // Note: responses with transaction id less than current one (modulo 2^16) belong to abandoned requests
+            uint16_t age = this->transaction - static_cast<uint16_t>(this->buff[1] | (this->buff[0] << 8));
+            if ((age == 0) || (age >= 0x8000))
+                break;
+            uint16_t len = 6 + (this->buff[5] | (this->buff[4] << 8));
+            if (len > this->sz)
+                break; // Note: incomplete frame is checked by `readBuffer()`
+            memmove(this->buff, this->buff + len, this->sz - len);
+            this->sz -= len;
+            ++c;
+        }
+        this->staleCount += c;
+        return c;
+    }
+
 public:
     bool autoIncrement;
     uint16_t transaction;
+    uint32_t staleCount;
 };
 
 inline ModbusNetFramePrivate *d_net(ModbusFramePrivate *f) { return static_cast<ModbusNetFramePrivate*>(f); }
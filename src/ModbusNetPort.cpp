@@ -53,4 +53,19 @@ void ModbusNetPort::setPort(uint16_t port)
         d->settings.port = port;
         d->setChanged(true);
     }
+}
+
+const SocketOptions &ModbusNetPort::socketOptions() const
+{
+    return d_cast(d_ptr)->sockopt();
+}
+
+void ModbusNetPort::setSocketOptions(const SocketOptions &options)
+{
+    ModbusNetPortPrivate *d = d_cast(d_ptr);
+    if (memcmp(&d->settings.sockopt, &options, sizeof(options)))
+    {
+        d->settings.sockopt = options;
+        d->setChanged(true);
+    }
 }
\ No newline at end of file
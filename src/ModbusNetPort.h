@@ -67,6 +67,13 @@ public: // settings
     /// \details Sets the settings for the TCP/UDP port number of the remote device.
     void setPort(uint16_t port);
 
+    /// \details Returns options applied to the socket of the port when it is opened.
+    const Modbus::SocketOptions &socketOptions() const;
+
+    /// \details Sets options applied to the socket of the port when it is opened (e.g. `Modbus::lowLatencySocketOptions()`).
+    /// Options of already opened socket are applied on reconnect.
+    void setSocketOptions(const Modbus::SocketOptions &options);
+
 protected:
     /// \cond
     using ModbusPort::ModbusPort;
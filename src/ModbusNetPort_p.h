@@ -18,17 +18,20 @@ public:
         settings.host        = d.host;
         settings.port        = d.port;
         settingsBase.timeout = d.timeout;
+        settings.sockopt     = Modbus::defaultSocketOptions();
     }
 
 public: // settings
     inline const String& host() const { return settings.host; }
     inline uint16_t port() const { return settings.port; }
+    inline const Modbus::SocketOptions &sockopt() const { return settings.sockopt; }
 
 public:
     struct
     {
         String host;
         uint16_t port;
+        Modbus::SocketOptions sockopt;
     } settings;
 
 };
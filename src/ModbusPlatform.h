@@ -25,6 +25,13 @@
 #define MB_OS_OSX
 #endif
 
+// Default type of Unix domain socket: `SOCK_SEQPACKET` (keeps message boundaries) on Linux, `SOCK_STREAM` otherwise
+#ifdef __linux__
+#define MB_UNIX_SEQPACKET_DEFAULT true
+#else
+#define MB_UNIX_SEQPACKET_DEFAULT false
+#endif
+
 
 #ifdef _MSC_VER
 
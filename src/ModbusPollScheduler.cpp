@@ -0,0 +1,164 @@
+#include "ModbusPollScheduler.h"
+#include "ModbusPollScheduler_p.h"
+
+#include "ModbusSubscription.h"
+
+using namespace Modbus;
+
+static inline ModbusPollSchedulerPrivate *d_cast(ModbusObjectPrivate *d_ptr) { return static_cast<ModbusPollSchedulerPrivate*>(d_ptr); }
+
+ModbusPollScheduler::ModbusPollScheduler() :
+    ModbusObject(new ModbusPollSchedulerPrivate())
+{
+}
+
+int ModbusPollScheduler::addSubscription(ModbusSubscription *subscription, uint32_t periodMin, uint32_t periodMax)
+{
+    ModbusPollSchedulerPrivate *d = d_cast(d_ptr);
+    if (periodMax < periodMin)
+        periodMax = periodMin;
+    PollItem i;
+    i.subscription = subscription;
+    i.periodMin = periodMin;
+    i.periodMax = periodMax;
+    // Note: new item is considered as changing, so it starts with minimal period
+    i.rate = 1;
+    i.target = periodMin;
+    i.period = periodMin;
+    i.timeUs = 0;
+    i.pollCount = 0;
+    i.timestamp = 0;
+    i.startUs = 0;
+    i.polled = false;
+    d->items.push_back(i);
+    d->updatePeriods();
+    return static_cast<int>(d->items.size()) - 1;
+}
+
+int ModbusPollScheduler::itemCount() const
+{
+    return static_cast<int>(d_cast(d_ptr)->items.size());
+}
+
+ModbusSubscription *ModbusPollScheduler::subscription(int item) const
+{
+    ModbusPollSchedulerPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(item))
+        return nullptr;
+    return d->items[item].subscription;
+}
+
+uint32_t ModbusPollScheduler::period(int item) const
+{
+    ModbusPollSchedulerPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(item))
+        return 0;
+    return d->items[item].period;
+}
+
+double ModbusPollScheduler::changeRate(int item) const
+{
+    ModbusPollSchedulerPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(item))
+        return 0;
+    return d->items[item].rate;
+}
+
+uint32_t ModbusPollScheduler::pollTimeUs(int item) const
+{
+    ModbusPollSchedulerPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(item))
+        return 0;
+    return d->items[item].timeUs;
+}
+
+uint32_t ModbusPollScheduler::pollCount(int item) const
+{
+    ModbusPollSchedulerPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(item))
+        return 0;
+    return d->items[item].pollCount;
+}
+
+uint32_t ModbusPollScheduler::busBudget() const
+{
+    return d_cast(d_ptr)->busBudget;
+}
+
+void ModbusPollScheduler::setBusBudget(uint32_t percent)
+{
+    ModbusPollSchedulerPrivate *d = d_cast(d_ptr);
+    if (percent < 1)
+        percent = 1;
+    else if (percent > 100)
+        percent = 100;
+    d->busBudget = percent;
+    d->updatePeriods();
+}
+
+double ModbusPollScheduler::busLoad() const
+{
+    ModbusPollSchedulerPrivate *d = d_cast(d_ptr);
+    double load = 0;
+    for (const PollItem &i : d->items)
+        load += ModbusPollSchedulerPrivate::loadOf(i, i.period);
+    return load * 100;
+}
+
+uint32_t ModbusPollScheduler::timeToNextPoll() const
+{
+    ModbusPollSchedulerPrivate *d = d_cast(d_ptr);
+    if (d->current >= 0)
+        return 0;
+    Timer tm = timer();
+    uint32_t res = static_cast<uint32_t>(-1);
+    for (const PollItem &i : d->items)
+    {
+        if (!i.polled)
+            return 0;
+        uint32_t elapsed = tm - i.timestamp;
+        if (elapsed >= i.period)
+            return 0;
+        if (i.period - elapsed < res)
+            res = i.period - elapsed;
+    }
+    return d->items.empty() ? 0 : res;
+}
+
+StatusCode ModbusPollScheduler::process()
+{
+    ModbusPollSchedulerPrivate *d = d_cast(d_ptr);
+    if (d->current < 0)
+    {
+        Timer tm = timer();
+        double max = 1;
+        for (size_t k = 0; k < d->items.size(); ++k)
+        {
+            double o = d->overdue(d->items[k], tm);
+            if (o >= max)
+            {
+                max = o;
+                d->current = static_cast<int>(k);
+            }
+        }
+        if (d->current < 0)
+            return Status_Good;
+        d->items[d->current].startUs = timerUs();
+    }
+    PollItem &i = d->items[d->current];
+    StatusCode r = i.subscription->poll();
+    if (r == Status_Processing)
+        return r;
+    d->current = -1;
+    // Note: poll is considered done on error too, so the failed item doesn't seize the bus
+    i.timestamp = timer();
+    i.polled = true;
+    if (StatusIsGood(r))
+    {
+        i.timeUs = static_cast<uint32_t>(timerUs() - i.startUs);
+        ++i.pollCount;
+        d->updateRate(i, i.subscription->changedCount() > 0);
+        d->updatePeriods();
+    }
+    return r;
+}
@@ -0,0 +1,93 @@
+/*!
+ * \file   ModbusPollScheduler.h
+ * \brief  Header file of rate-adaptive polling scheduler of Modbus subscriptions.
+ *
+ * \author serhmarch
+ * \date   October 2026
+ */
+#ifndef MODBUSPOLLSCHEDULER_H
+#define MODBUSPOLLSCHEDULER_H
+
+#include "ModbusObject.h"
+
+class ModbusSubscription;
+
+/*! \brief The `ModbusPollScheduler` class polls a set of subscriptions with periods adapted to the change rate of their data.
+
+    \details Every item of the scheduler is a `ModbusSubscription` with configured minimal and maximal poll period.
+    The scheduler keeps change rate estimate of every item (moving average of the polls that found changed data,
+    from 0 to 1) and moves the period of the item between its bounds: the item with changing data is polled
+    with minimal period and the item with static data backs off to the maximal period:
+
+    `target = periodMax - (periodMax - periodMin) * changeRate`
+
+    The scheduler also measures bus time of every poll and keeps the estimated bus load of the whole schedule
+    (sum of `pollTime / period` of all items) within the bus budget (`busBudget()`, percent of the bus time).
+    If the load of target periods exceeds the budget then all periods are stretched proportionally,
+    so the bus time is spent on the items whose data is changing. Periods never exceed `periodMax`,
+    so if the budget can't be met even with maximal periods then items are simply polled as often as the bus allows.
+
+    `process()` polls at most one item per call: the item which is the most overdue relative to its period.
+    It must be called repeatedly (e.g. in the main loop of the application).
+
+    \code{.cpp}
+    ModbusPollScheduler scheduler;
+    scheduler.addSubscription(&fastChanging, 100, 5000);
+    scheduler.addSubscription(&settings, 1000, 60000);
+    while (1)
+    {
+        scheduler.process();
+        Modbus::msleep(1);
+    }
+    \endcode
+ */
+class MODBUS_EXPORT ModbusPollScheduler : public ModbusObject
+{
+public:
+    /// \details Class constructor.
+    ModbusPollScheduler();
+
+public:
+    /// \details Adds `subscription` with poll period bounds `periodMin` and `periodMax` (milliseconds).
+    /// If `periodMax` is less than `periodMin` it is set to `periodMin` (fixed period).
+    /// Returns index of the item.
+    int addSubscription(ModbusSubscription *subscription, uint32_t periodMin, uint32_t periodMax);
+
+    /// \details Returns count of items.
+    int itemCount() const;
+
+    /// \details Returns subscription of the `item` or `nullptr` if `item` is out of range.
+    ModbusSubscription *subscription(int item) const;
+
+    /// \details Returns current poll period of the `item` (milliseconds).
+    uint32_t period(int item) const;
+
+    /// \details Returns change rate estimate of the `item` (from 0 - static data to 1 - data is changed every poll).
+    double changeRate(int item) const;
+
+    /// \details Returns measured bus time of the last poll of the `item` (microseconds).
+    uint32_t pollTimeUs(int item) const;
+
+    /// \details Returns count of completed polls of the `item`.
+    uint32_t pollCount(int item) const;
+
+    /// \details Returns bus budget of the schedule (percent of the bus time). Default is 80.
+    uint32_t busBudget() const;
+
+    /// \details Sets bus budget of the schedule (percent of the bus time, from 1 to 100).
+    void setBusBudget(uint32_t percent);
+
+    /// \details Returns estimated bus load of the schedule with current periods (percent of the bus time).
+    /// It's greater than `busBudget()` if the budget can't be met even with maximal periods of the items.
+    double busLoad() const;
+
+    /// \details Returns time to the next due poll (milliseconds) or 0 if a poll is due or in progress.
+    uint32_t timeToNextPoll() const;
+
+    /// \details Polls the most overdue item (or continues the poll in progress in non-blocking mode).
+    /// Returns `Status_Processing` while the poll is in progress, status of the poll when completed
+    /// and `Status_Good` if no item is due.
+    Modbus::StatusCode process();
+};
+
+#endif // MODBUSPOLLSCHEDULER_H
@@ -0,0 +1,90 @@
+#ifndef MODBUSPOLLSCHEDULER_P_H
+#define MODBUSPOLLSCHEDULER_P_H
+
+#include <vector>
+#include <cmath>
+
+#include "ModbusObject_p.h"
+
+#include "ModbusPollScheduler.h"
+
+namespace ModbusPollSchedulerPrivateNS {
+
+// Weight of the last poll in change rate estimate
+const double ChangeRateWeight = 0.25;
+
+struct PollItem
+{
+    ModbusSubscription *subscription;
+    uint32_t periodMin;
+    uint32_t periodMax;
+    uint32_t target;    // period by change rate only
+    uint32_t period;    // effective period (target stretched by bus budget)
+    double   rate;
+    uint32_t timeUs;
+    uint32_t pollCount;
+    Modbus::Timer timestamp;
+    uint64_t startUs;
+    bool     polled;
+};
+
+} // namespace ModbusPollSchedulerPrivateNS
+
+using namespace ModbusPollSchedulerPrivateNS;
+
+class ModbusPollSchedulerPrivate : public ModbusObjectPrivate
+{
+public:
+    ModbusPollSchedulerPrivate()
+    {
+        this->busBudget = 80;
+        this->current = -1;
+    }
+
+public:
+    inline bool isValid(int item) const { return (item >= 0) && (item < static_cast<int>(items.size())); }
+
+    // Returns time elapsed since the last poll of the item relative to its period
+    inline double overdue(const PollItem &i, Modbus::Timer tm) const
+    {
+        if (!i.polled)
+            return 1e9;
+        return static_cast<double>(tm - i.timestamp) / (i.period ? i.period : 1);
+    }
+
+    inline void updateRate(PollItem &i, bool changed)
+    {
+        i.rate += ((changed ? 1.0 : 0.0) - i.rate) * ChangeRateWeight;
+        i.target = i.periodMax - static_cast<uint32_t>((i.periodMax - i.periodMin) * i.rate + 0.5);
+    }
+
+    // Stretches target periods of all items proportionally to keep the load within the bus budget.
+    // Periods are capped at `periodMax`, so the load stays over the budget if it can't be met with maximal periods
+    inline void updatePeriods()
+    {
+        double load = 0;
+        for (const PollItem &i : items)
+            load += loadOf(i, i.target);
+        double scale = 1;
+        if (load * 100 > busBudget)
+            scale = load * 100 / busBudget;
+        for (PollItem &i : items)
+        {
+            // Note: period is rounded up, so rounding can't push the load over the budget
+            double p = std::ceil(i.target * scale);
+            i.period = (p > i.periodMax) ? i.periodMax : static_cast<uint32_t>(p);
+        }
+    }
+
+    inline static double loadOf(const PollItem &i, uint32_t period)
+    {
+        return static_cast<double>(i.timeUs) / (static_cast<double>(period ? period : 1) * 1000);
+    }
+
+public:
+    std::vector<PollItem> items;
+    uint32_t busBudget;
+    int current;
+};
+
+#endif // MODBUSPOLLSCHEDULER_P_H
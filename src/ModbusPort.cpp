@@ -52,6 +52,11 @@ void ModbusPort::setNextRequestRepeated(bool)
     // This function is used only for TCP/UDP version of the Modbus protocol.
 }
 
+uint32_t ModbusPort::syscallCount() const
+{
+    return 0;
+}
+
 const uint8_t *ModbusPort::readBufferData() const
 {
     return d_ptr->buff();
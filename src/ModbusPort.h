@@ -102,6 +102,11 @@ public:
     /// If you set `setNextRequestRepeated(true)` then the next ID will not be increased by 1 but for only one next parcel.
     virtual void setNextRequestRepeated(bool v);
 
+    /// \details Returns count of system calls made by the port since it was created (socket ports only).
+    /// It is used to measure the cost of transaction (see `ModbusClientPort::BusStatistics`).
+    /// Base implementation returns 0, so ports that don't count system calls are not included into statistics.
+    virtual uint32_t syscallCount() const;
+
 public:
     /// \details Returns `true` if the port settings have been changed and the port needs to be reopened/reestablished communication with the remote device, `false` otherwise.
     bool isChanged() const;
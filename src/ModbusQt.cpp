@@ -1,6 +1,7 @@
 #include "ModbusQt.h"
 
 #include "ModbusClientPort.h"
+#include "ModbusNetPort.h"
 #include "ModbusServerPort.h"
 #include "ModbusServerResource.h"
 #include "ModbusTcpServer.h"
@@ -25,6 +26,18 @@ Strings::Strings() :
     timeoutFirstByte  (QStringLiteral("timeoutFirstByte")),
     timeoutInterByte  (QStringLiteral("timeoutInterByte")),
     isBroadcastEnabled(QStringLiteral("isBroadcastEnabled")),
+    socketProfile     (QStringLiteral("socketProfile")),
+    tcpNoDelay        (QStringLiteral("tcpNoDelay")),
+    tcpQuickAck       (QStringLiteral("tcpQuickAck")),
+    tcpFastOpen       (QStringLiteral("tcpFastOpen")),
+    tcpUserTimeout    (QStringLiteral("tcpUserTimeout")),
+    keepAlive         (QStringLiteral("keepAlive")),
+    keepAliveIdle     (QStringLiteral("keepAliveIdle")),
+    keepAliveInterval (QStringLiteral("keepAliveInterval")),
+    keepAliveCount    (QStringLiteral("keepAliveCount")),
+    sendBufferSize    (QStringLiteral("sendBufferSize")),
+    recvBufferSize    (QStringLiteral("recvBufferSize")),
+    busyPoll          (QStringLiteral("busyPoll")),
 
     NoParity          (sparity(Modbus::NoParity   )),
     EvenParity        (sparity(Modbus::EvenParity )),
@@ -38,7 +51,10 @@ Strings::Strings() :
 
     NoFlowControl     (sflowControl(Modbus::NoFlowControl  )),
     HardwareControl   (sflowControl(Modbus::HardwareControl)),
-    SoftwareControl   (sflowControl(Modbus::SoftwareControl))
+    SoftwareControl   (sflowControl(Modbus::SoftwareControl)),
+
+    DefaultProfile    (QStringLiteral("Default")),
+    LowLatencyProfile (QStringLiteral("LowLatency"))
 {
 }
 
@@ -176,6 +192,53 @@ bool getSettingBroadcastEnabled(const Settings &s, bool *ok)
     MB_GET_SETTING_MACRO(bool, isBroadcastEnabled, v = var.toBool(); okInner = true)
 }
 
+// Note: overrides `v` by the value of `key` if it is present and valid, returns `true` in this case
+template <class T>
+static bool getSocketOption(const Settings &s, const QString &key, T &v)
+{
+    Modbus::Settings::const_iterator it = s.find(key);
+    if (it == s.end())
+        return false;
+    bool okInner;
+    uint32_t val = it.value().toUInt(&okInner); // Note: boolean value is converted to 0/1
+    if (!okInner)
+        return false;
+    v = static_cast<T>(val);
+    return true;
+}
+
+SocketOptions getSettingSocketOptions(const Settings &s, bool *ok)
+{
+    const Strings &k = Strings::instance();
+    bool okInner = false;
+    SocketOptions v = Modbus::defaultSocketOptions();
+    Modbus::Settings::const_iterator it = s.find(k.socketProfile);
+    if (it != s.end())
+    {
+        if (it.value().toString() == k.LowLatencyProfile)
+        {
+            v = Modbus::lowLatencySocketOptions();
+            okInner = true;
+        }
+        else if (it.value().toString() == k.DefaultProfile)
+            okInner = true;
+    }
+    okInner |= getSocketOption(s, k.tcpNoDelay       , v.noDelay          );
+    okInner |= getSocketOption(s, k.tcpQuickAck      , v.quickAck         );
+    okInner |= getSocketOption(s, k.tcpFastOpen      , v.fastOpen         );
+    okInner |= getSocketOption(s, k.tcpUserTimeout   , v.userTimeout      );
+    okInner |= getSocketOption(s, k.keepAlive        , v.keepAlive        );
+    okInner |= getSocketOption(s, k.keepAliveIdle    , v.keepAliveIdle    );
+    okInner |= getSocketOption(s, k.keepAliveInterval, v.keepAliveInterval);
+    okInner |= getSocketOption(s, k.keepAliveCount   , v.keepAliveCount   );
+    okInner |= getSocketOption(s, k.sendBufferSize   , v.sendBufferSize   );
+    okInner |= getSocketOption(s, k.recvBufferSize   , v.recvBufferSize   );
+    okInner |= getSocketOption(s, k.busyPoll         , v.busyPoll         );
+    if (ok)
+        *ok = okInner;
+    return v;
+}
+
 void setSettingUnit(Settings &s, uint8_t v)
 {
     s[Modbus::Strings::instance().unit] = v;
@@ -261,6 +324,22 @@ void setSettingBroadcastEnabled(Settings &s, bool v)
     s[Modbus::Strings::instance().isBroadcastEnabled] = v;
 }
 
+void setSettingSocketOptions(Settings &s, const SocketOptions &v)
+{
+    const Strings &k = Strings::instance();
+    s[k.tcpNoDelay       ] = v.noDelay != 0 ;
+    s[k.tcpQuickAck      ] = v.quickAck != 0;
+    s[k.tcpFastOpen      ] = v.fastOpen != 0;
+    s[k.tcpUserTimeout   ] = v.userTimeout      ;
+    s[k.keepAlive        ] = v.keepAlive != 0;
+    s[k.keepAliveIdle    ] = v.keepAliveIdle    ;
+    s[k.keepAliveInterval] = v.keepAliveInterval;
+    s[k.keepAliveCount   ] = v.keepAliveCount   ;
+    s[k.sendBufferSize   ] = v.sendBufferSize   ;
+    s[k.recvBufferSize   ] = v.recvBufferSize   ;
+    s[k.busyPoll         ] = v.busyPoll         ;
+}
+
 ProtocolType toProtocolType(const QString &v, bool *ok)
 {
     return enumValue<ProtocolType>(v, ok);
@@ -520,7 +599,10 @@ ModbusPort *createPort(const Settings &settings, bool blocking)
                 nc.host    = host.data();
                 nc.port    = settings.value(s.port, d.port).toUInt();
                 nc.timeout = settings.value(s.timeout, d.timeout).toUInt();
-                return Modbus::createPort(type, &nc, blocking);
+                ModbusNetPort *port = static_cast<ModbusNetPort*>(Modbus::createPort(type, &nc, blocking));
+                if (port)
+                    port->setSocketOptions(getSettingSocketOptions(settings));
+                return port;
             }
                 break;
             }
@@ -565,7 +647,9 @@ ModbusServerPort *createServerPort(ModbusInterface *device, const Settings &sett
                 net.port    = (settings.value(s.port   , d.port   ).toUInt());
                 net.timeout = (settings.value(s.timeout, d.timeout).toUInt());
                 net.maxconn = (settings.value(s.maxconn, d.maxconn).toUInt());
-                return createServer(device, type, &net, blocking);
+                ModbusTcpServer *serv = static_cast<ModbusTcpServer*>(createServer(device, type, &net, blocking));
+                serv->setSocketOptions(getSettingSocketOptions(settings));
+                return serv;
             }
                 break;
             default:
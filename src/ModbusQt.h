@@ -41,6 +41,18 @@ public:
     const QString timeoutFirstByte  ; ///< Setting key for the serial port's timeout waiting first byte of packet
     const QString timeoutInterByte  ; ///< Setting key for the serial port's timeout waiting next byte of packet
     const QString isBroadcastEnabled; ///< Setting key for the serial port enables broadcast mode for `0` unit address
+    const QString socketProfile     ; ///< Setting key for the preset of socket options (`Default` or `LowLatency`) which other socket keys override
+    const QString tcpNoDelay        ; ///< Setting key for the socket option `SocketOptions::noDelay`
+    const QString tcpQuickAck       ; ///< Setting key for the socket option `SocketOptions::quickAck`
+    const QString tcpFastOpen       ; ///< Setting key for the socket option `SocketOptions::fastOpen`
+    const QString tcpUserTimeout    ; ///< Setting key for the socket option `SocketOptions::userTimeout`
+    const QString keepAlive         ; ///< Setting key for the socket option `SocketOptions::keepAlive`
+    const QString keepAliveIdle     ; ///< Setting key for the socket option `SocketOptions::keepAliveIdle`
+    const QString keepAliveInterval ; ///< Setting key for the socket option `SocketOptions::keepAliveInterval`
+    const QString keepAliveCount    ; ///< Setting key for the socket option `SocketOptions::keepAliveCount`
+    const QString sendBufferSize    ; ///< Setting key for the socket option `SocketOptions::sendBufferSize`
+    const QString recvBufferSize    ; ///< Setting key for the socket option `SocketOptions::recvBufferSize`
+    const QString busyPoll          ; ///< Setting key for the socket option `SocketOptions::busyPoll`
 
     const QString NoParity          ; ///< String constant for repr of `NoParity` enum value
     const QString EvenParity        ; ///< String constant for repr of `EvenParity` enum value
@@ -56,6 +68,9 @@ public:
     const QString HardwareControl   ; ///< String constant for repr of `HardwareControl` enum value
     const QString SoftwareControl   ; ///< String constant for repr of `SoftwareControl` enum value
 
+    const QString DefaultProfile    ; ///< String constant for repr of default socket options profile
+    const QString LowLatencyProfile ; ///< String constant for repr of low-latency socket options profile (`Modbus::lowLatencySocketOptions()`)
+
     /// \details Constructor ot the class.
     Strings();
 
@@ -161,6 +176,10 @@ MODBUS_EXPORT uint32_t getSettingTimeoutInterByte(const Settings &s, bool *ok =
 /// If value can't be retrieved that default value is returned and *ok = false (if provided).
 MODBUS_EXPORT bool getSettingBroadcastEnabled(const Settings &s, bool *ok = nullptr);
 
+/// \details Get socket options: preset of `socketProfile` key overridden by values of other socket option keys.
+/// If no socket option key is present that default options are returned and *ok = false (if provided).
+MODBUS_EXPORT SocketOptions getSettingSocketOptions(const Settings &s, bool *ok = nullptr);
+
 /// \details Set settings value for the unit number of remote device.
 MODBUS_EXPORT void setSettingUnit(Settings &s, uint8_t v);
 
@@ -212,6 +231,9 @@ MODBUS_EXPORT void setSettingTimeoutInterByte(Settings &s, uint32_t v);
 /// \details Set settings value for the serial port enables broadcast mode for `0` unit address.
 MODBUS_EXPORT void setSettingBroadcastEnabled(Settings &s, bool v);
 
+/// \details Set settings values of all socket option keys by `v` (`socketProfile` key is not changed).
+MODBUS_EXPORT void setSettingSocketOptions(Settings &s, const SocketOptions &v);
+
 /// \details Convert String repr to Modbus::Address
 inline Address addressFromQString(const QString &s) { return Address::fromString(s); }
 
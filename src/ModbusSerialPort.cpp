@@ -51,6 +51,7 @@ void ModbusSerialPort::setBaudRate(int32_t baudRate)
     if (d->baudRate() != baudRate)
     {
         d->settings.baudRate = baudRate;
+        d->timingRefresh();
         d->setChanged(true);
     }
 }
@@ -66,6 +67,7 @@ void ModbusSerialPort::setDataBits(int8_t dataBits)
     if (d->dataBits() != dataBits)
     {
         d->settings.dataBits = dataBits;
+        d->timingRefresh();
         d->setChanged(true);
     }
 }
@@ -81,6 +83,7 @@ void ModbusSerialPort::setStopBits(StopBits stopBits)
     if (d->stopBits() != stopBits)
     {
         d->settings.stopBits = stopBits;
+        d->timingRefresh();
         d->setChanged(true);
     }
 }
@@ -96,6 +99,7 @@ void ModbusSerialPort::setParity(Parity parity)
     if (d->parity() != parity)
     {
         d->settings.parity = parity;
+        d->timingRefresh();
         d->setChanged(true);
     }
 }
@@ -128,3 +132,98 @@ void ModbusSerialPort::setTimeoutInterByte(uint32_t timeout)
         d->setChanged(true);
     }
 }
+
+bool ModbusSerialPort::isAutoTimingEnabled() const
+{
+    return d_cast(d_ptr)->isAutoTiming();
+}
+
+void ModbusSerialPort::setAutoTimingEnabled(bool enable)
+{
+    d_cast(d_ptr)->settings.autoTiming = enable;
+}
+
+uint32_t ModbusSerialPort::charTimeUs() const
+{
+    return d_cast(d_ptr)->timing.charUs;
+}
+
+uint32_t ModbusSerialPort::interCharTimeoutUs() const
+{
+    return d_cast(d_ptr)->timing.interCharUs;
+}
+
+uint32_t ModbusSerialPort::interFrameDelayUs() const
+{
+    return d_cast(d_ptr)->timing.interFrameUs;
+}
+
+bool ModbusSerialPort::isRs485Enabled() const
+{
+    return d_cast(d_ptr)->settings.rs485;
+}
+
+void ModbusSerialPort::setRs485Enabled(bool enable)
+{
+    ModbusSerialPortPrivate *d = d_cast(d_ptr);
+    if (d->settings.rs485 != enable)
+    {
+        d->settings.rs485 = enable;
+        d->setChanged(true);
+    }
+}
+
+uint32_t ModbusSerialPort::rs485DelayRtsBeforeSend() const
+{
+    return d_cast(d_ptr)->settings.rs485DelayRtsBeforeSend;
+}
+
+void ModbusSerialPort::setRs485DelayRtsBeforeSend(uint32_t delay)
+{
+    ModbusSerialPortPrivate *d = d_cast(d_ptr);
+    if (d->settings.rs485DelayRtsBeforeSend != delay)
+    {
+        d->settings.rs485DelayRtsBeforeSend = delay;
+        d->setChanged(true);
+    }
+}
+
+uint32_t ModbusSerialPort::rs485DelayRtsAfterSend() const
+{
+    return d_cast(d_ptr)->settings.rs485DelayRtsAfterSend;
+}
+
+void ModbusSerialPort::setRs485DelayRtsAfterSend(uint32_t delay)
+{
+    ModbusSerialPortPrivate *d = d_cast(d_ptr);
+    if (d->settings.rs485DelayRtsAfterSend != delay)
+    {
+        d->settings.rs485DelayRtsAfterSend = delay;
+        d->setChanged(true);
+    }
+}
+
+bool ModbusSerialPort::isLowLatency() const
+{
+    return d_cast(d_ptr)->settings.lowLatency;
+}
+
+void ModbusSerialPort::setLowLatency(bool enable)
+{
+    ModbusSerialPortPrivate *d = d_cast(d_ptr);
+    if (d->settings.lowLatency != enable)
+    {
+        d->settings.lowLatency = enable;
+        d->setChanged(true);
+    }
+}
+
+uint32_t ModbusSerialPort::turnaroundDelay() const
+{
+    return d_cast(d_ptr)->settings.turnaroundDelay;
+}
+
+void ModbusSerialPort::setTurnaroundDelay(uint32_t delay)
+{
+    d_cast(d_ptr)->settings.turnaroundDelay = delay;
+}
@@ -28,7 +28,7 @@
     - Complete serial port lifecycle management (open, close, state checking)
     - Configuration for all standard serial parameters (9600 8N1, etc.)
     - Dual timeout mechanism: first byte timeout and inter-byte timeout
-    - Support for various baud rates (1200 to 115200 and beyond)
+    - Support for various baud rates (1200 to 4000000 and arbitrary non-standard rates where OS allows it)
     - Support for various data formats (5-8 data bits, parity options, stop bits)
     - Flow control options (None, Hardware, Software)
     - Buffer access methods for protocol implementation
@@ -51,6 +51,10 @@
        (typically longer to account for server processing time)
     2. timeoutInterByte: Maximum time between consecutive bytes within a packet
        (typically shorter to detect transmission errors quickly)
+
+    With automatic timing enabled (`setAutoTimingEnabled()`) inter-byte timeout is replaced
+    by Modbus t3.5 inter-frame delay calculated from serial line parameters with microsecond
+    resolution, and the same gap is kept before each transmission.
     
     This dual-timeout approach ensures robust communication while minimizing
     latency in error detection and recovery.
@@ -82,6 +86,8 @@ public: // settings
     int32_t baudRate() const;
 
     /// \details Set current serial port baud rate.
+    /// Non-standard rates are applied via `termios2`/`BOTHER` on Linux.
+    /// If the rate can not be applied `open()` fails with `Status_BadSerialOpen`.
     void setBaudRate(int32_t baudRate);
 
     /// \details Returns current serial port data bits, e.g. 5, 6, 7 or 8.
@@ -120,6 +126,65 @@ public: // settings
     /// \details Set current serial port timeout of waiting next byte (inter byte waiting tgimeout) of incomming packet (in milliseconds).
     void setTimeoutInterByte(uint32_t timeout);
 
+    /// \details Returns `true` if automatic character timing is enabled, `false` otherwise (default).
+    /// \sa `setAutoTimingEnabled()`
+    bool isAutoTimingEnabled() const;
+
+    /// \details Enables/disables automatic character timing. When enabled, end of incoming packet is detected
+    /// by inter-frame silence t3.5 calculated from current baud rate, data bits, parity and stop bits
+    /// (instead of `timeoutInterByte`) and t3.5 gap is kept between last bus activity and next transmission.
+    void setAutoTimingEnabled(bool enable);
+
+    /// \details Returns time of transmission of one character (in microseconds) for current serial port settings.
+    /// When port is open the value is calculated for the baud rate actually applied by the driver.
+    uint32_t charTimeUs() const;
+
+    /// \details Returns inter-character time-out t1.5 (in microseconds) for current serial port settings.
+    uint32_t interCharTimeoutUs() const;
+
+    /// \details Returns inter-frame delay t3.5 (in microseconds) for current serial port settings.
+    uint32_t interFrameDelayUs() const;
+
+    /// \details Returns `true` if kernel RS-485 mode is enabled, `false` otherwise (default).
+    /// \sa `setRs485Enabled()`
+    bool isRs485Enabled() const;
+
+    /// \details Enables/disables kernel RS-485 mode: RTS line (transmitter enable) is driven by the driver
+    /// (`TIOCSRS485` on Linux, `RTS_CONTROL_TOGGLE` on Windows) instead of user code.
+    /// On Linux `open()` fails with `Status_BadSerialOpen` if the driver does not support RS-485 mode.
+    /// On Windows there is no way to check the support: `open()` fails only if `SetCommState()` rejects
+    /// `RTS_CONTROL_TOGGLE`, a driver that accepts it silently leaves RTS line as is. RTS delays are not used on Windows.
+    void setRs485Enabled(bool enable);
+
+    /// \details Returns delay (in milliseconds) between RTS assert and start of transmission in RS-485 mode.
+    uint32_t rs485DelayRtsBeforeSend() const;
+
+    /// \details Set delay (in milliseconds) between RTS assert and start of transmission in RS-485 mode (Linux only).
+    void setRs485DelayRtsBeforeSend(uint32_t delay);
+
+    /// \details Returns delay (in milliseconds) between end of transmission and RTS release in RS-485 mode.
+    uint32_t rs485DelayRtsAfterSend() const;
+
+    /// \details Set delay (in milliseconds) between end of transmission and RTS release in RS-485 mode (Linux only).
+    void setRs485DelayRtsAfterSend(uint32_t delay);
+
+    /// \details Returns `true` if low latency mode of the UART driver is requested, `false` otherwise (default).
+    bool isLowLatency() const;
+
+    /// \details Requests low latency mode of the UART driver (`ASYNC_LOW_LATENCY` on Linux):
+    /// received bytes are pushed to the reader immediately instead of being batched by the driver.
+    /// The setting is a hint: it is silently ignored if the driver does not support it. It has no effect on Windows.
+    void setLowLatency(bool enable);
+
+    /// \details Returns bus turnaround delay (in microseconds).
+    /// \sa `setTurnaroundDelay()`
+    uint32_t turnaroundDelay() const;
+
+    /// \details Set bus turnaround delay (in microseconds): minimum time between last bus activity
+    /// (end of received packet or own transmission) and next transmission. Default is 0.
+    /// Used for half-duplex devices that need time to switch their transceiver back to receive.
+    void setTurnaroundDelay(uint32_t delay);
+
 public:
     Modbus::StatusCode write() override;
     Modbus::StatusCode read() override;
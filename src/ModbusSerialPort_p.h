@@ -23,6 +23,16 @@ public:
         settings.flowControl      = d.flowControl;
         settingsBase.timeout      = d.timeoutFirstByte;
         settings.timeoutInterByte = d.timeoutInterByte;
+        settings.autoTiming       = false;
+        settings.rs485            = false;
+        settings.rs485DelayRtsBeforeSend = 0;
+        settings.rs485DelayRtsAfterSend  = 0;
+        settings.lowLatency       = false;
+        settings.turnaroundDelay  = 0;
+        activityTimestamp         = 0;
+        inputResyncRequired       = true;
+        inputResyncTimestamp      = 0;
+        timingRefresh();
     }
 
 public: // settings
@@ -34,6 +44,72 @@ public: // settings
     inline FlowControl flowControl() const { return settings.flowControl; }
     inline uint32_t timeoutFirstByte() const { return settingsBase.timeout; }
     inline uint32_t timeoutInterByte() const { return settings.timeoutInterByte; }
+    inline bool isAutoTiming() const { return settings.autoTiming; }
+    inline bool isRs485() const { return settings.rs485; }
+    inline bool isLowLatency() const { return settings.lowLatency; }
+
+public: // timing
+    inline void timingRefresh() { timingRefresh(settings.baudRate); }
+
+    // Note: `baudRate` is the rate actually applied to the device (can differ from requested one)
+    inline void timingRefresh(int32_t baudRate)
+    {
+        timing.charUs       = serialCharTimeUs        (baudRate, settings.dataBits, settings.parity, settings.stopBits);
+        timing.interCharUs  = serialInterCharTimeoutUs(baudRate, settings.dataBits, settings.parity, settings.stopBits);
+        timing.interFrameUs = serialInterFrameDelayUs (baudRate, settings.dataBits, settings.parity, settings.stopBits);
+    }
+
+    // Note: last bus activity is the time of last received byte or expected end of transmission
+    inline void activityRefresh() { activityTimestamp = timerUs(); }
+    inline void activityTransmitted(uint32_t bytes) { activityTimestamp = timerUs() + static_cast<uint64_t>(bytes) * timing.charUs; }
+
+    // Returns time (in microseconds) left until the minimum gap before transmit
+    // (t3.5 for automatic timing and/or bus turnaround delay) is elapsed
+    inline uint32_t transmitDelayUs() const
+    {
+        uint32_t gap = settings.turnaroundDelay;
+        if (isAutoTiming() && timing.interFrameUs > gap)
+            gap = timing.interFrameUs;
+        if (gap == 0)
+            return 0;
+        uint64_t tm = timerUs();
+        uint64_t end = activityTimestamp + gap;
+        return (tm < end) ? static_cast<uint32_t>(end - tm) : 0;
+    }
+
+    // Returns `true` if inter-frame silence (t3.5 for automatic timing or `timeoutInterByte` otherwise) is elapsed
+    inline bool isFrameSilenceElapsed(Timer timestamp) const
+    {
+        if (isAutoTiming())
+            return timerUs() - activityTimestamp >= timing.interFrameUs;
+        return timer() - timestamp >= timeoutInterByte();
+    }
+
+    // Returns time (in microseconds) left until t3.5 silence after last bus activity is elapsed
+    inline uint32_t resyncDelayUs() const
+    {
+        uint64_t tm = timerUs();
+        uint64_t end = activityTimestamp + timing.interFrameUs;
+        return (tm < end) ? static_cast<uint32_t>(end - tm) : 0;
+    }
+
+    // Note: input is resynchronized before transmit only when previous exchange left it in unknown state
+    // (port was just opened, read failed or no response was received). Server never resynchronizes input
+    // because it can contain beginning of the next request
+    inline void inputCheck(StatusCode status)
+    {
+        if (!modeServer() && (StatusIsBad(status) || (StatusIsGood(status) && buffSize() == 0)))
+            inputResyncRequest();
+    }
+
+    inline void inputResyncRequest() { inputResyncRequired = true; inputResyncTimestamp = timer(); }
+
+    // Returns `true` if stale input can't delay transmit anymore: t3.5 silence (frame boundary) after
+    // last received byte is detected or first byte timeout is elapsed (continuous noise on the bus)
+    inline bool isInputResynced() const
+    {
+        return (resyncDelayUs() == 0) || (timer() - inputResyncTimestamp >= timeoutFirstByte());
+    }
     
 public:
     struct
@@ -45,7 +121,23 @@ public:
         StopBits stopBits;
         FlowControl flowControl;
         uint32_t timeoutInterByte;
+        bool autoTiming;
+        bool rs485;
+        uint32_t rs485DelayRtsBeforeSend;
+        uint32_t rs485DelayRtsAfterSend;
+        bool lowLatency;
+        uint32_t turnaroundDelay;
     } settings;
+
+    struct
+    {
+        uint32_t charUs;
+        uint32_t interCharUs;
+        uint32_t interFrameUs;
+    } timing;
+    uint64_t activityTimestamp;
+    bool inputResyncRequired;
+    Timer inputResyncTimestamp;
 };
 
 #endif // MODBUSSERIALPORT_P_H
@@ -23,6 +23,8 @@
 #include "ModbusServerResource.h"
 #include "ModbusServerResource_p.h"
 
+#include "ModbusAscFrame_p.h"
+
 inline ModbusServerResourcePrivate *d_cast(ModbusObjectPrivate *d_ptr) { return static_cast<ModbusServerResourcePrivate*>(d_ptr); }
 
 ModbusServerResource::ModbusServerResource(ModbusPort *port, ModbusInterface *device) :
@@ -36,6 +38,16 @@ ModbusPort *ModbusServerResource::port() const
     return d_cast(d_ptr)->port;
 }
 
+void ModbusServerResource::reset()
+{
+    ModbusServerResourcePrivate *d = d_cast(d_ptr);
+    d->state = STATE_UNKNOWN;
+    d->cmdClose = false;
+    d->timestamp = 0;
+    d->lastStatus = Status_Uncertain;
+    d->setPortError(d->port->lastErrorStatus());
+}
+
 ProtocolType ModbusServerResource::type() const
 {
     return d_cast(d_ptr)->port->type();
@@ -783,6 +795,8 @@ StatusCode ModbusServerResource::processDevice()
 #ifndef MBF_DIAGNOSTICS_CHANGE_ASCII_INPUT_DELIMITER_DISABLE
         case MBF_DIAGNOSTICS_CHANGE_ASCII_INPUT_DELIMITER:
             r = d->device->diagnosticsChangeAsciiInputDelimiter(d->unit, static_cast<char>(d->valueBuff[0]));
+            if (StatusIsGood(r))
+                setPortAsciiInputDelimiter(d->port, static_cast<char>(d->valueBuff[0]));
             break;
 #endif // MBF_DIAGNOSTICS_CHANGE_ASCII_INPUT_DELIMITER_DISABLE
 
@@ -83,6 +83,10 @@ public:
     /// \details Returns pointer to inner port which was previously passed in constructor.
     ModbusPort *port() const;
 
+    /// \details Resets the processing state of the resource to initial one, so it can be reused
+    /// after inner port was reopened (e.g. got new socket). Settings and signal connections are kept.
+    void reset();
+
 public: // server port interface
     /// \details Returns type of Modbus protocol. Same as `port()->type()`.
     Modbus::ProtocolType type() const override;
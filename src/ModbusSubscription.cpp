@@ -0,0 +1,164 @@
+#include "ModbusSubscription.h"
+#include "ModbusSubscription_p.h"
+
+#include "ModbusClient.h"
+
+using namespace Modbus;
+
+static inline ModbusSubscriptionPrivate *d_cast(ModbusObjectPrivate *d_ptr) { return static_cast<ModbusSubscriptionPrivate*>(d_ptr); }
+
+ModbusSubscription::ModbusSubscription(ModbusClient *client, MemoryType memoryType, uint16_t offset, uint16_t count) :
+    ModbusObject(new ModbusSubscriptionPrivate(client, memoryType, offset, count))
+{
+}
+
+ModbusClient *ModbusSubscription::client() const
+{
+    return d_cast(d_ptr)->client;
+}
+
+MemoryType ModbusSubscription::memoryType() const
+{
+    return d_cast(d_ptr)->memoryType;
+}
+
+uint16_t ModbusSubscription::offset() const
+{
+    return d_cast(d_ptr)->offset;
+}
+
+uint16_t ModbusSubscription::count() const
+{
+    return d_cast(d_ptr)->count;
+}
+
+const void *ModbusSubscription::values() const
+{
+    return d_cast(d_ptr)->image.data();
+}
+
+bool ModbusSubscription::isChanged(uint16_t offset) const
+{
+    ModbusSubscriptionPrivate *d = d_cast(d_ptr);
+    uint16_t i = offset - d->offset;
+    if (i >= d->count)
+        return false;
+    return d->isChanged(i);
+}
+
+uint32_t ModbusSubscription::changedCount() const
+{
+    return d_cast(d_ptr)->changedCount;
+}
+
+int ModbusSubscription::addTag(uint16_t offset, TagType type, DeadbandType deadbandType, double deadband)
+{
+    ModbusSubscriptionPrivate *d = d_cast(d_ptr);
+    uint32_t size = 1;
+    if (!d->bits && ((type == TagUInt32) || (type == TagInt32) || (type == TagFloat32)))
+        size = 2;
+    if ((offset < d->offset) || (static_cast<uint32_t>(offset - d->offset) + size > d->count))
+        return -1;
+    Tag t;
+    t.index = offset - d->offset;
+    t.type = type;
+    t.deadbandType = deadbandType;
+    t.deadband = deadband;
+    t.value = d->initialized ? d->tagRawValue(t) : 0;
+    d->tags.push_back(t);
+    return static_cast<int>(d->tags.size()) - 1;
+}
+
+int ModbusSubscription::tagCount() const
+{
+    return static_cast<int>(d_cast(d_ptr)->tags.size());
+}
+
+double ModbusSubscription::tagValue(int tag) const
+{
+    ModbusSubscriptionPrivate *d = d_cast(d_ptr);
+    if ((tag < 0) || (tag >= static_cast<int>(d->tags.size())))
+        return 0;
+    return d->tags[tag].value;
+}
+
+void ModbusSubscription::reset()
+{
+    d_cast(d_ptr)->initialized = false;
+}
+
+StatusCode ModbusSubscription::poll()
+{
+    ModbusSubscriptionPrivate *d = d_cast(d_ptr);
+    StatusCode r;
+    switch (d->memoryType)
+    {
+#ifndef MBF_READ_COILS_DISABLE
+    case Memory_0x:
+        r = d->client->readCoilsRange(d->offset, d->count, d->buffer.data());
+        break;
+#endif // MBF_READ_COILS_DISABLE
+#ifndef MBF_READ_DISCRETE_INPUTS_DISABLE
+    case Memory_1x:
+        r = d->client->readDiscreteInputsRange(d->offset, d->count, d->buffer.data());
+        break;
+#endif // MBF_READ_DISCRETE_INPUTS_DISABLE
+#ifndef MBF_READ_INPUT_REGISTERS_DISABLE
+    case Memory_3x:
+        r = d->client->readInputRegistersRange(d->offset, d->count, d->buffer.data());
+        break;
+#endif // MBF_READ_INPUT_REGISTERS_DISABLE
+#ifndef MBF_READ_HOLDING_REGISTERS_DISABLE
+    case Memory_4x:
+        r = d->client->readHoldingRegistersRange(d->offset, d->count, d->buffer.data());
+        break;
+#endif // MBF_READ_HOLDING_REGISTERS_DISABLE
+    default:
+        return Status_BadIllegalFunction;
+    }
+    if (!StatusIsGood(r))
+        return r;
+
+    const bool first = !d->initialized;
+    d->compare();
+    d->initialized = true;
+    if (!d->changedCount)
+        return r;
+
+    for (uint32_t i = 0; i < d->count; )
+    {
+        if (!d->isChanged(static_cast<uint16_t>(i)))
+        {
+            ++i;
+            continue;
+        }
+        uint32_t begin = i;
+        while ((i < d->count) && d->isChanged(static_cast<uint16_t>(i)))
+            ++i;
+        signalRangeChanged(objectName(), static_cast<uint16_t>(d->offset + begin), static_cast<uint16_t>(i - begin));
+    }
+
+    for (size_t i = 0; i < d->tags.size(); ++i)
+    {
+        Tag &t = d->tags[i];
+        if (!d->isTagChanged(t))
+            continue;
+        double value = d->tagRawValue(t);
+        if (d->isOutOfDeadband(t, value, first))
+        {
+            t.value = value;
+            signalTagChanged(objectName(), static_cast<int>(i), value);
+        }
+    }
+    return r;
+}
+
+void ModbusSubscription::signalRangeChanged(const Char *source, uint16_t offset, uint16_t count)
+{
+    emitSignal(__func__, &ModbusSubscription::signalRangeChanged, source, offset, count);
+}
+
+void ModbusSubscription::signalTagChanged(const Char *source, int tag, double value)
+{
+    emitSignal(__func__, &ModbusSubscription::signalTagChanged, source, tag, value);
+}
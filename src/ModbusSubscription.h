@@ -0,0 +1,123 @@
+/*!
+ * \file   ModbusSubscription.h
+ * \brief  Header file of Modbus client subscription with change detection.
+ *
+ * \author serhmarch
+ * \date   October 2026
+ */
+#ifndef MODBUSSUBSCRIPTION_H
+#define MODBUSSUBSCRIPTION_H
+
+#include "ModbusObject.h"
+
+class ModbusClient;
+
+/*! \brief The `ModbusSubscription` class polls the block of the remote device memory and notifies only about changed values.
+
+    \details `ModbusSubscription` reads the block (`offset`, `count`) of the memory type `memoryType`
+    of the remote device using `ModbusClient` range functions (so the block is not limited by one request)
+    and keeps the last image of the block. Every successful `poll()` compares new values with the image
+    (8 bytes per step, so the unchanged parts of the block are skipped fast), builds the bitmap
+    of changed elements (`isChanged()`) and emits:
+    - `signalRangeChanged()` for every contiguous range of changed elements;
+    - `signalTagChanged()` for every tag whose value is changed more than its deadband.
+
+    Tag is typed value of the registers block (16-bit or 32-bit integer or 32-bit float).
+    32-bit tags occupy two registers, the first register contains the most significant word.
+    Tag of the coils/discrete inputs block is a bit value (0 or 1) and its type is ignored.
+    Deadband is applied to the last notified value of the tag:
+    - `DeadbandNone` - any change is notified;
+    - `DeadbandAbsolute` - change is notified if `|value - last| > deadband`;
+    - `DeadbandPercent` - change is notified if `|value - last| > |last| * deadband / 100`.
+
+    The first successful poll (and the first poll after `reset()`) reports all elements and tags as changed.
+
+    \code{.cpp}
+    ModbusClient client(1, port);
+    ModbusSubscription sub(&client, Modbus::Memory_4x, 0, 500);
+    int t = sub.addTag(10, ModbusSubscription::TagFloat32, ModbusSubscription::DeadbandAbsolute, 0.5);
+    sub.connect(&ModbusSubscription::signalTagChanged, onTagChanged);
+    while (1)
+    {
+        sub.poll();
+        Modbus::msleep(100);
+    }
+    \endcode
+ */
+class MODBUS_EXPORT ModbusSubscription : public ModbusObject
+{
+public:
+    /// \brief Type of the tag value
+    enum TagType
+    {
+        TagUInt16   , ///< Unsigned 16-bit integer (one register)
+        TagInt16    , ///< Signed 16-bit integer (one register)
+        TagUInt32   , ///< Unsigned 32-bit integer (two registers)
+        TagInt32    , ///< Signed 32-bit integer (two registers)
+        TagFloat32    ///< 32-bit IEEE 754 float (two registers)
+    };
+
+    /// \brief Type of the tag deadband
+    enum DeadbandType
+    {
+        DeadbandNone    , ///< Any change of the value is notified
+        DeadbandAbsolute, ///< Change is notified if it is greater than deadband value
+        DeadbandPercent   ///< Change is notified if it is greater than deadband percent of the last notified value
+    };
+
+public:
+    /// \details Class constructor.
+    /// \param[in] client Client object which is used to read the block of the remote device.
+    /// \param[in] memoryType Memory type of the block (`Memory_0x`, `Memory_1x`, `Memory_3x` or `Memory_4x`).
+    /// \param[in] offset Offset of the first element of the block.
+    /// \param[in] count Count of elements of the block.
+    ModbusSubscription(ModbusClient *client, Modbus::MemoryType memoryType, uint16_t offset, uint16_t count);
+
+public:
+    /// \details Returns a pointer to the client object which is used to read the block.
+    ModbusClient *client() const;
+
+    /// \details Returns memory type of the block.
+    Modbus::MemoryType memoryType() const;
+
+    /// \details Returns offset of the first element of the block.
+    uint16_t offset() const;
+
+    /// \details Returns count of elements of the block.
+    uint16_t count() const;
+
+    /// \details Returns the last image of the block: `uint16_t` array for registers and packed bits for coils/discrete inputs.
+    const void *values() const;
+
+    /// \details Returns `true` if element with absolute `offset` was changed by the last successful poll.
+    bool isChanged(uint16_t offset) const;
+
+    /// \details Returns count of elements changed by the last successful poll.
+    uint32_t changedCount() const;
+
+    /// \details Adds tag with absolute `offset` of the block. Returns index of the tag or -1 if tag is out of the block.
+    int addTag(uint16_t offset, TagType type, DeadbandType deadbandType = DeadbandNone, double deadband = 0);
+
+    /// \details Returns count of tags.
+    int tagCount() const;
+
+    /// \details Returns the last notified value of the `tag`.
+    double tagValue(int tag) const;
+
+    /// \details Forgets the image of the block, so the next successful poll reports all elements and tags as changed.
+    void reset();
+
+    /// \details Reads the block of the remote device and notifies about changes.
+    /// Returns `Status_Processing` while reading is in progress (non-blocking mode) and status of the reading when completed.
+    /// The image of the block is not changed if reading is failed.
+    Modbus::StatusCode poll();
+
+public: // SIGNALS
+    /// \details Calls each callback of the subscription for every contiguous range of changed elements.
+    void signalRangeChanged(const Modbus::Char *source, uint16_t offset, uint16_t count);
+
+    /// \details Calls each callback of the subscription when value of the `tag` is changed more than its deadband.
+    void signalTagChanged(const Modbus::Char *source, int tag, double value);
+};
+
+#endif // MODBUSSUBSCRIPTION_H
@@ -0,0 +1,170 @@
+#ifndef MODBUSSUBSCRIPTION_P_H
+#define MODBUSSUBSCRIPTION_P_H
+
+#include <vector>
+#include <cstring>
+#include <cmath>
+
+#include "ModbusObject_p.h"
+
+#include "ModbusSubscription.h"
+
+namespace ModbusSubscriptionPrivateNS {
+
+struct Tag
+{
+    uint16_t index; // index of the first element in the block
+    ModbusSubscription::TagType type;
+    ModbusSubscription::DeadbandType deadbandType;
+    double deadband;
+    double value;
+};
+
+// Count of elements compared by one 64-bit step
+inline uint16_t elementsPerWord(bool bits) { return bits ? 64 : 4; }
+
+inline uint32_t bitCount(uint64_t x)
+{
+    uint32_t c = 0;
+    for (; x; ++c)
+        x &= x - 1;
+    return c;
+}
+
+} // namespace ModbusSubscriptionPrivateNS
+
+using namespace ModbusSubscriptionPrivateNS;
+
+class ModbusSubscriptionPrivate : public ModbusObjectPrivate
+{
+public:
+    ModbusSubscriptionPrivate(ModbusClient *client, Modbus::MemoryType memoryType, uint16_t offset, uint16_t count)
+    {
+        this->client = client;
+        this->memoryType = memoryType;
+        this->offset = offset;
+        this->count = count;
+        this->bits = (memoryType == Modbus::Memory_0x) || (memoryType == Modbus::Memory_1x);
+        this->initialized = false;
+        this->changedCount = 0;
+        // Note: every buffer is rounded up to the whole count of 64-bit words
+        size_t words = (count + elementsPerWord(bits) - 1) / elementsPerWord(bits);
+        this->image.assign(words * 4, 0);
+        this->buffer.assign(words * 4, 0);
+        this->changed.assign(((words * elementsPerWord(bits) + 63) / 64) * 8, 0);
+    }
+
+public:
+    inline bool isChanged(uint16_t i) const { return (changed[i / 8] & static_cast<uint8_t>(1 << (i % 8))) != 0; }
+
+    // Compares new values of the `buffer` with the `image`, builds `changed` bitmap and swaps `buffer` and `image`
+    inline void compare()
+    {
+        const size_t words = image.size() / 4;
+        memset(changed.data(), 0, changed.size());
+        changedCount = 0;
+        for (size_t w = 0; w < words; ++w)
+        {
+            uint64_t a, b;
+            memcpy(&a, &image[w * 4], sizeof(a));
+            memcpy(&b, &buffer[w * 4], sizeof(b));
+            uint64_t x = initialized ? (a ^ b) : ~static_cast<uint64_t>(0);
+            if (!x)
+                continue;
+            if (bits)
+                memcpy(&changed[w * 8], &x, sizeof(x)); // Note: byte order of the packed bits is kept by memcpy
+            else
+            {
+                uint8_t m = 0;
+                for (int i = 0; i < 4; ++i)
+                {
+                    if (!initialized || (image[w * 4 + i] != buffer[w * 4 + i]))
+                        m |= static_cast<uint8_t>(1 << i);
+                }
+                changed[w / 2] |= static_cast<uint8_t>(m << ((w % 2) * 4));
+            }
+        }
+        // Note: clear padding elements beyond the block
+        for (uint32_t i = count; i < changed.size() * 8; ++i)
+            changed[i / 8] &= static_cast<uint8_t>(~(1 << (i % 8)));
+        for (size_t i = 0; i < changed.size(); i += 8)
+        {
+            uint64_t x;
+            memcpy(&x, &changed[i], sizeof(x));
+            changedCount += bitCount(x);
+        }
+        image.swap(buffer);
+    }
+
+    inline bool isTagChanged(const Tag &t) const
+    {
+        switch (t.type)
+        {
+        case ModbusSubscription::TagUInt32:
+        case ModbusSubscription::TagInt32:
+        case ModbusSubscription::TagFloat32:
+            if (!bits)
+                return isChanged(t.index) || isChanged(t.index + 1);
+            return isChanged(t.index);
+        default:
+            return isChanged(t.index);
+        }
+    }
+
+    inline double tagRawValue(const Tag &t) const
+    {
+        if (bits)
+            return (reinterpret_cast<const uint8_t*>(image.data())[t.index / 8] & static_cast<uint8_t>(1 << (t.index % 8))) ? 1 : 0;
+        uint32_t v32 = (static_cast<uint32_t>(image[t.index]) << 16);
+        switch (t.type)
+        {
+        case ModbusSubscription::TagInt16:
+            return static_cast<int16_t>(image[t.index]);
+        case ModbusSubscription::TagUInt32:
+            return v32 | image[t.index + 1];
+        case ModbusSubscription::TagInt32:
+            return static_cast<int32_t>(v32 | image[t.index + 1]);
+        case ModbusSubscription::TagFloat32:
+        {
+            float f;
+            v32 |= image[t.index + 1];
+            memcpy(&f, &v32, sizeof(f));
+            return f;
+        }
+        default:
+            return image[t.index];
+        }
+    }
+
+    // Returns `true` if `value` of the tag `t` must be notified
+    inline bool isOutOfDeadband(const Tag &t, double value, bool first) const
+    {
+        if (first)
+            return true;
+        double diff = std::fabs(value - t.value);
+        switch (t.deadbandType)
+        {
+        case ModbusSubscription::DeadbandAbsolute:
+            return diff > t.deadband;
+        case ModbusSubscription::DeadbandPercent:
+            return diff > std::fabs(t.value) * t.deadband / 100;
+        default:
+            return diff != 0;
+        }
+    }
+
+public:
+    ModbusClient *client;
+    Modbus::MemoryType memoryType;
+    uint16_t offset;
+    uint16_t count;
+    bool bits;
+    bool initialized;
+    uint32_t changedCount;
+    std::vector<uint16_t> image;
+    std::vector<uint16_t> buffer;
+    std::vector<uint8_t> changed;
+    std::vector<Tag> tags;
+};
+
+#endif // MODBUSSUBSCRIPTION_P_H
@@ -31,3 +31,8 @@ void ModbusTcpPort::setTransactionId(uint16_t id)
 {
     d_net(d_ptr->frame)->transaction = id;
 }
+
+uint32_t ModbusTcpPort::staleResponseCount() const
+{
+    return d_net(d_ptr->frame)->staleCount;
+}
@@ -25,6 +25,13 @@ class ModbusSocket;
 
     Both blocking and non-blocking socket modes are supported through inherited construction
     parameters, allowing applications to choose the most suitable I/O strategy.
+
+    Partially sent frames are kept in the output queue of the connection and the rest is sent when
+    the socket becomes writable, so frames are never truncated. Queued bytes and the next frame are
+    sent by one gathering call. Non-blocking client `write()` returns `Status_Processing` until the
+    request is sent. Server connection doesn't wait for the response to be sent while the queue is within
+    `MB_TCP_OUTPUT_QUEUE_SZ` bytes and continues to read next requests, so slow client doesn't stall
+    processing; the queue is flushed by the next `read()`/`write()`.
  */
 
 class MODBUS_EXPORT ModbusTcpPortBase : public ModbusNetPort
@@ -36,6 +43,17 @@ public:
     bool isOpen() const override;
     Modbus::StatusCode write() override;
     Modbus::StatusCode read() override;
+    uint32_t syscallCount() const override;
+
+public:
+    /// \details Returns count of bytes of written frames which are not sent yet because socket buffer was full.
+    uint32_t outputQueueSize() const;
+
+    /// \details Replaces the socket of the port by connected `socket` and resets the state of the port.
+    /// The port takes ownership of `socket`, previous socket is closed and returned,
+    /// so the caller owns it then and can reuse it for another connection.
+    /// Used by `ModbusTcpServer` to reuse port and its buffers for new connection.
+    ModbusSocket *replaceSocket(ModbusSocket *socket);
 
 protected:
     using ModbusNetPort::ModbusNetPort;
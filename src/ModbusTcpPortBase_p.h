@@ -1,15 +1,64 @@
 #ifndef MODBUSTCPPORTBASE_P_H
 #define MODBUSTCPPORTBASE_P_H
 
+#include <vector>
+
 #include "ModbusNetPort_p.h"
 
+// Size of the output queue (bytes) within which server connection doesn't wait for the response to be sent
+#define MB_TCP_OUTPUT_QUEUE_SZ 4096
+
+// Output queue of TCP connection: bytes of written frames which were not accepted by `send()` yet.
+// Memory of the queue is kept after it is emptied, so it is allocated only once for the connection.
+class ModbusOutputQueue
+{
+public:
+    ModbusOutputQueue() : m_head(0) {}
+
+public:
+    inline bool isEmpty() const { return m_head == m_data.size(); }
+    inline size_t size() const { return m_data.size() - m_head; }
+    inline const uint8_t *data() const { return m_data.data() + m_head; }
+    inline void clear() { m_data.clear(); m_head = 0; }
+
+    // Removes `sent` bytes sent from the queue followed by `buff`, the rest of `buff` is appended to the queue
+    inline void consume(size_t sent, const uint8_t *buff, size_t sz)
+    {
+        size_t q = size();
+        if (sent < q)
+        {
+            m_head += sent;
+            m_data.insert(m_data.end(), buff, buff + sz);
+            return;
+        }
+        clear();
+        sent -= q;
+        if (sent < sz)
+            m_data.insert(m_data.end(), buff + sent, buff + sz);
+    }
+
+private:
+    std::vector<uint8_t> m_data;
+    size_t m_head;
+};
+
 class ModbusTcpPortBasePrivate : public ModbusNetPortPrivate
 {
 public:
     static ModbusTcpPortBasePrivate *create(ModbusFramePrivate *f, ModbusSocket *socket, bool blocking);
 
 public:
-    using ModbusNetPortPrivate::ModbusNetPortPrivate;
+    ModbusTcpPortBasePrivate(ModbusFramePrivate *f, bool blocking) :
+        ModbusNetPortPrivate(f, blocking)
+    {
+        this->local = false;
+        this->seqpacket = false;
+    }
+
+public:
+    ModbusOutputQueue outq;
+    bool local;     // Unix domain socket: `host` is path of the socket, `port` isn't used
+    bool seqpacket; // Unix domain socket of `SOCK_SEQPACKET` type: every frame is sent as one message
 };
 
 #endif // MODBUSTCPPORTBASE_P_H
\ No newline at end of file
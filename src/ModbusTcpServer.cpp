@@ -26,6 +26,7 @@
 #include "ModbusTcpPort.h"
 #include "ModbusAscOverTcpPort.h"
 #include "ModbusRtuOverTcpPort.h"
+#include "ModbusUnixPort.h"
 #include "ModbusServerResource.h"
 
 #define MODBUS_TCPSERVER_OPEN_TIMOUT_ms 1000
@@ -36,7 +37,8 @@ ModbusTcpServer::Defaults::Defaults() :
     ipaddr (StringLiteral("0.0.0.0")),
     port   (STANDARD_TCP_PORT),
     timeout(3000),
-    maxconn(10)
+    maxconn(10),
+    backlog(128)
 {
 }
 
@@ -80,8 +82,8 @@ void ModbusTcpServer::setTimeout(uint32_t timeout)
 {
     ModbusTcpServerPrivate *d = d_cast(d_ptr);
     d->timeout = timeout;
-    for (auto& c : d->connections)
-        c->setTimeout(timeout);
+    for (Connection *c = d->connections.first; c; c = c->next)
+        c->resource->setTimeout(timeout);
 }
 
 uint32_t ModbusTcpServer::maxConnections() const
@@ -97,6 +99,36 @@ void ModbusTcpServer::setMaxConnections(uint32_t maxconn)
         d_cast(d_ptr)->maxconn = 1;
 }
 
+uint32_t ModbusTcpServer::backlog() const
+{
+    return d_cast(d_ptr)->backlog;
+}
+
+void ModbusTcpServer::setBacklog(uint32_t backlog)
+{
+    d_cast(d_ptr)->backlog = backlog;
+}
+
+uint32_t ModbusTcpServer::connectionCount() const
+{
+    return d_cast(d_ptr)->connections.count;
+}
+
+uint32_t ModbusTcpServer::pooledConnectionCount() const
+{
+    return d_cast(d_ptr)->pool.count;
+}
+
+const SocketOptions &ModbusTcpServer::socketOptions() const
+{
+    return d_cast(d_ptr)->sockopt;
+}
+
+void ModbusTcpServer::setSocketOptions(const SocketOptions &options)
+{
+    d_cast(d_ptr)->sockopt = options;
+}
+
 ProtocolType ModbusTcpServer::type() const
 {
     return d_cast(d_ptr)->type;
@@ -106,35 +138,40 @@ void ModbusTcpServer::setBroadcastEnabled(bool enable)
 {
     ModbusServerPort::setBroadcastEnabled(enable);
     ModbusTcpServerPrivate *d = d_cast(d_ptr);
-    for (auto& c : d->connections)
-        c->setBroadcastEnabled(enable);
+    for (Connection *c = d->connections.first; c; c = c->next)
+        c->resource->setBroadcastEnabled(enable);
 }
 
 void ModbusTcpServer::setUnitMap(const void *unitmap)
 {
     ModbusServerPort::setUnitMap(unitmap);
     ModbusTcpServerPrivate *d = d_cast(d_ptr);
-    for (auto& c : d->connections)
-        c->setUnitMap(unitmap);
+    for (Connection *c = d->connections.first; c; c = c->next)
+        c->resource->setUnitMap(unitmap);
 }
 
 void ModbusTcpServer::setUnitEnabled(uint8_t unit, bool enable)
 {
     ModbusServerPort::setUnitEnabled(unit, enable);
     ModbusTcpServerPrivate *d = d_cast(d_ptr);
-    for (auto& c : d->connections)
-        c->setUnitEnabled(unit, enable);
+    for (Connection *c = d->connections.first; c; c = c->next)
+        c->resource->setUnitEnabled(unit, enable);
 }
 
 void ModbusTcpServer::clearConnections()
 {
     ModbusTcpServerPrivate *d = d_cast(d_ptr);
-    for (auto& c : d->connections)
+    while (Connection *c = d->connections.takeFirst())
+    {
+        signalCloseConnection(c->resource->objectName());
+        delete c->resource;
+        delete c;
+    }
+    while (Connection *c = d->pool.takeFirst())
     {
-        signalCloseConnection(c->objectName());
+        delete c->resource;
         delete c;
     }
-    d->connections.clear();
 }
 
 StatusCode ModbusTcpServer::process()
@@ -187,6 +224,8 @@ StatusCode ModbusTcpServer::process()
             d->state = STATE_CLOSED;
             signalClosed(d->getName());
             clearConnections();
+            if (d->changed)
+                d->cmdClose = false;
             //setMessage("Finalized");
             break;
         case STATE_OPENED:
@@ -197,44 +236,71 @@ StatusCode ModbusTcpServer::process()
         {
             if (d->cmdClose)
             {
+                d->changed = false;
                 d->state = STATE_WAIT_FOR_CLOSE;
                 fRepeatAgain = true;
                 break;
             }
-            // check up new connection
-            if (ModbusSocket *s = this->nextPendingConnection())
+            // Note: socket settings are changed, so the server is closed and then opened with new settings
+            if (d->changed)
             {
-                ModbusPort *p = createModbusPort(s);
-                p->setTimeout(timeout());
-                ModbusServerResource *c = new ModbusServerResource(p, device());
+                d->state = STATE_WAIT_FOR_CLOSE;
+                fRepeatAgain = true;
+                break;
+            }
+            // accept all pending connections
+            while (ModbusSocket *s = this->nextPendingConnection())
+            {
+                Connection *c = d->pool.takeFirst();
+                if (c)
+                    d->releaseSocket(static_cast<ModbusTcpPortBase*>(c->resource->port())->replaceSocket(s));
+                else
+                {
+                    c = new Connection;
+                    c->resource = new ModbusServerResource(createModbusPort(s), device());
+                    c->resource->connect(&ModbusServerPort::signalTx       , static_cast<ModbusServerPort*>(this), &ModbusTcpServer::signalTx   );
+                    c->resource->connect(&ModbusServerPort::signalRx       , static_cast<ModbusServerPort*>(this), &ModbusTcpServer::signalRx   );
+                    c->resource->connect(&ModbusServerPort::signalError    , this, &ModbusTcpServer::setErrorInner    );
+                    c->resource->connect(&ModbusServerPort::signalCompleted, this, &ModbusTcpServer::setCompletedInner);
+                }
+                ModbusServerResource *res = c->resource;
+                res->setTimeout(timeout());
+                res->setBroadcastEnabled(isBroadcastEnabled());
+                res->setUnitMap(unitMap());
                 String host, service;
                 if (ModbusTcpServerPrivate::getHostService(s, host, service))
                 {
                     String name = host + StringLiteral(":") + service;
-                    c->setObjectName(name.data());
+                    res->setObjectName(name.data());
                 }
-                c->connect(&ModbusServerPort::signalTx       , static_cast<ModbusServerPort*>(this), &ModbusTcpServer::signalTx   );
-                c->connect(&ModbusServerPort::signalRx       , static_cast<ModbusServerPort*>(this), &ModbusTcpServer::signalRx   );
-                c->connect(&ModbusServerPort::signalError    , this, &ModbusTcpServer::setErrorInner    );
-                c->connect(&ModbusServerPort::signalCompleted, this, &ModbusTcpServer::setCompletedInner);
-                c->setBroadcastEnabled(isBroadcastEnabled());
-                c->setUnitMap(unitMap());
-                d->connections.push_back(c);
-                signalNewConnection(c->objectName());
+                else
+                    res->setObjectName(StringLiteral(""));
+                d->connections.append(c);
+                signalNewConnection(res->objectName());
             }
             // process current connections
-            for (Connections_t::iterator it = d->connections.begin(); it != d->connections.end(); )
+            for (Connection *c = d->connections.first; c; )
             {
-                ModbusServerPort *c = *it;
-                c->process();
-                if (!c->isOpen())
+                Connection *next = c->next;
+                ModbusServerResource *res = c->resource;
+                res->process();
+                if (!res->isOpen())
                 {
-                    signalCloseConnection(c->objectName());
-                    it = d->connections.erase(it);
-                    delete c;
-                    continue;
+                    signalCloseConnection(res->objectName());
+                    d->connections.remove(c);
+                    // Note: only ports which socket can be replaced are reused
+                    if ((d->pool.count < d->maxconn) && dynamic_cast<ModbusTcpPortBase*>(res->port()))
+                    {
+                        res->reset();
+                        d->pool.append(c);
+                    }
+                    else
+                    {
+                        delete res;
+                        delete c;
+                    }
                 }
-                ++it;
+                c = next;
             }
         }
             break;
@@ -267,6 +333,8 @@ ModbusPort *ModbusTcpServer::createModbusPort(ModbusSocket *socket)
         return new ModbusAscOverTcpPort(socket);
     case Modbus::RTUvTCP:
         return new ModbusRtuOverTcpPort(socket);
+    case Modbus::UNIX:
+        return new ModbusUnixPort(socket, d_cast(d_ptr)->seqpacket);
     default:
         return new ModbusTcpPort(socket);
     }
@@ -28,6 +28,10 @@ class ModbusSocket;
     
     Key features:
     - Automatic connection management with configurable maximum connections limit
+    - All pending connections are accepted in one `process()` call, so a reconnect burst (e.g. after network
+      failure) is drained at once; the listen queue length is set separately by `setBacklog()`
+    - Closed connection objects (`ModbusServerResource`, port and its buffers) are kept in a pool and reused
+      for new connections instead of being reallocated
     - Non-blocking operation suitable for single-threaded event loops
     - Virtual methods `createTcpPort()` and `deleteTcpPort()` allow customization of connection handling
     - Signals for connection events: `signalNewConnection()`, `signalCloseConnection()`
@@ -93,6 +97,7 @@ public:
         const uint16_t      port   ; ///< Default setting 'TCP port number' for the listening server
         const uint32_t      timeout; ///< Default setting for the read timeout of every single conncetion
         const uint32_t      maxconn; ///< Default setting for the maximum number of simultaneous connections to the server
+        const uint32_t      backlog; ///< Default setting for the length of the queue of pending connections
 
         /// \details Constructor of the class.
         Defaults();
@@ -133,6 +138,26 @@ public:
     ///  \details Sets the setting for the maximum number of simultaneous connections to the server.
     void setMaxConnections(uint32_t maxconn);
 
+    ///  \details Returns setting for the length of the queue of pending (not yet accepted) connections.
+    uint32_t backlog() const;
+
+    ///  \details Sets the length of the queue of pending connections (`listen()` backlog), applied on next `open()`.
+    /// 0 means system maximum (`SOMAXCONN`). Note that system may limit this value (e.g. `net.core.somaxconn` on Linux).
+    void setBacklog(uint32_t backlog);
+
+    ///  \details Returns count of currently established connections.
+    uint32_t connectionCount() const;
+
+    ///  \details Returns count of closed connection objects kept for reuse by new connections.
+    uint32_t pooledConnectionCount() const;
+
+    ///  \details Returns options applied to the sockets of accepted connections.
+    const Modbus::SocketOptions &socketOptions() const;
+
+    ///  \details Sets options applied to the sockets of accepted connections (e.g. `Modbus::lowLatencySocketOptions()`).
+    /// Already accepted connections keep their options. `fastOpen` is applied to the listening socket on `open()`.
+    void setSocketOptions(const Modbus::SocketOptions &options);
+
 public:
     /// \details Returns the Modbus protocol type. In this case it is `Modbus::TCP`.
     Modbus::ProtocolType type() const override;
@@ -179,9 +204,12 @@ public: // SIGNALS
 
 protected:
     /// \details Checks for incoming connections and returns pointer `ModbusSocket` if new connection established, `nullptr` otherwise.
+    /// Connections over the `maxConnections()` limit are not accepted: they wait in the listen queue
+    /// until one of the current connections is closed.
+    /// `process()` calls this function until it returns `nullptr`.
     virtual ModbusSocket *nextPendingConnection();
 
-    /// \details Clear all allocated memory for previously established connections.
+    /// \details Clear all allocated memory for previously established connections and pooled connection objects.
     void clearConnections();
 
 protected:
@@ -1,14 +1,68 @@
 #ifndef MODBUSTCPSERVER_P_H
 #define MODBUSTCPSERVER_P_H
 
-#include <list>
-
 #include "ModbusTcpServer.h"
 #include "ModbusServerPort_p.h"
+#include "ModbusServerResource.h"
 
 namespace ModbusTcpServerPrivateNS {
 
-typedef std::list<ModbusServerPort*> Connections_t;
+// Connection object: it is allocated once and then moved between the list of active connections
+// and the pool of closed connections, so open/close of the connection doesn't allocate memory
+struct Connection
+{
+    ModbusServerResource *resource;
+    Connection *prev;
+    Connection *next;
+};
+
+// Intrusive doubly linked list of connections with O(1) insertion and removal
+class Connections_t
+{
+public:
+    Connections_t() : first(nullptr), last(nullptr), count(0) {}
+
+public:
+    inline void append(Connection *c)
+    {
+        c->prev = last;
+        c->next = nullptr;
+        if (last)
+            last->next = c;
+        else
+            first = c;
+        last = c;
+        ++count;
+    }
+
+    inline void remove(Connection *c)
+    {
+        if (c->prev)
+            c->prev->next = c->next;
+        else
+            first = c->next;
+        if (c->next)
+            c->next->prev = c->prev;
+        else
+            last = c->prev;
+        c->prev = nullptr;
+        c->next = nullptr;
+        --count;
+    }
+
+    inline Connection *takeFirst()
+    {
+        Connection *c = first;
+        if (c)
+            remove(c);
+        return c;
+    }
+
+public:
+    Connection *first;
+    Connection *last;
+    uint32_t count;
+};
 
 } // namespace ModbusTcpServerPrivateNS
 
@@ -19,6 +73,10 @@ class ModbusTcpServerPrivate : public ModbusServerPortPrivate
 public:
     static bool getHostService(ModbusSocket *socket, String &host, String &service);
 
+public:
+    // Keeps closed `socket` object to be reused by the next accepted connection
+    void releaseSocket(ModbusSocket *socket);
+
 public:
     ModbusTcpServerPrivate(Modbus::ProtocolType type, ModbusInterface *device) :
         ModbusServerPortPrivate(device)
@@ -29,6 +87,7 @@ public:
         {
         case Modbus::ASCvTCP:
         case Modbus::RTUvTCP:
+        case Modbus::UNIX:
             this->type = type;
             break;
         default:
@@ -36,19 +95,35 @@ public:
             break;
         }
 
-        this->ipaddr  = d.ipaddr ;
+        // Note: Unix domain server has no default path, bind address of TCP server isn't valid socket path
+        if (this->type != Modbus::UNIX)
+            this->ipaddr = d.ipaddr;
         this->tcpPort = d.port   ;
         this->timeout = d.timeout;
         this->maxconn = d.maxconn;
+        this->backlog = d.backlog;
+        this->sockopt = Modbus::defaultSocketOptions();
+        this->seqpacket = MB_UNIX_SEQPACKET_DEFAULT;
+        this->spareSocket = nullptr;
+        this->changed = false;
     }
 
+public:
+    inline bool isLocal() const { return this->type == Modbus::UNIX; }
+
 public:
     Modbus::ProtocolType type;
     String   ipaddr ;
     uint16_t tcpPort;
     uint32_t timeout;
     uint32_t maxconn;
+    uint32_t backlog;
+    Modbus::SocketOptions sockopt;
+    bool seqpacket; // type of Unix domain socket (`ipaddr` is path of the socket)
+    bool changed; // socket settings are changed, so open server is reopened by `process()`
     Connections_t connections;
+    Connections_t pool; // closed connections kept for reuse
+    ModbusSocket *spareSocket; // socket object of reused connection kept for the next accepted connection
 };
 
 #endif // MODBUSTCPSERVER_P_H
@@ -0,0 +1,293 @@
+#include "ModbusUdpMultiClient.h"
+#include "ModbusUdpMultiClient_p.h"
+
+#include "ModbusNetFrame_p.h"
+#include "ModbusRtuFrame_p.h"
+#include "ModbusAscFrame_p.h"
+
+ModbusFramePrivate *ModbusUdpMultiClientPrivate::createFrame() const
+{
+    switch (type)
+    {
+    case RTUvUDP:
+        return new ModbusRtuFramePrivate();
+    case ASCvUDP:
+        return new ModbusAscFramePrivate();
+    default:
+        return new ModbusNetFramePrivate();
+    }
+}
+
+bool ModbusUdpMultiClientPrivate::receiveReply(int i, const uint8_t *data, uint16_t sz)
+{
+    Target &t = targets[i];
+    if ((t.state != TargetWaiting) || (sz > t.frame->c_buffSz))
+        return false;
+    memcpy(t.frame->buff, data, sz);
+    t.frame->sz = sz;
+    uint8_t unit, func;
+    uint16_t szData = 0;
+    // Note: reply with wrong transaction id, unit or function belongs to other target with the same address
+    // or to the abandoned request, so it's not accepted
+    if (StatusIsBad(t.frame->readBuffer(unit, func, t.data, sizeof(t.data), &szData)))
+        return false;
+    if ((unit != t.unit) || ((func & ~MBF_EXCEPTION) != t.func))
+        return false;
+    t.state = TargetCompleted;
+    t.szData = szData;
+    if ((func & MBF_EXCEPTION) == MBF_EXCEPTION)
+    {
+        if (szData > 0)
+        {
+            const size_t len = 62;
+            Char errbuff[len];
+            snprintf(errbuff, len, StringLiteral("Returned Modbus-exception with code 0x%hhX"), t.data[0]);
+            t.status = static_cast<StatusCode>(Status_Bad | t.data[0]);
+            t.errorText = errbuff;
+        }
+        else
+        {
+            t.status = Status_BadNotCorrectResponse;
+            t.errorText = StringLiteral("Returned Modbus-exception but code missed");
+        }
+        t.szData = 0;
+    }
+    else
+    {
+        t.status = Status_Good;
+        t.errorText.clear();
+    }
+    return true;
+}
+
+void ModbusUdpMultiClientPrivate::checkTimeouts()
+{
+    Timer tm = timer();
+    for (size_t i = 0; i < targets.size(); i++)
+    {
+        Target &t = targets[i];
+        if ((t.state == TargetWaiting) && (tm - t.timestamp >= t.timeout))
+            complete(static_cast<int>(i), Status_BadUdpReadTimeout, StringLiteral("UDP. Error while reading from '") + t.host + StringLiteral(":") + toModbusString(t.port) +
+                                                                    StringLiteral("'. Timeout"));
+    }
+}
+
+void ModbusUdpMultiClientPrivate::failPending(StatusCode status, const String &text)
+{
+    for (size_t i = 0; i < targets.size(); i++)
+    {
+        TargetState s = targets[i].state;
+        if ((s == TargetQueued) || (s == TargetWaiting))
+            complete(static_cast<int>(i), status, text);
+    }
+}
+
+static inline ModbusUdpMultiClientPrivate *d_cast(ModbusObjectPrivate *d_ptr) { return static_cast<ModbusUdpMultiClientPrivate*>(d_ptr); }
+
+ModbusUdpMultiClient::ModbusUdpMultiClient(ProtocolType type) :
+    ModbusObject(ModbusUdpMultiClientPrivate::create(type))
+{
+}
+
+ModbusUdpMultiClient::~ModbusUdpMultiClient()
+{
+    close();
+}
+
+ProtocolType ModbusUdpMultiClient::type() const
+{
+    return d_cast(d_ptr)->type;
+}
+
+int ModbusUdpMultiClient::addTarget(const Char *host, uint16_t port, uint8_t unit)
+{
+    ModbusUdpMultiClientPrivate *d = d_cast(d_ptr);
+    Target t;
+    t.host = host;
+    t.port = port;
+    t.unit = unit;
+    t.timeout = NetDefaults::instance().timeout;
+    t.resolved = false;
+    t.frame = d->createFrame();
+    t.state = TargetIdle;
+    t.func = 0;
+    t.timestamp = 0;
+    t.status = Status_Uncertain;
+    t.szData = 0;
+    // Note: socket is not reopened, so requests to other targets are not interrupted.
+    // Address of the new target is resolved by `process()` when its first request is queued
+    d->targets.push_back(t);
+    return static_cast<int>(d->targets.size()) - 1;
+}
+
+int ModbusUdpMultiClient::targetCount() const
+{
+    return static_cast<int>(d_cast(d_ptr)->targets.size());
+}
+
+const Char *ModbusUdpMultiClient::host(int target) const
+{
+    ModbusUdpMultiClientPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(target))
+        return nullptr;
+    return d->targets[target].host.data();
+}
+
+uint16_t ModbusUdpMultiClient::port(int target) const
+{
+    ModbusUdpMultiClientPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(target))
+        return 0;
+    return d->targets[target].port;
+}
+
+uint8_t ModbusUdpMultiClient::unit(int target) const
+{
+    ModbusUdpMultiClientPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(target))
+        return 0;
+    return d->targets[target].unit;
+}
+
+uint32_t ModbusUdpMultiClient::timeout(int target) const
+{
+    ModbusUdpMultiClientPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(target))
+        return 0;
+    return d->targets[target].timeout;
+}
+
+void ModbusUdpMultiClient::setTimeout(int target, uint32_t timeout)
+{
+    ModbusUdpMultiClientPrivate *d = d_cast(d_ptr);
+    if (d->isValid(target))
+        d->targets[target].timeout = timeout;
+}
+
+bool ModbusUdpMultiClient::isPending(int target) const
+{
+    ModbusUdpMultiClientPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(target))
+        return false;
+    TargetState s = d->targets[target].state;
+    return (s == TargetQueued) || (s == TargetWaiting);
+}
+
+int ModbusUdpMultiClient::pendingCount() const
+{
+    int c = 0;
+    for (int i = 0; i < targetCount(); i++)
+    {
+        if (isPending(i))
+            ++c;
+    }
+    return c;
+}
+
+StatusCode ModbusUdpMultiClient::lastStatus(int target) const
+{
+    ModbusUdpMultiClientPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(target))
+        return Status_Uncertain;
+    return d->targets[target].status;
+}
+
+const Char *ModbusUdpMultiClient::lastErrorText(int target) const
+{
+    ModbusUdpMultiClientPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(target))
+        return d->errorText.data();
+    return d->targets[target].errorText.data();
+}
+
+StatusCode ModbusUdpMultiClient::request(int target, uint8_t func, const uint8_t *buff, uint16_t szInBuff, uint8_t *outBuff, uint16_t maxSzOutBuff, uint16_t *szOutBuff)
+{
+    ModbusUdpMultiClientPrivate *d = d_cast(d_ptr);
+    if (!d->isValid(target))
+        return Status_BadNotCorrectRequest;
+    Target &t = d->targets[target];
+    switch (t.state)
+    {
+    case TargetIdle:
+    {
+        if (d->type != RTUvUDP && d->type != ASCvUDP)
+        {
+            ModbusNetFramePrivate *f = d_net(t.frame);
+            f->transaction = ++d->transaction;
+            f->autoIncrement = false;
+        }
+        StatusCode r = t.frame->writeBuffer(t.unit, func, buff, szInBuff);
+        if (StatusIsBad(r))
+        {
+            t.status = r;
+            t.errorText = t.frame->lastErrorText();
+            return r;
+        }
+        t.func = func;
+        t.state = TargetQueued;
+        t.timestamp = timer();
+        return Status_Processing;
+    }
+    case TargetQueued:
+    case TargetWaiting:
+        return Status_Processing;
+    default:
+        t.state = TargetIdle;
+        if (StatusIsGood(t.status))
+        {
+            uint16_t sz = t.szData < maxSzOutBuff ? t.szData : maxSzOutBuff;
+            memcpy(outBuff, t.data, sz);
+            *szOutBuff = sz;
+        }
+        return t.status;
+    }
+}
+
+void ModbusUdpMultiClient::cancelRequest(int target)
+{
+    ModbusUdpMultiClientPrivate *d = d_cast(d_ptr);
+    if (d->isValid(target))
+        d->targets[target].state = TargetIdle;
+}
+
+#ifndef MBF_READ_HOLDING_REGISTERS_DISABLE
+StatusCode ModbusUdpMultiClient::readHoldingRegisters(int target, uint16_t offset, uint16_t count, uint16_t *values)
+{
+    const uint16_t szBuff = 300;
+    uint8_t buff[szBuff];
+    uint16_t szOutBuff;
+    buff[0] = reinterpret_cast<uint8_t*>(&offset)[1]; // Start register offset - MS BYTE
+    buff[1] = reinterpret_cast<uint8_t*>(&offset)[0]; // Start register offset - LS BYTE
+    buff[2] = reinterpret_cast<uint8_t*>(&count)[1];  // Quantity - MS BYTE
+    buff[3] = reinterpret_cast<uint8_t*>(&count)[0];  // Quantity - LS BYTE
+    StatusCode r = request(target, MBF_READ_HOLDING_REGISTERS, buff, 4, buff, szBuff, &szOutBuff);
+    if (!StatusIsGood(r))
+        return r;
+    if ((szOutBuff == 0) || (buff[0] != szOutBuff - 1) || (buff[0] != count * 2))
+        return Status_BadNotCorrectResponse;
+    for (uint16_t i = 0; i < count; i++)
+        values[i] = static_cast<uint16_t>((buff[1 + i * 2] << 8) | buff[2 + i * 2]);
+    return Status_Good;
+}
+#endif // MBF_READ_HOLDING_REGISTERS_DISABLE
+
+#ifndef MBF_READ_INPUT_REGISTERS_DISABLE
+StatusCode ModbusUdpMultiClient::readInputRegisters(int target, uint16_t offset, uint16_t count, uint16_t *values)
+{
+    const uint16_t szBuff = 300;
+    uint8_t buff[szBuff];
+    uint16_t szOutBuff;
+    buff[0] = reinterpret_cast<uint8_t*>(&offset)[1]; // Start register offset - MS BYTE
+    buff[1] = reinterpret_cast<uint8_t*>(&offset)[0]; // Start register offset - LS BYTE
+    buff[2] = reinterpret_cast<uint8_t*>(&count)[1];  // Quantity - MS BYTE
+    buff[3] = reinterpret_cast<uint8_t*>(&count)[0];  // Quantity - LS BYTE
+    StatusCode r = request(target, MBF_READ_INPUT_REGISTERS, buff, 4, buff, szBuff, &szOutBuff);
+    if (!StatusIsGood(r))
+        return r;
+    if ((szOutBuff == 0) || (buff[0] != szOutBuff - 1) || (buff[0] != count * 2))
+        return Status_BadNotCorrectResponse;
+    for (uint16_t i = 0; i < count; i++)
+        values[i] = static_cast<uint16_t>((buff[1 + i * 2] << 8) | buff[2 + i * 2]);
+    return Status_Good;
+}
+#endif // MBF_READ_INPUT_REGISTERS_DISABLE
@@ -0,0 +1,142 @@
+/*!
+ * \file   ModbusUdpMultiClient.h
+ * \brief  Header file of the UDP client that polls many devices through one socket.
+ *
+ * \author serhmarch
+ * \date   October 2026
+ */
+#ifndef MODBUSUDPMULTICLIENT_H
+#define MODBUSUDPMULTICLIENT_H
+
+#include "ModbusObject.h"
+
+/*! \brief The `ModbusUdpMultiClient` class sends requests to many UDP devices through one socket concurrently.
+
+    \details Every `ModbusUdpPort` has its own socket and only one outstanding request, so a fleet of UDP devices
+    needs a port per device and devices are polled one request at a time. `ModbusUdpMultiClient` has one socket
+    for all devices (targets). Every target is defined by host, port and unit address and can have one outstanding
+    request, so requests to all targets are in progress at the same time.
+
+    `process()` sends all queued requests (by one `sendmmsg()` call on Linux), receives all available replies
+    (by `recvmmsg()` on Linux) and checks the timeout of every target. A reply is passed to the targets with the same
+    source address and is accepted by the one whose request it matches: transaction id (UDP), unit and function.
+    Replies from unknown peers and late replies to cancelled or timed out requests are dropped.
+    If the client has only one target its socket is connected, so the kernel filters datagrams of other peers.
+
+    Request functions are non-blocking and are called repeatedly with the same parameters (the same as
+    non-blocking `ModbusClientPort`): the first call queues the request and returns `Status_Processing`,
+    the call after the request is completed returns its status.
+
+    Protocol type can be `UDP` (MBAP header), `RTUvUDP` or `ASCvUDP`.
+
+    \code{.cpp}
+    ModbusUdpMultiClient client;
+    for (int i = 0; i < meterCount; i++)
+        client.addTarget(meters[i].host, 502, 1);
+    while (1)
+    {
+        for (int i = 0; i < client.targetCount(); i++)
+        {
+            Modbus::StatusCode s = client.readHoldingRegisters(i, 0, 10, values[i]);
+            if (s != Modbus::Status_Processing)
+                handleResult(i, s, values[i]);
+        }
+        client.process();
+        Modbus::msleep(1);
+    }
+    \endcode
+ */
+class MODBUS_EXPORT ModbusUdpMultiClient : public ModbusObject
+{
+public:
+    /// \details Constructor of the client with protocol `type` (`UDP`, `RTUvUDP` or `ASCvUDP`, other types are treated as `UDP`).
+    ModbusUdpMultiClient(Modbus::ProtocolType type = Modbus::UDP);
+
+    /// \details Destructor of the client. Closes the socket.
+    ~ModbusUdpMultiClient();
+
+public:
+    /// \details Returns protocol type of the client.
+    Modbus::ProtocolType type() const;
+
+    /// \details Adds target device with `host`, `port` and `unit` address. Returns index of the target.
+    /// Timeout of the target is set to the default timeout of network ports.
+    /// Target can be added to the open client: the socket isn't reopened and requests in progress are not affected.
+    /// Address of the target is resolved by `process()` when the first request to the target is queued.
+    int addTarget(const Modbus::Char *host, uint16_t port, uint8_t unit);
+
+    /// \details Returns count of targets.
+    int targetCount() const;
+
+    /// \details Returns host of the `target`.
+    const Modbus::Char *host(int target) const;
+
+    /// \details Returns port of the `target`.
+    uint16_t port(int target) const;
+
+    /// \details Returns unit address of the `target`.
+    uint8_t unit(int target) const;
+
+    /// \details Returns response timeout of the `target` (milliseconds).
+    uint32_t timeout(int target) const;
+
+    /// \details Sets response timeout of the `target` (milliseconds).
+    void setTimeout(int target, uint32_t timeout);
+
+    /// \details Returns `true` if the request of the `target` is queued or waits for reply.
+    bool isPending(int target) const;
+
+    /// \details Returns count of targets with queued or waiting requests.
+    int pendingCount() const;
+
+    /// \details Returns status of the last completed request of the `target`.
+    Modbus::StatusCode lastStatus(int target) const;
+
+    /// \details Returns text of the last error of the `target` (or of the socket if `target` is out of range).
+    const Modbus::Char *lastErrorText(int target = -1) const;
+
+public:
+    /// \details Returns native socket handle of the client.
+    Modbus::Handle handle() const;
+
+    /// \details Returns count of system calls made by the socket of the client.
+    uint32_t syscallCount() const;
+
+    /// \details Returns `true` if the socket is open.
+    bool isOpen() const;
+
+    /// \details Opens the socket. Addresses of targets are resolved later by `process()`.
+    Modbus::StatusCode open();
+
+    /// \details Closes the socket. Pending requests are failed with `Status_BadPortClosed`.
+    /// Addresses of targets are resolved again after the socket is reopened.
+    Modbus::StatusCode close();
+
+    /// \details Resolves addresses of targets with queued requests, sends queued requests, receives available replies
+    /// and checks timeouts of waiting requests. Opens the socket if it's closed. Returns `Status_Good` or error status of `open()`.
+    /// Failed address resolution fails only the request of its target with `Status_BadUdpCreate`
+    /// (on Unix the host name is resolved by background thread, so other targets are not delayed by DNS).
+    /// The socket is connected to the target if the client has only one target and its address is resolved.
+    Modbus::StatusCode process();
+
+public:
+    /// \details Queues request of Modbus function `func` with data `buff` of size `szInBuff` to the `target`.
+    /// Returns `Status_Processing` while the request is queued or waits for reply. When the request is completed
+    /// returns its status and copies response data (without unit and function) into `outBuff`.
+    Modbus::StatusCode request(int target, uint8_t func, const uint8_t *buff, uint16_t szInBuff, uint8_t *outBuff, uint16_t maxSzOutBuff, uint16_t *szOutBuff);
+
+    /// \details Cancels the request of the `target`. Late reply to the cancelled request is dropped.
+    void cancelRequest(int target);
+
+#ifndef MBF_READ_HOLDING_REGISTERS_DISABLE
+    /// \details Function for read holding (output) 16-bit registers (function code 0x03) of the `target`.
+    Modbus::StatusCode readHoldingRegisters(int target, uint16_t offset, uint16_t count, uint16_t *values);
+#endif // MBF_READ_HOLDING_REGISTERS_DISABLE
+
+#ifndef MBF_READ_INPUT_REGISTERS_DISABLE
+    /// \details Function for read input 16-bit registers (function code 0x04) of the `target`.
+    Modbus::StatusCode readInputRegisters(int target, uint16_t offset, uint16_t count, uint16_t *values);
+#endif // MBF_READ_INPUT_REGISTERS_DISABLE
+};
+
+#endif // MODBUSUDPMULTICLIENT_H
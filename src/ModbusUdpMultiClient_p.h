@@ -0,0 +1,94 @@
+#ifndef MODBUSUDPMULTICLIENT_P_H
+#define MODBUSUDPMULTICLIENT_P_H
+
+#include <vector>
+
+#include "ModbusObject_p.h"
+#include "ModbusFrame_p.h"
+
+#include "ModbusUdpMultiClient.h"
+
+namespace ModbusUdpMultiClientPrivateNS {
+
+enum TargetState
+{
+    TargetIdle     , // no request
+    TargetQueued   , // request is encoded and waits to be sent
+    TargetWaiting  , // request is sent and waits for reply
+    TargetCompleted  // reply is received (or request is failed) and waits to be taken by request function
+};
+
+struct Target
+{
+    String host;
+    uint16_t port;
+    uint8_t unit;
+    uint32_t timeout;
+    bool resolved; // address of the target is resolved and added to the peers of the socket
+    ModbusFramePrivate *frame; // encodes request and decodes reply of the target
+    TargetState state;
+    uint8_t func;
+    Timer timestamp; // time when request is queued (limits address resolution) and then sent
+    StatusCode status;
+    String errorText;
+    uint8_t data[MB_VALUE_BUFF_SZ+1];
+    uint16_t szData;
+};
+
+} // namespace ModbusUdpMultiClientPrivateNS
+
+using namespace ModbusUdpMultiClientPrivateNS;
+
+class ModbusUdpMultiClientPrivate : public ModbusObjectPrivate
+{
+public:
+    static ModbusUdpMultiClientPrivate *create(ProtocolType type);
+
+public:
+    ModbusUdpMultiClientPrivate(ProtocolType type) :
+        type(type),
+        transaction(0)
+    {
+    }
+
+    ~ModbusUdpMultiClientPrivate()
+    {
+        for (Target &t : targets)
+            delete t.frame;
+    }
+
+public:
+    inline bool isValid(int i) const { return (i >= 0) && (i < static_cast<int>(targets.size())); }
+
+    inline StatusCode setError(StatusCode status, String &&text) { errorText = text; return status; }
+
+    // Completes request of the target `i` with `status`
+    inline void complete(int i, StatusCode status, const String &text)
+    {
+        Target &t = targets[i];
+        t.state = TargetCompleted;
+        t.status = status;
+        t.errorText = text;
+        t.szData = 0;
+    }
+
+    ModbusFramePrivate *createFrame() const;
+
+    // Decodes `data` received from the address of the target `i`.
+    // Returns `true` if it's the reply to the waiting request of the target
+    bool receiveReply(int i, const uint8_t *data, uint16_t sz);
+
+    // Fails waiting requests which timeout is elapsed
+    void checkTimeouts();
+
+    // Fails all queued and waiting requests with `status`
+    void failPending(StatusCode status, const String &text);
+
+public:
+    ProtocolType type;
+    std::vector<Target> targets;
+    uint16_t transaction; // Note: transaction ids are unique within the client, so targets with the same address can be distinguished
+    String errorText;
+};
+
+#endif // MODBUSUDPMULTICLIENT_P_H
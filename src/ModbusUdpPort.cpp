@@ -26,3 +26,8 @@ void ModbusUdpPort::setTransactionId(uint16_t id)
 {
     d_net(d_ptr->frame)->transaction = id;
 }
+
+uint32_t ModbusUdpPort::staleResponseCount() const
+{
+    return d_net(d_ptr->frame)->staleCount;
+}
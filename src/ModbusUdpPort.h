@@ -59,6 +59,10 @@ public:
     /// \details Sets the transaction identifier for the next request.
     void setTransactionId(uint16_t id);
 
+    /// \details Returns count of late responses to abandoned requests (with previous transaction identifiers)
+    /// that were dropped while waiting for the response to the current request.
+    uint32_t staleResponseCount() const;
+
 protected:
     using ModbusUdpPortBase::ModbusUdpPortBase;
 };
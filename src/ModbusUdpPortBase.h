@@ -38,6 +38,17 @@ public:
     bool isOpen() const override;
     Modbus::StatusCode write() override;
     Modbus::StatusCode read() override;
+    uint32_t syscallCount() const override;
+
+public:
+    /// \details Returns maximum count of datagrams received or sent by one system call in server mode.
+    uint32_t batchSize() const;
+
+    /// \details Sets maximum count of datagrams received or sent by one system call in server mode (default is 32).
+    /// Server port receives a batch of requests (`recvmmsg()`), each request keeps the address of its peer,
+    /// and replies are sent by one call (`sendmmsg()`) when all received requests are processed.
+    /// Value 1 disables batching. Batching is supported on Linux, on other systems datagrams are processed one by one.
+    void setBatchSize(uint32_t size);
 
 protected:
     using ModbusNetPort::ModbusNetPort;
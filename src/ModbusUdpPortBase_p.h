@@ -3,13 +3,26 @@
 
 #include "ModbusNetPort_p.h"
 
+// Default count of datagrams received/sent by one system call in server mode
+#define MB_UDP_BATCH_SZ 32
+
+// Maximum count of datagrams received/sent by one system call
+#define MB_UDP_BATCH_MAX 1024
+
 class ModbusUdpPortBasePrivate : public ModbusNetPortPrivate
 {
 public:
     static ModbusUdpPortBasePrivate *create(ModbusFramePrivate *f, bool blocking);
 
 public:
-    using ModbusNetPortPrivate::ModbusNetPortPrivate;
+    ModbusUdpPortBasePrivate(ModbusFramePrivate *f, bool blocking) :
+        ModbusNetPortPrivate(f, blocking)
+    {
+        this->batchSize = MB_UDP_BATCH_SZ;
+    }
+
+public:
+    uint32_t batchSize;
 };
 
 #endif // MODBUSUDPPORTBASE_P_H
\ No newline at end of file
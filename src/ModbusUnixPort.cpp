@@ -0,0 +1,61 @@
+#include "ModbusUnixPort.h"
+#include "ModbusTcpPortBase_p.h"
+#include "ModbusNetFrame_p.h"
+
+static inline ModbusTcpPortBasePrivate *d_cast(ModbusPortPrivate *d_ptr) { return static_cast<ModbusTcpPortBasePrivate*>(d_ptr); }
+
+ModbusUnixPort::ModbusUnixPort(ModbusSocket *socket, bool seqpacket, bool blocking) :
+    ModbusTcpPortBase(ModbusTcpPortBasePrivate::create(new ModbusNetFramePrivate(), socket, blocking))
+{
+    ModbusTcpPortBasePrivate *d = d_cast(d_ptr);
+    d->local = true;
+    d->seqpacket = seqpacket;
+}
+
+ModbusUnixPort::ModbusUnixPort(bool blocking) :
+    ModbusTcpPortBase(ModbusTcpPortBasePrivate::create(new ModbusNetFramePrivate(), nullptr, blocking))
+{
+    ModbusTcpPortBasePrivate *d = d_cast(d_ptr);
+    d->local = true;
+    d->seqpacket = MB_UNIX_SEQPACKET_DEFAULT;
+}
+
+bool ModbusUnixPort::isSeqPacket() const
+{
+    return d_cast(d_ptr)->seqpacket;
+}
+
+void ModbusUnixPort::setSeqPacket(bool seqpacket)
+{
+    ModbusTcpPortBasePrivate *d = d_cast(d_ptr);
+    if (d->seqpacket != seqpacket)
+    {
+        d->seqpacket = seqpacket;
+        d->setChanged(true);
+    }
+}
+
+void ModbusUnixPort::setNextRequestRepeated(bool v)
+{
+    d_net(d_ptr->frame)->autoIncrement = !v;
+}
+
+bool ModbusUnixPort::autoIncrement() const
+{
+    return d_net(d_ptr->frame)->autoIncrement;
+}
+
+uint16_t ModbusUnixPort::transactionId() const
+{
+    return d_net(d_ptr->frame)->transaction;
+}
+
+void ModbusUnixPort::setTransactionId(uint16_t id)
+{
+    d_net(d_ptr->frame)->transaction = id;
+}
+
+uint32_t ModbusUnixPort::staleResponseCount() const
+{
+    return d_net(d_ptr->frame)->staleCount;
+}
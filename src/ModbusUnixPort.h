@@ -0,0 +1,84 @@
+/*!
+ * \file   ModbusUnixPort.h
+ * \brief  Header file of class `ModbusUnixPort`.
+ *
+ * \author serhmarch
+ * \date   October 2026
+ */
+#ifndef MODBUSUNIXPORT_H
+#define MODBUSUNIXPORT_H
+
+#include "ModbusTcpPortBase.h"
+
+class ModbusSocket;
+
+/*! \brief Class `ModbusUnixPort` implements Modbus TCP protocol (MBAP header) over Unix domain socket.
+
+    \details `ModbusUnixPort` is intended for processes on the same host (HMI, historian, protocol
+    converters) that talk to local Modbus server. Frames are the same as Modbus TCP frames, but the
+    connection is `AF_UNIX` socket, so data doesn't pass through TCP/IP stack (no checksums, acknowledgements,
+    congestion control and loopback routing).
+
+    The socket is defined by its path (`path()`, the same as `host()`, `port()` isn't used).
+    On Linux path that starts with `@` is the name in abstract namespace (no file is created).
+
+    Socket type is `SOCK_SEQPACKET` (default on Linux) or `SOCK_STREAM` (`setSeqPacket(false)`).
+    `SOCK_SEQPACKET` keeps message boundaries: every frame is sent as one message and one `recv()` returns
+    exactly one frame, so frames are never split or merged. Server must use the same socket type
+    (`ModbusUnixServer::setSeqPacket()`).
+
+    Unix domain sockets are supported on Unix-like systems only, `open()` returns `Status_BadTcpCreate` on Windows.
+
+    \sa `ModbusUnixServer`
+ */
+
+class MODBUS_EXPORT ModbusUnixPort : public ModbusTcpPortBase
+{
+public:
+    /// \details Constructor of the class for connected `socket` (used by server).
+    /// `seqpacket` is `true` if `socket` has `SOCK_SEQPACKET` type.
+    ModbusUnixPort(ModbusSocket *socket, bool seqpacket, bool blocking = false);
+
+    /// \details Constructor of the class.
+    ModbusUnixPort(bool blocking = false);
+
+public:
+    /// \details Returns the Modbus protocol type. In this case it is `Modbus::UNIX`.
+    Modbus::ProtocolType type() const override { return Modbus::UNIX; }
+
+public:
+    /// \details Returns path of the socket (same as `host()`).
+    const Modbus::Char *path() const { return host(); }
+
+    /// \details Sets path of the socket (same as `setHost()`).
+    void setPath(const Modbus::Char *path) { setHost(path); }
+
+    /// \details Returns `true` if socket has `SOCK_SEQPACKET` type, `false` if it has `SOCK_STREAM` type.
+    bool isSeqPacket() const;
+
+    /// \details Sets socket type: `SOCK_SEQPACKET` if `seqpacket` is `true`, `SOCK_STREAM` otherwise.
+    /// Socket is reopened with new type by next `open()`.
+    void setSeqPacket(bool seqpacket);
+
+public:
+    ///  \details Repeat next request parameters (for Modbus TCP transaction Id).
+    void setNextRequestRepeated(bool v);
+
+    /// \details Returns `true' if the identifier of each subsequent parcel is automatically incremented by 1, `false' otherwise.
+    bool autoIncrement() const;
+
+    /// \details Returns the current transaction identifier.
+    uint16_t transactionId() const;
+
+    /// \details Sets the transaction identifier for the next request.
+    void setTransactionId(uint16_t id);
+
+    /// \details Returns count of late responses to abandoned requests (with previous transaction identifiers)
+    /// that were dropped while waiting for the response to the current request.
+    uint32_t staleResponseCount() const;
+
+protected:
+    using ModbusTcpPortBase::ModbusTcpPortBase;
+};
+
+#endif // MODBUSUNIXPORT_H
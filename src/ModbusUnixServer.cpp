@@ -0,0 +1,24 @@
+#include "ModbusUnixServer.h"
+#include "ModbusTcpServer_p.h"
+
+inline ModbusTcpServerPrivate *d_cast(ModbusObjectPrivate *d_ptr) { return static_cast<ModbusTcpServerPrivate*>(d_ptr); }
+
+ModbusUnixServer::ModbusUnixServer(ModbusInterface *device) :
+    ModbusTcpServer(Modbus::UNIX, device)
+{
+}
+
+bool ModbusUnixServer::isSeqPacket() const
+{
+    return d_cast(d_ptr)->seqpacket;
+}
+
+void ModbusUnixServer::setSeqPacket(bool seqpacket)
+{
+    ModbusTcpServerPrivate *d = d_cast(d_ptr);
+    if (d->seqpacket != seqpacket)
+    {
+        d->seqpacket = seqpacket;
+        d->changed = true;
+    }
+}
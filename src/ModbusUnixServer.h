@@ -0,0 +1,60 @@
+/*!
+ * \file   ModbusUnixServer.h
+ * \brief  Header file of Modbus server over Unix domain socket.
+ *
+ * \author serhmarch
+ * \date   October 2026
+ */
+#ifndef MODBUSUNIXSERVER_H
+#define MODBUSUNIXSERVER_H
+
+#include "ModbusTcpServer.h"
+
+/*! \brief The `ModbusUnixServer` class implements Modbus server for local clients over Unix domain socket.
+
+    \details `ModbusUnixServer` is `ModbusTcpServer` which listens on `AF_UNIX` socket instead of TCP port,
+    so processes on the same host (HMI, historian, protocol converters) don't pay for TCP/IP stack of loopback
+    connection. Frames are Modbus TCP frames (MBAP header), every accepted connection is `ModbusUnixPort`.
+    Connection management (maximum connections, pool of closed connections, timeouts, unit map) is the same
+    as for `ModbusTcpServer`.
+
+    The socket is defined by its path (`path()`, the same as `ipaddr()`, `port()` isn't used). Socket file left
+    by previous instance of the server is removed by `open()` and the file is removed by `close()`.
+    On Linux path that starts with `@` is the name in abstract namespace (no file is created).
+
+    Socket type is `SOCK_SEQPACKET` (default on Linux) or `SOCK_STREAM`, clients must use the same type.
+
+    Unix domain sockets are supported on Unix-like systems only, `open()` returns `Status_BadTcpCreate` on Windows.
+
+    \code{.cpp}
+    ModbusUnixServer server(&device);
+    server.setPath("/run/modbus.sock");
+    while (running)
+        server.process();
+    \endcode
+
+    \sa `ModbusUnixPort`
+ */
+class MODBUS_EXPORT ModbusUnixServer : public ModbusTcpServer
+{
+public:
+    ///  \details Constructor of the class. `device` param is object which might process incoming requests for read/write memory.
+    ModbusUnixServer(ModbusInterface *device);
+
+public:
+    ///  \details Returns path of the listening socket (same as `ipaddr()`).
+    const Modbus::Char *path() const { return ipaddr(); }
+
+    ///  \details Sets path of the listening socket (same as `setIpaddr()`).
+    void setPath(const Modbus::Char *path) { setIpaddr(path); }
+
+    ///  \details Returns `true` if socket has `SOCK_SEQPACKET` type, `false` if it has `SOCK_STREAM` type.
+    bool isSeqPacket() const;
+
+    ///  \details Sets socket type: `SOCK_SEQPACKET` if `seqpacket` is `true`, `SOCK_STREAM` otherwise.
+    /// If the server is open it is closed (with all its connections) and opened again with the new socket type
+    /// by the next `process()` call.
+    void setSeqPacket(bool seqpacket);
+};
+
+#endif // MODBUSUNIXSERVER_H
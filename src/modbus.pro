@@ -40,16 +40,26 @@ HEADERS +=                          \
     $$PWD/ModbusAscOverTcpPort.h    \
     $$PWD/ModbusRtuOverUdpPort.h    \
     $$PWD/ModbusAscOverUdpPort.h    \
+    $$PWD/ModbusUnixPort.h          \
     $$PWD/ModbusClientPort.h        \
     $$PWD/ModbusClientPort_p.h      \
+    $$PWD/ModbusClientPortPool.h    \
+    $$PWD/ModbusClientPortPool_p.h  \
     $$PWD/ModbusClient.h            \
     $$PWD/ModbusClient_p.h          \
+    $$PWD/ModbusSubscription.h      \
+    $$PWD/ModbusSubscription_p.h    \
+    $$PWD/ModbusPollScheduler.h     \
+    $$PWD/ModbusPollScheduler_p.h   \
+    $$PWD/ModbusUdpMultiClient.h    \
+    $$PWD/ModbusUdpMultiClient_p.h  \
     $$PWD/ModbusServerPort.h        \
     $$PWD/ModbusServerPort_p.h      \
     $$PWD/ModbusServerResource.h    \
     $$PWD/ModbusServerResource_p.h  \
     $$PWD/ModbusTcpServer.h         \
     $$PWD/ModbusTcpServer_p.h       \
+    $$PWD/ModbusUnixServer.h        \
 
 SOURCES +=                          \
     $$PWD/Modbus.cpp                \
@@ -65,11 +75,17 @@ SOURCES +=                          \
     $$PWD/ModbusAscOverTcpPort.cpp  \
     $$PWD/ModbusRtuOverUdpPort.cpp  \
     $$PWD/ModbusAscOverUdpPort.cpp  \
+    $$PWD/ModbusUnixPort.cpp        \
     $$PWD/ModbusClientPort.cpp      \
+    $$PWD/ModbusClientPortPool.cpp  \
     $$PWD/ModbusClient.cpp          \
+    $$PWD/ModbusSubscription.cpp    \
+    $$PWD/ModbusPollScheduler.cpp   \
+    $$PWD/ModbusUdpMultiClient.cpp  \
     $$PWD/ModbusServerPort.cpp      \
     $$PWD/ModbusServerResource.cpp  \
-    $$PWD/ModbusTcpServer.cpp
+    $$PWD/ModbusTcpServer.cpp       \
+    $$PWD/ModbusUnixServer.cpp
 
 
 contains(CONFIG, qt) {
@@ -92,6 +108,7 @@ HEADERS +=                                  \
     $$PWD/win/ModbusSerialPort_p_win.h      \
     $$PWD/win/ModbusTcpPortBase_p_win.h     \
     $$PWD/win/ModbusUdpPortBase_p_win.h     \
+    $$PWD/win/ModbusUdpMultiClient_p_win.h  \
     $$PWD/win/ModbusTcpServer_p_win.h       \
 
 SOURCES +=                                  \
@@ -99,6 +116,7 @@ SOURCES +=                                  \
     $$PWD/win/ModbusSerialPort_win.cpp      \
     $$PWD/win/ModbusTcpPortBase_win.cpp     \
     $$PWD/win/ModbusUdpPortBase_win.cpp     \
+    $$PWD/win/ModbusUdpMultiClient_win.cpp  \
     $$PWD/win/ModbusTcpServer_win.cpp       \
 
 LIBS += -lWs2_32
@@ -114,14 +132,19 @@ HEADERS +=                                    \
     $$PWD/unix/Modbus_unix.h                  \
     $$PWD/unix/ModbusSerialPort_p_unix.h      \
     $$PWD/unix/ModbusTcpPortBase_p_unix.h     \
+    $$PWD/unix/ModbusResolver_unix.h          \
     $$PWD/unix/ModbusUdpPortBase_p_unix.h     \
+    $$PWD/unix/ModbusUdpMultiClient_p_unix.h  \
     $$PWD/unix/ModbusTcpServer_p_unix.h       \
 
 SOURCES +=                                    \
     $$PWD/unix/Modbus_unix.cpp                \
     $$PWD/unix/ModbusSerialPort_unix.cpp      \
+    $$PWD/unix/ModbusSerialPortBaud_unix.cpp  \
     $$PWD/unix/ModbusTcpPortBase_unix.cpp     \
+    $$PWD/unix/ModbusResolver_unix.cpp        \
     $$PWD/unix/ModbusUdpPortBase_unix.cpp     \
+    $$PWD/unix/ModbusUdpMultiClient_unix.cpp  \
     $$PWD/unix/ModbusTcpServer_unix.cpp       \
 
 }
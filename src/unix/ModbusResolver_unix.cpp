@@ -0,0 +1,174 @@
+#include "ModbusResolver_unix.h"
+
+#include <thread>
+#include <cstring>
+
+#include <netdb.h>
+#include <arpa/inet.h>
+
+using namespace Modbus;
+
+ModbusResolver &ModbusResolver::instance()
+{
+    // Note: resolver is never destroyed, because detached threads may still use it at program exit
+    static ModbusResolver *resolver = new ModbusResolver();
+    return *resolver;
+}
+
+ModbusResolver::ModbusResolver() :
+    m_ttl(MB_RESOLVER_TTL_DEFAULT),
+    m_threads(0),
+    m_lookups(0)
+{
+}
+
+uint32_t ModbusResolver::ttl() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_ttl;
+}
+
+void ModbusResolver::setTtl(uint32_t msec)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_ttl = msec;
+}
+
+void ModbusResolver::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_cache.begin(); it != m_cache.end(); )
+    {
+        // Note: queued entries are kept, so their result is still delivered to waiting ports
+        if (it->second.state == EntryQueued)
+            ++it;
+        else
+            it = m_cache.erase(it);
+    }
+}
+
+uint32_t ModbusResolver::lookupCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_lookups;
+}
+
+StatusCode ModbusResolver::resolve(const std::string &host, bool wait, sockaddr_in *addr, int *error)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->sin_family = AF_INET;
+    if (inet_pton(AF_INET, host.data(), &addr->sin_addr) == 1)
+        return Status_Good;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto it = m_cache.find(host);
+    if (it != m_cache.end())
+    {
+        Entry &e = it->second;
+        switch (e.state)
+        {
+        case EntryQueued:
+            if (!wait)
+                return Status_Processing;
+            break;
+        case EntryResolved:
+            if (e.fresh || (timer() - e.timestamp < m_ttl))
+            {
+                e.fresh = false;
+                *addr = e.addr;
+                return Status_Good;
+            }
+            m_cache.erase(it);
+            break;
+        default:
+            // Note: failure is reported once, next call resolves the host again
+            *error = e.error;
+            m_cache.erase(it);
+            return Status_BadTcpCreate;
+        }
+    }
+
+    if (wait)
+    {
+        lock.unlock();
+        int r = lookup(host, addr);
+        if (r)
+        {
+            *error = r;
+            return Status_BadTcpCreate;
+        }
+        lock.lock();
+        Entry &e = m_cache[host];
+        e.state = EntryResolved;
+        e.fresh = false;
+        e.addr = *addr;
+        e.error = 0;
+        e.timestamp = timer();
+        return Status_Good;
+    }
+
+    Entry &e = m_cache[host];
+    e.state = EntryQueued;
+    e.fresh = false;
+    e.error = 0;
+    e.timestamp = timer();
+    m_queue.push_back(host);
+    if ((m_threads < MB_RESOLVER_THREADS_MAX) && (m_threads < m_queue.size()))
+    {
+        ++m_threads;
+        std::thread(&ModbusResolver::run, this).detach();
+    }
+    else
+        m_cond.notify_one();
+    return Status_Processing;
+}
+
+int ModbusResolver::lookup(const std::string &host, sockaddr_in *addr)
+{
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof hints);
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+
+    struct addrinfo *res = nullptr;
+    int r = getaddrinfo(host.data(), nullptr, &hints, &res);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_lookups;
+    }
+    if (r)
+        return r;
+    memcpy(addr, res->ai_addr, sizeof(*addr));
+    freeaddrinfo(res);
+    return 0;
+}
+
+void ModbusResolver::setResult(const std::string &host, int error, const sockaddr_in &addr)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry &e = m_cache[host];
+    e.state = error ? EntryFailed : EntryResolved;
+    e.fresh = true;
+    e.addr = addr;
+    e.error = error;
+    e.timestamp = timer();
+}
+
+void ModbusResolver::run()
+{
+    for (;;)
+    {
+        std::string host;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [this]() { return !m_queue.empty(); });
+            host = m_queue.front();
+            m_queue.pop_front();
+        }
+        sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        int r = lookup(host, &addr);
+        setResult(host, r, addr);
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef MODBUSRESOLVER_UNIX_H
+#define MODBUSRESOLVER_UNIX_H
+
+#include <string>
+#include <map>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+#include <netinet/in.h>
+
+#include "../ModbusGlobal.h"
+
+// Maximum count of background threads that resolve host names
+#define MB_RESOLVER_THREADS_MAX 4
+
+// Default time to live of resolved address in cache (milliseconds)
+#define MB_RESOLVER_TTL_DEFAULT 60000
+
+/*
+   Resolves host names into IPv4 addresses.
+   IP literals are converted immediately. Other names are resolved by `getaddrinfo()` either in the calling thread
+   (blocking ports) or by background threads (non-blocking ports), so one slow resolver doesn't stall the poll thread.
+   Resolved addresses are cached for `ttl()` milliseconds and shared by all ports.
+*/
+class ModbusResolver
+{
+public:
+    static ModbusResolver &instance();
+
+public:
+    ModbusResolver();
+
+public:
+    uint32_t ttl() const;
+    void setTtl(uint32_t msec);
+    void clear();
+
+    // Count of `getaddrinfo()` calls made by resolver
+    uint32_t lookupCount() const;
+
+    // Returns `Status_Good` and fills `addr` (except port) if the address of `host` is known.
+    // If `wait` is `true` unknown host is resolved in the calling thread, otherwise it is queued
+    // to background thread and `Status_Processing` is returned until it is resolved.
+    // Returns `Status_BadTcpCreate` and `getaddrinfo()` error code in `error` if resolution failed.
+    Modbus::StatusCode resolve(const std::string &host, bool wait, sockaddr_in *addr, int *error);
+
+private:
+    enum EntryState
+    {
+        EntryQueued,
+        EntryResolved,
+        EntryFailed
+    };
+
+    struct Entry
+    {
+        EntryState state;
+        bool fresh; // resolved but not yet returned to the caller, so it is valid regardless of TTL
+        sockaddr_in addr;
+        int error;
+        Modbus::Timer timestamp;
+    };
+
+private:
+    int lookup(const std::string &host, sockaddr_in *addr);
+    void setResult(const std::string &host, int error, const sockaddr_in &addr);
+    void run();
+
+private:
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::map<std::string, Entry> m_cache;
+    std::deque<std::string> m_queue;
+    uint32_t m_ttl;
+    uint32_t m_threads;
+    uint32_t m_lookups;
+};
+
+#endif // MODBUSRESOLVER_UNIX_H
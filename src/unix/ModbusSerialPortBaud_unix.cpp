@@ -0,0 +1,59 @@
+// Note: this translation unit must not include <termios.h>:
+// Linux `struct termios2` from <asm/termbits.h> conflicts with libc `struct termios`
+
+#include <errno.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+
+#include <asm/termbits.h>
+#include <sys/ioctl.h>
+
+int serialPortSetCustomBaudRate(int fd, int32_t baudRate, int32_t *actualBaudRate)
+{
+    struct termios2 options;
+    if (ioctl(fd, TCGETS2, &options) < 0)
+        return -1;
+    options.c_cflag &= ~CBAUD;
+    options.c_cflag |= BOTHER;
+    options.c_cflag &= ~(CBAUD << IBSHIFT); // input speed is equal to output speed
+    options.c_ispeed = static_cast<speed_t>(baudRate);
+    options.c_ospeed = static_cast<speed_t>(baudRate);
+    if (ioctl(fd, TCSETS2, &options) < 0)
+        return -1;
+    // Note: driver can round the requested rate to the nearest one available
+    if (ioctl(fd, TCGETS2, &options) < 0)
+        return -1;
+    if (actualBaudRate)
+        *actualBaudRate = (options.c_ospeed > 0) ? static_cast<int32_t>(options.c_ospeed) : baudRate;
+    return 0;
+}
+
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__DragonFly__)
+
+#include <termios.h>
+
+// Note: BSD-like systems use numeric `speed_t` values, so any rate can be passed to `cfsetspeed`
+int serialPortSetCustomBaudRate(int fd, int32_t baudRate, int32_t *actualBaudRate)
+{
+    struct termios options;
+    if (tcgetattr(fd, &options) < 0)
+        return -1;
+    if (cfsetspeed(&options, static_cast<speed_t>(baudRate)) < 0)
+        return -1;
+    if (tcsetattr(fd, TCSANOW, &options) < 0)
+        return -1;
+    if (actualBaudRate)
+        *actualBaudRate = baudRate;
+    return 0;
+}
+
+#else
+
+int serialPortSetCustomBaudRate(int /*fd*/, int32_t /*baudRate*/, int32_t * /*actualBaudRate*/)
+{
+    errno = EINVAL;
+    return -1;
+}
+
+#endif
@@ -4,10 +4,16 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <termios.h>
+#include <sys/select.h>
 
 #include "Modbus_unix.h"
 #include "../ModbusSerialPort_p.h"
 
+// Sets arbitrary (non-standard) baud rate for the opened serial port `fd` (`termios2`/`BOTHER` on Linux).
+// Returns 0 on success and stores the rate actually applied by the driver in `actualBaudRate`,
+// returns -1 on failure (`errno` is set)
+int serialPortSetCustomBaudRate(int fd, int32_t baudRate, int32_t *actualBaudRate);
+
 class ModbusSerialPortPrivateUnix : public ModbusSerialPortPrivate
 {
 public:
@@ -41,6 +47,34 @@ public:
     inline void serialPortClose() { close(serialPort); serialPort = -1; }
     inline void timestampRefresh() { timestamp = timer(); }
 
+    // Waits for input data no more than `usec` microseconds. Returns `true` if data is available
+    inline bool waitForInput(uint32_t usec)
+    {
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(serialPort, &fds);
+        struct timeval tv;
+        tv.tv_sec = usec / 1000000;
+        tv.tv_usec = usec % 1000000;
+        return select(serialPort + 1, &fds, nullptr, nullptr, &tv) > 0;
+    }
+
+    // Note: late response to the failed request can still be on the bus, so its bytes are read and dropped
+    // until the frame boundary (t3.5 silence) and only then the next request is transmitted.
+    // Returns `true` if input is synchronized
+    inline bool inputResync()
+    {
+        if (!inputResyncRequired)
+            return true;
+        uint8_t stale[MB_RTU_IO_BUFF_SZ];
+        while (waitForInput(0) && (::read(serialPort, stale, sizeof(stale)) > 0))
+            activityRefresh();
+        if (!isInputResynced())
+            return false;
+        inputResyncRequired = false;
+        return true;
+    }
+
 public:
     StatusCode blockingWrite();
     StatusCode blockingRead ();
@@ -60,7 +94,12 @@ StatusCode ModbusSerialPortPrivateUnix::blockingWrite()
 {
     int c;
     this->state = STATE_OPENED;
-    tcflush(this->serialPort, TCIFLUSH);
+    // Note: keep minimum gap (t3.5 and/or turnaround delay) before transmit
+    while (!this->inputResync())
+        microsleep(this->resyncDelayUs());
+    uint32_t delay = this->transmitDelayUs();
+    if (delay)
+        microsleep(delay);
     c = ::write(this->serialPort, this->buff(), this->buffSize());
     if (c < 0)
     {
@@ -68,21 +107,42 @@ StatusCode ModbusSerialPortPrivateUnix::blockingWrite()
                                                      StringLiteral("' serial port. Error code: ") + toModbusString(errno) +
                                                      StringLiteral(". ") + getLastErrorText());
     }
+    this->activityTransmitted(static_cast<uint32_t>(c));
     return Status_Good;
 }
 
 StatusCode ModbusSerialPortPrivateUnix::blockingRead()
 {
     int c;
+    uint16_t offset;
     this->state = STATE_OPENED;
-    c = ::read(this->serialPort, this->buff(), this->buffMaxSize());
-    if (c < 0)
+    // Note: pipelined stream frame can be already received together with previous one
+    if (this->frame->startRead())
+        return Status_Good;
+    while (true)
     {
-        return this->setError(Status_BadSerialRead, StringLiteral("Error while reading '") + this->portName() +
-                                                    StringLiteral("' serial port. Error code: ") + toModbusString(errno) +
-                                                    StringLiteral(". ") + getLastErrorText());
+        c = ::read(this->serialPort, this->buffNext(), this->buffFreeSize());
+        if (c < 0)
+        {
+            return this->setError(Status_BadSerialRead, StringLiteral("Error while reading '") + this->portName() +
+                                                        StringLiteral("' serial port. Error code: ") + toModbusString(errno) +
+                                                        StringLiteral(". ") + getLastErrorText());
+        }
+        offset = this->buffSize();
+        this->addBuffSize(static_cast<uint16_t>(c));
+        if ((c == 0) || (this->buffFreeSize() == 0))
+            break;
+        this->activityRefresh();
+        // Note: stream frame (ASCII) is read until its end is detected
+        if (this->frame->isStreamFrame())
+        {
+            if (this->frame->isFrameEndDetected(offset))
+                break;
+        }
+        // Note: with automatic timing frame is completed by t3.5 silence on the bus
+        else if (!this->isAutoTiming() || !this->waitForInput(this->timing.interFrameUs))
+            break;
     }
-    this->setBuffSize(static_cast<uint16_t>(c));
     return Status_Good;
 }
 
@@ -102,11 +162,13 @@ StatusCode ModbusSerialPortPrivateUnix::nonBlockingWrite()
             MB_FALLTHROUGH
         case STATE_WAIT_FOR_WRITE:
         case STATE_WAIT_FOR_WRITE_ALL:
-            // Note: clean read buffer from garbage before write
-            tcflush(this->serialPort, TCIFLUSH);
+            // Note: keep minimum gap (t3.5 and/or turnaround delay) before transmit
+            if (!this->inputResync() || this->transmitDelayUs())
+                return Status_Processing;
             c = ::write(this->serialPort, this->buff(), this->buffSize());
             if (c >= 0)
             {
+                this->activityTransmitted(static_cast<uint32_t>(c));
                 this->state = STATE_OPENED;
                 return Status_Good;
             }
@@ -154,11 +216,16 @@ StatusCode ModbusSerialPortPrivateUnix::nonBlockingRead()
         case STATE_PREPARE_TO_READ:
             this->timestampRefresh();
             this->state = STATE_WAIT_FOR_READ;
-            this->setBuffSize(0);
+            // Note: pipelined stream frame can be already received together with previous one
+            if (this->frame->startRead())
+            {
+                this->state = STATE_OPENED;
+                return Status_Good;
+            }
             MB_FALLTHROUGH
         case STATE_WAIT_FOR_READ:
             // read first byte state
-            c = ::read(this->serialPort, this->buff(), this->buffMaxSize());
+            c = ::read(this->serialPort, this->buffNext(), this->buffFreeSize());
             if (c < 0)
             {
                 int e = errno;
@@ -176,9 +243,12 @@ StatusCode ModbusSerialPortPrivateUnix::nonBlockingRead()
             }
             if (c > 0)
             {
+                uint16_t offset = this->buffSize();
                 this->addBuffSize(static_cast<uint16_t>(c));
-                if ((this->timeoutInterByte() == 0) || // timeoutInterByte = 0 means no need to wait next bytes
-                    (this->buffSize() == this->buffMaxSize()))    // input buffer is full. Try to handle it
+                this->activityRefresh();
+                if ((!this->isAutoTiming() && (this->timeoutInterByte() == 0)) || // timeoutInterByte = 0 means no need to wait next bytes
+                    (this->buffSize() == this->buffMaxSize()) ||  // input buffer is full. Try to handle it
+                    this->frame->isFrameEndDetected(offset))      // end of frame is detected by its content (ASCII)
                 {
                     this->state = STATE_OPENED;
                     return Status_Good;
@@ -219,8 +289,11 @@ StatusCode ModbusSerialPortPrivateUnix::nonBlockingRead()
 
             if (c > 0)
             {
+                uint16_t offset = this->buffSize();
                 this->addBuffSize(static_cast<uint16_t>(c));
-                if (this->buffSize() == this->buffMaxSize()) // input buffer is full. Try to handle it
+                this->activityRefresh();
+                if ((this->buffSize() == this->buffMaxSize()) || // input buffer is full. Try to handle it
+                    this->frame->isFrameEndDetected(offset))     // end of frame is detected by its content (ASCII)
                 {
                     this->state = STATE_OPENED;
                     return Status_Good;
@@ -230,7 +303,7 @@ StatusCode ModbusSerialPortPrivateUnix::nonBlockingRead()
                                                                         StringLiteral("' serial port. Read buffer overflow"));
                 this->timestampRefresh();
             }
-            else if (timer() - this->timestamp >= this->timeoutInterByte()) // waiting timeout to read next byte is elapsed
+            else if (this->isFrameSilenceElapsed(this->timestamp)) // waiting timeout to read next byte (or t3.5) is elapsed
             {
                 this->state = STATE_OPENED;
                 return Status_Good;
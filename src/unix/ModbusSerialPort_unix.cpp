@@ -3,6 +3,113 @@
 
 #include <termios.h>
 
+#if defined(__linux__)
+#include <string.h>
+#include <sys/ioctl.h>
+#include <linux/serial.h>
+#endif
+
+// Returns standard `Bxxx` speed constant for `baudRate` or `B0` if there is no such constant
+static speed_t toSpeed(int32_t baudRate)
+{
+    switch (baudRate)
+    {
+    case 50:      return B50;
+    case 75:      return B75;
+    case 110:     return B110;
+    case 134:     return B134;
+    case 150:     return B150;
+    case 200:     return B200;
+    case 300:     return B300;
+    case 600:     return B600;
+    case 1200:    return B1200;
+    case 1800:    return B1800;
+    case 2400:    return B2400;
+    case 4800:    return B4800;
+    case 9600:    return B9600;
+    case 19200:   return B19200;
+    case 38400:   return B38400;
+#ifdef B57600
+    case 57600:   return B57600;
+#endif
+#ifdef B115200
+    case 115200:  return B115200;
+#endif
+#ifdef B230400
+    case 230400:  return B230400;
+#endif
+#ifdef B460800
+    case 460800:  return B460800;
+#endif
+#ifdef B500000
+    case 500000:  return B500000;
+#endif
+#ifdef B576000
+    case 576000:  return B576000;
+#endif
+#ifdef B921600
+    case 921600:  return B921600;
+#endif
+#ifdef B1000000
+    case 1000000: return B1000000;
+#endif
+#ifdef B1152000
+    case 1152000: return B1152000;
+#endif
+#ifdef B1500000
+    case 1500000: return B1500000;
+#endif
+#ifdef B2000000
+    case 2000000: return B2000000;
+#endif
+#ifdef B2500000
+    case 2500000: return B2500000;
+#endif
+#ifdef B3000000
+    case 3000000: return B3000000;
+#endif
+#ifdef B3500000
+    case 3500000: return B3500000;
+#endif
+#ifdef B4000000
+    case 4000000: return B4000000;
+#endif
+    default:      return B0;
+    }
+}
+
+// Enables kernel RS-485 mode (driver controls RTS line). Returns 0 on success, -1 on failure (`errno` is set)
+static int serialPortSetRs485(int fd, uint32_t delayRtsBeforeSend, uint32_t delayRtsAfterSend)
+{
+#if defined(__linux__) && defined(TIOCSRS485)
+    struct serial_rs485 rs485;
+    memset(&rs485, 0, sizeof(rs485));
+    rs485.flags = SER_RS485_ENABLED | SER_RS485_RTS_ON_SEND;
+    rs485.delay_rts_before_send = delayRtsBeforeSend;
+    rs485.delay_rts_after_send  = delayRtsAfterSend;
+    return ioctl(fd, TIOCSRS485, &rs485);
+#else
+    (void)fd; (void)delayRtsBeforeSend; (void)delayRtsAfterSend;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
+// Note: low latency is a hint, so errors are ignored (e.g. USB adapters and pseudo-terminals do not support it)
+static void serialPortSetLowLatency(int fd)
+{
+#if defined(__linux__) && defined(ASYNC_LOW_LATENCY)
+    struct serial_struct ss;
+    if (ioctl(fd, TIOCGSERIAL, &ss) == 0)
+    {
+        ss.flags |= ASYNC_LOW_LATENCY;
+        ioctl(fd, TIOCSSERIAL, &ss);
+    }
+#else
+    (void)fd;
+#endif
+}
+
 ModbusSerialPortPrivate *ModbusSerialPortPrivate::create(ModbusFramePrivate *f, bool blocking)
 {
     return new ModbusSerialPortPrivateUnix(f, blocking);
@@ -37,6 +144,8 @@ StatusCode ModbusSerialPort::open()
                 }
             }
             d->clearChanged();
+            d->timingRefresh();
+            d->inputResyncRequest();
             struct termios options;
             speed_t sp;
             int flags = O_RDWR | O_NOCTTY;
@@ -48,6 +157,9 @@ StatusCode ModbusSerialPort::open()
             {
                 flags |= O_NONBLOCK;
             }
+            if (d->settings.baudRate <= 0)
+                return d->setError(Status_BadSerialOpen, StringLiteral("Unsupported baud rate ") + toModbusString(d->settings.baudRate) +
+                                                         StringLiteral(" for '") + d->settings.portName + StringLiteral("' serial port"));
             d->serialPort = ::open(d->settings.portName.c_str(),  flags);
 
             if (d->serialPortIsInvalid())
@@ -66,18 +178,10 @@ StatusCode ModbusSerialPort::open()
                 return d->setError(Status_BadSerialOpen, StringLiteral("Failed to get attributes for '") + d->settings.portName +
                                                          StringLiteral("' serial port. Error code: ") + toModbusString(errno) +
                                                          StringLiteral(". ") + getLastErrorText());
-            switch(d->settings.baudRate)
-            {
-            case 1200:  sp = B1200;  break;
-            case 2400:  sp = B2400;  break;
-            case 4800:  sp = B4800;  break;
-            case 9600:  sp = B9600;  break;
-            case 19200: sp = B19200; break;
-            case 38400: sp = B38400; break;
-            case 57600: sp = B57600; break;
-            case 115200:sp = B115200;break;
-            default:    sp = B9600;  break;
-            }
+            sp = toSpeed(d->settings.baudRate);
+            // Note: non-standard baud rate is applied after all other attributes are set
+            if (sp == B0)
+                sp = B38400;
 
             r = cfsetispeed(&options, sp);
             if (r < 0)
@@ -162,6 +266,39 @@ StatusCode ModbusSerialPort::open()
                                                          StringLiteral("' serial port. Error code: ") + toModbusString(errno) +
                                                          StringLiteral(". ") + getLastErrorText());
 
+            int32_t actualBaudRate = d->settings.baudRate;
+            if (toSpeed(d->settings.baudRate) == B0)
+            {
+                r = serialPortSetCustomBaudRate(d->serialPort, d->settings.baudRate, &actualBaudRate);
+                if (r < 0)
+                {
+                    int e = errno;
+                    d->serialPortClose(); // Note: port must not stay open with wrong baud rate
+                    errno = e;
+                    return d->setError(Status_BadSerialOpen, StringLiteral("Failed to set baud rate ") + toModbusString(d->settings.baudRate) +
+                                                             StringLiteral(" for '") + d->settings.portName +
+                                                             StringLiteral("' serial port. Error code: ") + toModbusString(e) +
+                                                             StringLiteral(". ") + getLastErrorText());
+                }
+            }
+            // Note: timing follows the baud rate actually applied by the driver
+            d->timingRefresh(actualBaudRate);
+
+            if (d->isRs485())
+            {
+                r = serialPortSetRs485(d->serialPort, d->settings.rs485DelayRtsBeforeSend, d->settings.rs485DelayRtsAfterSend);
+                if (r < 0)
+                {
+                    int e = errno;
+                    d->serialPortClose();
+                    errno = e;
+                    return d->setError(Status_BadSerialOpen, StringLiteral("Failed to enable RS-485 mode for '") + d->settings.portName +
+                                                             StringLiteral("' serial port. Error code: ") + toModbusString(e) +
+                                                             StringLiteral(". ") + getLastErrorText());
+                }
+            }
+            if (d->isLowLatency())
+                serialPortSetLowLatency(d->serialPort);
         }
             return Status_Good;
         default:
@@ -199,11 +336,17 @@ bool ModbusSerialPort::isOpen() const
 StatusCode ModbusSerialPort::write()
 {
     ModbusSerialPortPrivateUnix *d = d_unix(d_ptr);
-    return (d->*(d->writeMethod))();
+    // Note: method pointer is taken first, GCC instruments `d->*(d->method)` with `-fsanitize=vptr`
+    // as member access of `this` object instead of `d`
+    ModbusSerialPortPrivateUnix::RWMethodPtr_t method = d->writeMethod;
+    return (d->*method)();
 }
 
 StatusCode ModbusSerialPort::read()
 {
     ModbusSerialPortPrivateUnix *d = d_unix(d_ptr);
-    return (d->*(d->readMethod))();
+    ModbusSerialPortPrivateUnix::RWMethodPtr_t method = d->readMethod;
+    StatusCode r = (d->*method)();
+    d->inputCheck(r);
+    return r;
 }
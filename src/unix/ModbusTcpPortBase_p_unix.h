@@ -1,11 +1,20 @@
 #ifndef MODBUSTCPPORTBASE_P_UNIX_H
 #define MODBUSTCPPORTBASE_P_UNIX_H
 
+#include <cstring>
 #include <netdb.h>
 
 #include "../ModbusTcpPortBase_p.h"
 
 #include "Modbus_unix.h"
+#include "ModbusResolver_unix.h"
+
+// Note: broken connection must be reported by error instead of `SIGPIPE` signal which terminates the process
+#ifdef MSG_NOSIGNAL
+#define MB_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define MB_SEND_FLAGS 0
+#endif
 
 class ModbusTcpPortBasePrivateUnix : public ModbusTcpPortBasePrivate
 {
@@ -14,7 +23,9 @@ public:
         ModbusTcpPortBasePrivate(f, blocking)
     {
         this->timestamp = 0;
-        this->addr = nullptr;
+        this->resolving = false;
+        this->readTimeoutReduced = false;
+        memset(&this->addr, 0, sizeof(this->addr));
 
         if (socket)
         {
@@ -36,24 +47,96 @@ public:
             this->socket->shutdown();
             this->socket->close();
         }
-        this->freeAddr();
         delete this->socket;
     }
 
 public:
-    inline void freeAddr()
+    // Note: blocking socket waits for the rest of response time only after dropped stale response
+    inline void readTimeoutReduce()
+    {
+        Timer t = timer() - this->timestamp;
+        this->socket->setTimeout(t < this->timeout() ? this->timeout() - t : 1);
+        this->readTimeoutReduced = true;
+    }
+
+    inline void readTimeoutRestore()
+    {
+        if (this->readTimeoutReduced)
+        {
+            this->socket->setTimeout(this->timeout());
+            this->readTimeoutReduced = false;
+        }
+    }
+
+    // Returns beginning of the error text for the `action` with the peer, e.g. "TCP. Error while reading from 'host:port"
+    inline String errorText(const Char *action) const
     {
-        if (this->addr)
+        if (this->local)
+            return StringLiteral("UNIX. Error while ") + String(action) + StringLiteral(" '") + this->host();
+        return StringLiteral("TCP. Error while ") + String(action) + StringLiteral(" '") + this->host() + StringLiteral(":") + toModbusString(this->port());
+    }
+
+    // Sends output queue followed by `buff` by one call, bytes which were not sent are left in the queue.
+    // Returns count of sent bytes, 0 if socket is not ready to send or -1 if error occurred (`errno` is set).
+    inline ssize_t sendQueued(const uint8_t *buff, uint16_t sz)
+    {
+        if (this->seqpacket)
+            return sendMessages(buff, sz);
+        ssize_t c = this->socket->sendv(this->outq.data(), this->outq.size(), buff, sz, MB_SEND_FLAGS);
+        if (c < 0)
+        {
+            if ((errno != EWOULDBLOCK) && (errno != EAGAIN) && (errno != EINTR))
+                return -1;
+            c = 0;
+        }
+        this->outq.consume(static_cast<size_t>(c), buff, sz);
+        return c;
+    }
+
+    // Sends queued frames followed by `buff` (`SOCK_SEQPACKET`): every frame is sent by its own call as one message,
+    // message is sent entirely or not at all, so the queue contains only whole frames.
+    // Note: frames are MBAP frames, so size of queued frame is taken from its header
+    inline ssize_t sendMessages(const uint8_t *buff, uint16_t sz)
+    {
+        ssize_t total = 0;
+        while (!this->outq.isEmpty())
+        {
+            const uint8_t *q = this->outq.data();
+            size_t len = 6 + ((static_cast<size_t>(q[4]) << 8) | q[5]);
+            if (len > this->outq.size())
+                len = this->outq.size();
+            ssize_t c = this->socket->send(q, len, MB_SEND_FLAGS);
+            if (c < 0)
+            {
+                if ((errno != EWOULDBLOCK) && (errno != EAGAIN) && (errno != EINTR))
+                    return -1;
+                this->outq.consume(0, buff, sz);
+                return total;
+            }
+            this->outq.consume(len, nullptr, 0);
+            total += c;
+        }
+        if (sz)
         {
-            freeaddrinfo(addr);
-            this->addr = nullptr;
+            ssize_t c = this->socket->send(buff, sz, MB_SEND_FLAGS);
+            if (c < 0)
+            {
+                if ((errno != EWOULDBLOCK) && (errno != EAGAIN) && (errno != EINTR))
+                    return -1;
+                this->outq.consume(0, buff, sz);
+                return total;
+            }
+            total += c;
         }
+        return total;
     }
 
 public:
     ModbusSocket *socket;
     Timer timestamp;
-    struct addrinfo *addr;
+    bool readTimeoutReduced;
+    bool resolving;
+    sockaddr_in addr;
 };
 
 inline ModbusTcpPortBasePrivateUnix *d_unix(ModbusPortPrivate *d_ptr) { return static_cast<ModbusTcpPortBasePrivateUnix*>(d_ptr); }
@@ -12,6 +12,34 @@ Modbus::Handle ModbusTcpPortBase::handle() const
     return reinterpret_cast<Handle>(d_unix(d_ptr)->socket->socket());
 }
 
+uint32_t ModbusTcpPortBase::syscallCount() const
+{
+    return d_unix(d_ptr)->socket->syscallCount();
+}
+
+uint32_t ModbusTcpPortBase::outputQueueSize() const
+{
+    return static_cast<uint32_t>(d_unix(d_ptr)->outq.size());
+}
+
+ModbusSocket *ModbusTcpPortBase::replaceSocket(ModbusSocket *socket)
+{
+    ModbusTcpPortBasePrivateUnix *d = d_unix(d_ptr);
+    if (d->socket->isValid())
+    {
+        d->socket->shutdown();
+        d->socket->close();
+    }
+    ModbusSocket *prev = d->socket;
+    socket->setBlocking(d->isBlocking());
+    d->socket = socket;
+    d->outq.clear();
+    d->frame->sz = 0;
+    d->readTimeoutReduced = false;
+    d->state = socket->isValid() ? STATE_OPENED : STATE_CLOSED;
+    return prev;
+}
+
 Modbus::StatusCode ModbusTcpPortBase::open()
 {
     ModbusTcpPortBasePrivateUnix *d = d_unix(d_ptr);
@@ -35,114 +63,133 @@ Modbus::StatusCode ModbusTcpPortBase::open()
                 }
             }
             d->clearChanged();
-            struct addrinfo hints;
-            memset(&hints, 0, sizeof hints);
-            hints.ai_family = AF_UNSPEC;
-            hints.ai_socktype = SOCK_STREAM;
-            hints.ai_protocol = IPPROTO_TCP;
-
-            d->freeAddr();
-
-            struct addrinfo* addr = nullptr;
-            int status = getaddrinfo(d->host().data(), nullptr, &hints, &addr);
-            if (status != 0)
-                return d->setError(Status_BadTcpCreate, StringLiteral("TCP. Error while getting address info for '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
-                                                        StringLiteral("'. Error code: ") + toModbusString(errno) +
-                                                        StringLiteral(". ") + getLastErrorText());
-            d->addr = addr;
-            d->socket->create(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-            if (d->socket->isInvalid())
+            // Note: connect is initiated once, its completion is detected by writability of the socket
+            int c;
+            if (d->local)
             {
-                d->freeAddr();
-                return d->setError(Status_BadTcpCreate, StringLiteral("TCP. Error while creating socket for '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
-                                                        StringLiteral("'. Error code: ") + toModbusString(errno) +
-                                                        StringLiteral(". ") + getLastErrorText());
+                // Note: Unix domain socket is defined by its path, so there is nothing to resolve
+                sockaddr_un addr;
+                socklen_t addrsz = toUnixAddress(d->host().data(), &addr);
+                if (!addrsz)
+                    return d->setError(Status_BadTcpCreate, d->errorText(StringLiteral("creating socket for")) +
+                                                            StringLiteral("'. Socket path is empty or too long"));
+                d->socket->create(AF_UNIX, d->seqpacket ? SOCK_SEQPACKET : SOCK_STREAM, 0);
+                if (d->socket->isInvalid())
+                {
+                    return d->setError(Status_BadTcpCreate, d->errorText(StringLiteral("creating socket for")) +
+                                                            StringLiteral("'. Error code: ") + toModbusString(errno) +
+                                                            StringLiteral(". ") + getLastErrorText());
+                }
+                d->socket->setBlocking(false);
+                if (isBlocking())
+                    d->socket->setTimeout(d->timeout());
+                d->socket->setOptions(d->sockopt(), false);
+                d->timestamp = timer();
+                c = d->socket->connect(reinterpret_cast<sockaddr*>(&addr), addrsz);
             }
-            d->socket->setBlocking(false); // Note: in case of block-socket it will be set after connect
-            if (isBlocking())
-                d->socket->setTimeout(d->timeout());
-            reinterpret_cast<sockaddr_in*>(d->addr->ai_addr)->sin_port = htons(d->port());
-            d->timestamp = timer();
-            d->state = STATE_WAIT_FOR_OPEN;
-        }
-        MB_FALLTHROUGH
-        case STATE_WAIT_FOR_OPEN:
-        {
-            if (isNonBlocking())
+            else
             {
-                int r = d->socket->connect(d->addr->ai_addr, static_cast<int>(d->addr->ai_addrlen));
-                if ((r == 0) || (errno == EISCONN))
+                if (!d->resolving)
                 {
-                    d->state = STATE_OPENED;
-                    return Status_Good;
+                    d->timestamp = timer();
+                    d->resolving = true;
                 }
-                else if (timer() - d->timestamp >= d->timeout())
+                // Note: non-blocking port doesn't wait for DNS, host name is resolved by background thread
+                int err = 0;
+                StatusCode r = ModbusResolver::instance().resolve(d->host(), isBlocking(), &d->addr, &err);
+                if (r == Status_Processing)
                 {
-                    d->socket->close();
-                    d->state = STATE_CLOSED;
-                    return d->setError(Status_BadTcpConnect,StringLiteral("TCP. Error while connecting to '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
+                    if (timer() - d->timestamp < d->timeout())
+                        return Status_Processing;
+                    d->resolving = false;
+                    return d->setError(Status_BadTcpCreate, d->errorText(StringLiteral("getting address info for")) +
                                                             StringLiteral("'. Timeout") );
                 }
+                d->resolving = false;
+                if (StatusIsBad(r))
+                    return d->setError(Status_BadTcpCreate, d->errorText(StringLiteral("getting address info for")) +
+                                                            StringLiteral("'. Error code: ") + toModbusString(err) +
+                                                            StringLiteral(". ") + gai_strerror(err));
+                d->socket->create(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+                if (d->socket->isInvalid())
+                {
+                    return d->setError(Status_BadTcpCreate, d->errorText(StringLiteral("creating socket for")) +
+                                                            StringLiteral("'. Error code: ") + toModbusString(errno) +
+                                                            StringLiteral(". ") + getLastErrorText());
+                }
+                d->socket->setBlocking(false); // Note: in case of block-socket it will be set after connect
+                if (isBlocking())
+                    d->socket->setTimeout(d->timeout());
+                // Note: options are set before connect, so buffer sizes take part in window negotiation
+                d->socket->setOptions(d->sockopt(), true);
+                if (d->sockopt().fastOpen)
+                    d->socket->setFastOpenConnect();
+                d->addr.sin_port = htons(d->port());
+                d->timestamp = timer();
+                c = d->socket->connect(reinterpret_cast<sockaddr*>(&d->addr), sizeof(d->addr));
             }
-            else
+            if ((c != 0) && (errno != EISCONN))
             {
-                int r = d->socket->connect(d->addr->ai_addr, static_cast<int>(d->addr->ai_addrlen));
-                if (r != 0 && errno != EISCONN)
+                if (errno != EINPROGRESS)
                 {
-                    if (errno != EINPROGRESS)
-                    {
-                        d->socket->close();
-                        d->state = STATE_CLOSED;
-                        return d->setError(Status_BadTcpConnect,StringLiteral("TCP. Error while connecting to '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
-                                                                StringLiteral("'. Error code: ") + toModbusString(errno) +
-                                                                StringLiteral(". ") + getLastErrorText());
-                    }
-                    // Use select() to wait for writability (i.e. successful connect)
-                    fd_set writefds;
-                    FD_ZERO(&writefds);
-                    FD_SET(d->socket->socket(), &writefds);
-
-                    struct timeval tv;
-                    tv.tv_sec = d->timeout() / 1000;
-                    tv.tv_usec = (d->timeout() % 1000) * 1000;
-                    
-                    // From Linux man: select(int nfds, ...)
-                    // nfds - This argument should be set to the highest-numbered file descriptor in any of the three sets, plus 1. 
-                    //        The indicated file descriptors in each set are checked, up to this limit
-                    r = select(d->socket->socket()+1, nullptr, &writefds, nullptr, &tv);
-                    if (r <= 0)
-                    {
-                        d->socket->close();
-                        d->state = STATE_CLOSED;
-                        if (r == 0)
-                            return d->setError(Status_BadTcpConnect,StringLiteral("TCP. Error while connecting to '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
-                                                                    StringLiteral("'. Timeout") );
-                        else
-                            return d->setError(Status_BadTcpConnect,StringLiteral("TCP. Error while connecting to '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
-                                                                    StringLiteral("'. Error code: ") + toModbusString(errno) +
-                                                                    StringLiteral(". ") + getLastErrorText());
-                    }
-
-                    // Check for errors after select
-                    int sockErr = 0;
-                    socklen_t len = sizeof(sockErr);
-                    getsockopt(d->socket->socket(), SOL_SOCKET, SO_ERROR, (char*)&sockErr, &len);
-                    if (sockErr != 0)
-                    {
-                        d->socket->close();
-                        d->state = STATE_CLOSED;
-                        return d->setError(Status_BadTcpConnect,StringLiteral("TCP. Error while connecting to '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
-                                                                StringLiteral("'. Error code: ") + toModbusString(sockErr) +
-                                                                StringLiteral(". ") + getLastErrorText());
-                    }
+                    int e = errno;
+                    d->socket->close();
+                    d->state = STATE_CLOSED;
+                    return d->setError(Status_BadTcpConnect,d->errorText(StringLiteral("connecting to")) +
+                                                            StringLiteral("'. Error code: ") + toModbusString(e) +
+                                                            StringLiteral(". ") + getLastErrorText());
                 }
-                // Success - set blocking mode
+                d->state = STATE_WAIT_FOR_OPEN;
+                fRepeatAgain = true;
+                break;
+            }
+            if (isBlocking())
                 d->socket->setBlocking(true);
-                d->state = STATE_OPENED;
-                return Status_Good;
+            d->state = STATE_OPENED;
+            return Status_Good;
+        }
+        case STATE_WAIT_FOR_OPEN:
+        {
+            // Note: poll() is used instead of select(), so descriptors above FD_SETSIZE are supported (large client fleets)
+            Timer elapsed = timer() - d->timestamp;
+            int wait = 0;
+            if (isBlocking())
+                wait = static_cast<int>(elapsed < d->timeout() ? d->timeout() - elapsed : 0);
+            int r = d->socket->waitWritable(wait);
+            if (r == 0)
+            {
+                if (isNonBlocking() && (elapsed < d->timeout()))
+                    return Status_Processing;
+                d->socket->close();
+                d->state = STATE_CLOSED;
+                return d->setError(Status_BadTcpConnect,d->errorText(StringLiteral("connecting to")) +
+                                                        StringLiteral("'. Timeout") );
+            }
+            int sockErr = 0;
+            if (r < 0)
+            {
+                if ((errno == EINTR) && isNonBlocking())
+                    return Status_Processing;
+                sockErr = errno;
+            }
+            else
+            {
+                socklen_t len = sizeof(sockErr);
+                d->socket->getsockopt(SOL_SOCKET, SO_ERROR, &sockErr, &len);
+            }
+            if (sockErr != 0)
+            {
+                d->socket->close();
+                d->state = STATE_CLOSED;
+                return d->setError(Status_BadTcpConnect,d->errorText(StringLiteral("connecting to")) +
+                                                        StringLiteral("'. Error code: ") + toModbusString(sockErr) +
+                                                        StringLiteral(". ") + strerror(sockErr));
             }
+            if (isBlocking())
+                d->socket->setBlocking(true);
+            d->state = STATE_OPENED;
+            return Status_Good;
         }
-            break;
         default:
             if (isOpen() && !d->isChanged())
             {
@@ -166,6 +213,7 @@ StatusCode ModbusTcpPortBase::close()
         d->socket->shutdown();
         d->socket->close();
     }
+    d->outq.clear();
     d->state = STATE_CLOSED;
     return Status_Good;
 }
@@ -173,19 +221,15 @@ StatusCode ModbusTcpPortBase::close()
 bool ModbusTcpPortBase::isOpen() const
 {
     ModbusTcpPortBasePrivateUnix *d = d_unix(d_ptr);
-    if (d->socket->isInvalid())
-        return false;
-    int error = 0;
-    socklen_t error_len = sizeof(error);
-    int r = d->socket->getsockopt(SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &error_len);
-    if (r != 0)
-        return false;
-    return (error == 0);
+    // Note: state is tracked by results of actual I/O (errors and remote close make port closed),
+    // so `isOpen()` doesn't make system calls and can be used on every step of transaction
+    return d->socket->isValid() && (d->state != STATE_WAIT_FOR_OPEN);
 }
 
 StatusCode ModbusTcpPortBase::write()
 {
     ModbusTcpPortBasePrivateUnix *d = d_unix(d_ptr);
+    ssize_t c = 0;
     bool fRepeatAgain;
     do
     {
@@ -195,22 +239,13 @@ StatusCode ModbusTcpPortBase::write()
         case STATE_OPENED:
         case STATE_PREPARE_TO_WRITE:
         case STATE_WAIT_FOR_WRITE:
+            d->timestamp = timer();
+            // Note: the rest of previous frames (if any) and current frame are sent by one call
+            c = d->sendQueued(d->buff(), d->buffSize());
+            d->state = STATE_WAIT_FOR_WRITE_ALL;
+            break;
         case STATE_WAIT_FOR_WRITE_ALL:
-        {
-            ssize_t c = d->socket->send(reinterpret_cast<char*>(d->buff()), d->buffSize(), 0);
-            if (c > 0)
-            {
-                d->state = STATE_OPENED;
-                return Status_Good;
-            }
-            else
-            {
-                close();
-                return d->setError(Status_BadTcpWrite, StringLiteral("TCP. Error while writing to '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
-                                                       StringLiteral("'. Error code: ") + toModbusString(errno) +
-                                                       StringLiteral(". ") + getLastErrorText());
-            }
-        }
+            c = d->sendQueued(nullptr, 0);
             break;
         default:
             if (this->isOpen())
@@ -224,7 +259,39 @@ StatusCode ModbusTcpPortBase::write()
         }
     }
     while (fRepeatAgain);
-    return Status_Processing;
+
+    // Note: blocking socket sends the rest of the frame within send timeout
+    while ((c > 0) && d->isBlocking() && !d->outq.isEmpty())
+    {
+        c = d->sendQueued(nullptr, 0);
+        if (c == 0)
+        {
+            errno = ETIMEDOUT;
+            c = -1;
+        }
+    }
+    if (c < 0)
+    {
+        int e = errno;
+        close();
+        return d->setError(Status_BadTcpWrite, d->errorText(StringLiteral("writing to")) +
+                                               StringLiteral("'. Error code: ") + toModbusString(e) +
+                                               StringLiteral(". ") + getLastErrorText());
+    }
+    // Note: server connection doesn't wait for slow client to receive the response,
+    // the rest of it is sent by next `read()` or together with next response
+    if (d->outq.isEmpty() || (d->modeServer() && (d->outq.size() <= MB_TCP_OUTPUT_QUEUE_SZ)))
+    {
+        d->state = STATE_OPENED;
+        return Status_Good;
+    }
+    if (d->isBlocking() || (timer() - d->timestamp >= d->timeout()))
+    {
+        close();
+        return d->setError(Status_BadTcpWrite, d->errorText(StringLiteral("writing to")) +
+                                               StringLiteral("'. Timeout") );
+    }
+    return Status_Processing; // Socket buffer is full, try again later
 }
 
 StatusCode ModbusTcpPortBase::read()
@@ -239,17 +306,52 @@ StatusCode ModbusTcpPortBase::read()
         case STATE_OPENED:
         case STATE_PREPARE_TO_READ:
             d->timestamp = timer();
+            d->readTimeoutRestore();
             d->state = STATE_WAIT_FOR_READ;
             MB_FALLTHROUGH
         case STATE_WAIT_FOR_READ:
+            d->state = STATE_WAIT_FOR_READ_ALL;
+            // Note: pipelined stream frame can be already received together with previous one
+            if (d->frame->startRead())
+            {
+                d->state = STATE_OPENED;
+                return Status_Good;
+            }
+            MB_FALLTHROUGH
         case STATE_WAIT_FOR_READ_ALL:
         {
-            ssize_t c = d->socket->recv(reinterpret_cast<char*>(d->buff()), d->buffMaxSize(), 0);
+            // Note: the rest of previous frames is sent when socket becomes writable
+            if (!d->outq.isEmpty() && (d->sendQueued(nullptr, 0) < 0))
+            {
+                int e = errno;
+                this->close();
+                return d->setError(Status_BadTcpWrite, d->errorText(StringLiteral("writing to")) +
+                                                       StringLiteral("'. Error code: ") + toModbusString(e) +
+                                                       StringLiteral(". ") + getLastErrorText());
+            }
+            ssize_t c = d->socket->recv(reinterpret_cast<char*>(d->buffNext()), d->buffFreeSize(), 0);
             if (c > 0)
             {
-                d->setBuffSize(static_cast<uint16_t>(c));
-                d->state = STATE_OPENED;
-                return Status_Good;
+                uint16_t offset = d->buffSize();
+                // Note: kernel keeps quick ACK mode for several segments, so it's rearmed once per response only
+                if (d->sockopt().quickAck && !d->local && !offset)
+                    d->socket->setQuickAck();
+                d->addBuffSize(static_cast<uint16_t>(c));
+                // Note: stream frame (ASCII) can be received by parts, so it is accumulated until its end is detected
+                if (!d->frame->isStreamFrame() || !d->buffFreeSize() || d->frame->isFrameEndDetected(offset))
+                {
+                    // Note: late responses to abandoned requests are dropped and actual response is waited within the same timeout
+                    if (d->frame->dropStaleFrames() && !d->buffSize())
+                    {
+                        if (d->isBlocking())
+                            d->readTimeoutReduce();
+                        fRepeatAgain = true;
+                        break;
+                    }
+                    d->state = STATE_OPENED;
+                    return Status_Good;
+                }
+                fRepeatAgain = d->isBlocking();
             }
             else if (c == 0)
             {
@@ -258,26 +360,45 @@ StatusCode ModbusTcpPortBase::read()
                 if (d->modeServer())
                     return Status_Uncertain;
                 else
-                    return d->setError(Status_BadTcpRead, StringLiteral("TCP. Error while reading from '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
+                    return d->setError(Status_BadTcpRead, d->errorText(StringLiteral("reading from")) +
                                                           StringLiteral("'. Remote connection closed") );
             }
+            else if (d->buffSize() && ((errno == EWOULDBLOCK) || (errno == EAGAIN)) &&
+                     (d->isBlocking() || (timer() - d->timestamp >= d->timeout())))
+            {
+                // Note: incomplete stream frame is passed to `readBuffer()` to be checked,
+                // socket error is reported below even if part of the frame is received
+                d->state = STATE_OPENED;
+                return Status_Good;
+            }
             else if (isNonBlocking() && (timer() - d->timestamp >= d->timeout())) // waiting timeout read first byte elapsed
             {
-                this->close();
-                return d->setError(Status_BadTcpRead, StringLiteral("TCP. Error while reading from '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
-                                                      StringLiteral("'. Timeout") );
+                // Note: late response is recognized by transaction id and dropped later, so connection is kept
+                if (d->frame->isTransactional())
+                    d->state = STATE_OPENED;
+                else
+                    this->close();
+                return d->setError(Status_BadTcpReadTimeout, d->errorText(StringLiteral("reading from")) +
+                                                             StringLiteral("'. Timeout") );
             }
             else
             {
                 int e = errno;
 #if EWOULDBLOCK == EAGAIN
-                if (d->isNonBlocking() && e == EWOULDBLOCK)
+                bool wouldBlock = (e == EWOULDBLOCK);
 #else
-                if (d->isNonBlocking() && (e == EWOULDBLOCK || e == EAGAIN))              
+                bool wouldBlock = (e == EWOULDBLOCK || e == EAGAIN);
 #endif 
+                if (d->isNonBlocking() && wouldBlock)
                     return Status_Processing; // No data available for non-blocking socket, try again later
+                if (wouldBlock && d->frame->isTransactional()) // blocking socket read timeout
+                {
+                    d->state = STATE_OPENED;
+                    return d->setError(Status_BadTcpReadTimeout, d->errorText(StringLiteral("reading from")) +
+                                                                 StringLiteral("'. Timeout") );
+                }
                 this->close();
-                return d->setError(Status_BadTcpRead, StringLiteral("TCP. Error while reading from '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
+                return d->setError(Status_BadTcpRead, d->errorText(StringLiteral("reading from")) +
                                                       StringLiteral("'. Error code: ") + toModbusString(e) +
                                                       StringLiteral(". ") + getLastErrorText());
             }
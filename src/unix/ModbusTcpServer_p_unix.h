@@ -6,14 +6,6 @@
 
 namespace Modbus {
 
-namespace ModbusTcpServerPrivateNS {
-
-typedef std::list<ModbusServerPort*> Connections_t;
-
-} // namespace ModbusTcpServerPrivateNS
-
-using namespace ModbusTcpServerPrivateNS;
-
 class ModbusTcpServerPrivateUnix : public ModbusTcpServerPrivate
 {
 public:
@@ -25,9 +17,14 @@ public:
 
     ~ModbusTcpServerPrivateUnix()
     {
+        delete this->spareSocket;
         delete this->socket;
     }
 
+public:
+    // Creates listening Unix domain socket with path `ipaddr`
+    StatusCode openLocal();
+
 public:
     ModbusSocket *socket;
 };
@@ -22,6 +22,8 @@
 */
 #include "../ModbusTcpServer.h"
 
+#include <sys/stat.h>
+
 #include "ModbusTcpServer_p_unix.h"
 
 ModbusTcpServer::ModbusTcpServer(Modbus::ProtocolType type, ModbusInterface *device) :
@@ -29,10 +31,93 @@ ModbusTcpServer::ModbusTcpServer(Modbus::ProtocolType type, ModbusInterface *dev
 {
 }
 
+// Returns `true` if nobody listens on Unix domain socket `addr`, so its file is left by the closed server
+static bool isStaleUnixSocket(const sockaddr_un &addr, socklen_t addrsz)
+{
+    // Note: type of the existing socket is unknown, connection to the socket of other type fails with `EPROTOTYPE`
+    const int types[] = {SOCK_STREAM, SOCK_SEQPACKET};
+    for (int type : types)
+    {
+        ModbusSocket probe;
+        if (probe.create(AF_UNIX, type, 0) == INVALID_SOCKET)
+            return false;
+        // Note: probe is non-blocking, so the listener with full queue doesn't block the call (`EAGAIN`)
+        probe.setBlocking(false);
+        int r = probe.connect(reinterpret_cast<const sockaddr*>(&addr), addrsz);
+        int err = errno;
+        probe.close();
+        if (r == 0)
+            return false;
+        if (err == ECONNREFUSED)
+            return true;
+        if (err != EPROTOTYPE)
+            return false;
+    }
+    return false;
+}
+
+StatusCode ModbusTcpServerPrivateUnix::openLocal()
+{
+    sockaddr_un addr;
+    socklen_t addrsz = toUnixAddress(this->ipaddr.data(), &addr);
+    if (!addrsz)
+        return setErrorBase(Status_BadTcpCreate, (StringLiteral("UNIX. Socket creation error for path '") + this->ipaddr +
+                                                  StringLiteral("'. Socket path is empty or too long")).data());
+    this->socket->create(AF_UNIX, this->seqpacket ? SOCK_SEQPACKET : SOCK_STREAM, 0);
+    if (this->socket->isInvalid())
+    {
+        this->state = STATE_CLOSED;
+        return setErrorBase(Status_BadTcpCreate, (StringLiteral("UNIX. Socket creation error for path '") + this->ipaddr +
+                                                  StringLiteral("'. Error code: ") + toModbusString(errno) +
+                                                  StringLiteral(". ") + getLastErrorText()).data());
+    }
+
+    // Note: socket file left by previous instance of the server prevents bind ("Address already in use"),
+    // so it's removed, but only if it's a socket and nobody listens on it
+    struct stat st;
+    if (addr.sun_path[0] && (::lstat(addr.sun_path, &st) == 0))
+    {
+        const Char *reason = nullptr;
+        if (!S_ISSOCK(st.st_mode))
+            reason = StringLiteral("Path exists and is not a socket");
+        else if (!isStaleUnixSocket(addr, addrsz))
+            reason = StringLiteral("Socket is in use by another server");
+        if (reason)
+        {
+            this->socket->close();
+            this->state = STATE_CLOSED;
+            return setErrorBase(Status_BadTcpBind, (StringLiteral("UNIX. Bind error for path '") + this->ipaddr +
+                                                    StringLiteral("'. ") + reason).data());
+        }
+        ::unlink(addr.sun_path);
+    }
+
+    if (this->socket->bind(reinterpret_cast<sockaddr*>(&addr), addrsz) == SOCKET_ERROR)
+    {
+        this->socket->close();
+        this->state = STATE_CLOSED;
+        return setErrorBase(Status_BadTcpBind, (StringLiteral("UNIX. Bind error for path '") + this->ipaddr +
+                                                StringLiteral("'. Error code: ") + toModbusString(errno) +
+                                                StringLiteral(". ") + getLastErrorText()).data());
+    }
+
+    if (this->socket->listen(this->backlog ? static_cast<int>(this->backlog) : SOMAXCONN) == SOCKET_ERROR)
+    {
+        this->socket->close();
+        this->state = STATE_CLOSED;
+        return setErrorBase(Status_BadTcpListen, (StringLiteral("UNIX. Listen error for path '") + this->ipaddr +
+                                                  StringLiteral("'. Error code: ") + toModbusString(errno) +
+                                                  StringLiteral(". ") + getLastErrorText()).data());
+    }
+    this->socket->setBlocking(false);
+    return Status_Good;
+}
+
 StatusCode ModbusTcpServer::open()
 {
     ModbusTcpServerPrivateUnix *d = d_unix(d_ptr);
     d->cmdClose = false;
+    d->changed = false;
     bool fRepeatAgain;
     do
     {
@@ -48,6 +133,9 @@ StatusCode ModbusTcpServer::open()
                 return Status_Good;
             }
 
+            if (d->isLocal())
+                return d->openLocal();
+
             d->socket->create(AF_INET, SOCK_STREAM, IPPROTO_TCP);
             if (d->socket->isInvalid())
             {
@@ -78,9 +166,12 @@ StatusCode ModbusTcpServer::open()
                                                            StringLiteral(". ") + getLastErrorText()).data());
             }
 
+            int backlog = d->backlog ? static_cast<int>(d->backlog) : SOMAXCONN;
+            if (d->sockopt.fastOpen)
+                d->socket->setFastOpenListen(backlog);
+
             // Listen on the socket
-            //if (d->socket->listen(SOMAXCONN) == SOCKET_ERROR)
-            if (d->socket->listen(d->maxconn) == SOCKET_ERROR)
+            if (d->socket->listen(backlog) == SOCKET_ERROR)
             {
                 d->socket->close();
                 d->state = STATE_CLOSED;
@@ -109,17 +200,22 @@ StatusCode ModbusTcpServer::close()
 {
     ModbusTcpServerPrivateUnix *d = d_unix(d_ptr);
     if (isOpen())
+    {
         d->socket->close();
+        // Note: socket file isn't removed by the system, so next server can bind to the same path
+        if (d->isLocal() && !d->ipaddr.empty() && (d->ipaddr[0] != '@'))
+            ::unlink(d->ipaddr.data());
+    }
     d->cmdClose = true;
-    for (ModbusServerPort *c : d->connections)
-        c->close();
+    for (Connection *c = d->connections.first; c; c = c->next)
+        c->resource->close();
     switch (d->state)
     {
     case STATE_WAIT_FOR_CLOSE:
-        for (ModbusServerPort *c : d->connections)
+        for (Connection *c = d->connections.first; c; c = c->next)
         {
-            c->process();
-            if (!c->isStateClosed())
+            c->resource->process();
+            if (!c->resource->isStateClosed())
                 return Status_Processing;
         }
         break;
@@ -137,29 +233,53 @@ bool ModbusTcpServer::isOpen() const
 ModbusSocket *ModbusTcpServer::nextPendingConnection()
 {
     ModbusTcpServerPrivateUnix *d = d_unix(d_ptr);
-    // Accept the incoming connection
-    sockaddr_in clientAddr;
-    socklen_t clientAddrSize = sizeof(clientAddr);
-    SOCKET clientSocket = d->socket->accept((sockaddr*)&clientAddr, &clientAddrSize);
-    if (clientSocket == INVALID_SOCKET)
+    // Note: connections over the limit are not accepted, they wait in the listen queue
+    // until one of the current connections is closed
+    if (d->connections.count >= d->maxconn)
+        return nullptr;
+    SOCKET clientSocket;
+    for (;;)
     {
-        if (errno != EWOULDBLOCK)
+        // Accept the incoming connection
+        sockaddr_storage clientAddr;
+        socklen_t clientAddrSize = sizeof(clientAddr);
+        clientSocket = d->socket->acceptNonBlocking((sockaddr*)&clientAddr, &clientAddrSize);
+        if (clientSocket == INVALID_SOCKET)
         {
+            int err = errno;
+            if ((err == EWOULDBLOCK) || (err == EAGAIN))
+                return nullptr;
+            // Note: connection was reset while it was in the queue or call was interrupted, try the next one
+            if ((err == ECONNABORTED) || (err == EPROTO) || (err == EINTR))
+                continue;
             d->socket->close();
             d->state = STATE_CLOSED;
+            return nullptr;
         }
-        return nullptr;
+        break;
     }
-    if (d->connections.size() >= d->maxconn)
+
+    ModbusSocket *tcp = d->spareSocket;
+    if (tcp)
     {
-        ::close(clientSocket);
-        return nullptr;
+        d->spareSocket = nullptr;
+        tcp->setSocket(clientSocket);
     }
-
-    ModbusSocket *tcp = new ModbusSocket(clientSocket);
+    else
+        tcp = new ModbusSocket(clientSocket);
+    tcp->setOptions(d->sockopt, !d->isLocal());
     return tcp;
 }
 
+void ModbusTcpServerPrivate::releaseSocket(ModbusSocket *socket)
+{
+    // Note: one spare object is enough because every accepted connection takes it back
+    if (this->spareSocket)
+        delete socket;
+    else
+        this->spareSocket = socket;
+}
+
 bool ModbusTcpServerPrivate::getHostService(ModbusSocket *socket, String &host, String &service)
 {
     sockaddr_storage clientAddr;
@@ -188,6 +308,13 @@ bool ModbusTcpServerPrivate::getHostService(ModbusSocket *socket, String &host,
             service = std::to_string(port);
             return true;
         }
+        else if (clientAddr.ss_family == AF_UNIX)
+        {
+            // Note: client of Unix domain socket is usually unnamed, so connection is named by its descriptor
+            host = StringLiteral("unix");
+            service = std::to_string(clientSocket);
+            return true;
+        }
     }
     return false;
 }
@@ -0,0 +1,66 @@
+#ifndef MODBUSUDPMULTICLIENT_P_UNIX_H
+#define MODBUSUDPMULTICLIENT_P_UNIX_H
+
+#include <map>
+
+#include <netdb.h>
+
+#include "../ModbusUdpMultiClient_p.h"
+
+#include "Modbus_unix.h"
+#include "ModbusResolver_unix.h"
+
+class ModbusUdpMultiClientPrivateUnix : public ModbusUdpMultiClientPrivate
+{
+public:
+    ModbusUdpMultiClientPrivateUnix(ProtocolType type) :
+        ModbusUdpMultiClientPrivate(type)
+    {
+        this->connected = false;
+        this->socket = new ModbusSocket();
+    }
+
+    ~ModbusUdpMultiClientPrivateUnix()
+    {
+        if (!this->socket->isInvalid())
+            this->socket->close();
+        delete this->socket;
+    }
+
+public:
+    static inline uint64_t peerKey(const sockaddr_in &a) { return (static_cast<uint64_t>(a.sin_addr.s_addr) << 16) | a.sin_port; }
+
+    // Passes datagram received from `peer` to the targets with the same address
+    inline void dispatch(const sockaddr_in &peer, const uint8_t *data, uint16_t sz)
+    {
+        auto it = this->peers.find(peerKey(peer));
+        if (it == this->peers.end())
+            return;
+        for (int i : it->second)
+        {
+            if (receiveReply(i, data, sz))
+                return;
+        }
+    }
+
+    // Resolves addresses of targets with queued requests
+    void resolveTargets();
+    // Connects the socket to the single target or disconnects it when other targets are added
+    void updateConnection();
+    void sendQueued();
+    void receiveAll();
+
+public:
+    ModbusSocket *socket;
+    bool connected;
+    std::vector<sockaddr_in> addrs; // resolved addresses of targets
+    std::map<uint64_t, std::vector<int> > peers; // address -> indexes of targets with this address
+#ifdef MB_UDP_MMSG
+    ModbusUdpBatch in;
+    ModbusUdpBatch out;
+#endif
+};
+
+static inline ModbusUdpMultiClientPrivateUnix *d_unix(ModbusObjectPrivate *d_ptr) { return static_cast<ModbusUdpMultiClientPrivateUnix*>(d_ptr); }
+
+#endif // MODBUSUDPMULTICLIENT_P_UNIX_H
@@ -0,0 +1,255 @@
+#include "ModbusUdpMultiClient_p_unix.h"
+
+#include "../ModbusUdpPortBase_p.h"
+
+ModbusUdpMultiClientPrivate *ModbusUdpMultiClientPrivate::create(ProtocolType type)
+{
+    return new ModbusUdpMultiClientPrivateUnix(type);
+}
+
+void ModbusUdpMultiClientPrivateUnix::resolveTargets()
+{
+    this->addrs.resize(this->targets.size());
+    for (size_t i = 0; i < this->targets.size(); i++)
+    {
+        Target &t = this->targets[i];
+        if (t.resolved || (t.state != TargetQueued))
+            continue;
+        // Note: host name is resolved by background thread, so requests to other targets are not delayed by DNS
+        int err = 0;
+        StatusCode r = ModbusResolver::instance().resolve(t.host, false, &this->addrs[i], &err);
+        if (r == Status_Processing)
+        {
+            if (timer() - t.timestamp >= t.timeout)
+                complete(static_cast<int>(i), Status_BadUdpCreate, StringLiteral("UDP. Error while getting address info for '") + t.host + StringLiteral(":") + toModbusString(t.port) +
+                                                                   StringLiteral("'. Timeout"));
+            continue;
+        }
+        // Note: failed resolution fails only the request of this target, the next request resolves the host again
+        if (StatusIsBad(r))
+        {
+            complete(static_cast<int>(i), Status_BadUdpCreate, StringLiteral("UDP. Error while getting address info for '") + t.host + StringLiteral(":") + toModbusString(t.port) +
+                                                               StringLiteral("'. Error code: ") + toModbusString(err) +
+                                                               StringLiteral(". ") + gai_strerror(err));
+            continue;
+        }
+        this->addrs[i].sin_port = htons(t.port);
+        this->peers[peerKey(this->addrs[i])].push_back(static_cast<int>(i));
+        t.resolved = true;
+    }
+}
+
+void ModbusUdpMultiClientPrivateUnix::updateConnection()
+{
+    // Note: socket of the single target is connected, so the kernel drops datagrams of other peers
+    bool single = (this->targets.size() == 1) && this->targets[0].resolved;
+    if (single && !this->connected)
+    {
+        // Note: if the socket can't be connected the target is served by unconnected socket
+        this->connected = (this->socket->connect(reinterpret_cast<sockaddr*>(&this->addrs[0]), sizeof(sockaddr_in)) == 0);
+    }
+    // Note: dissolving the association unbinds the ephemeral local port, so it waits until
+    // the request in progress is completed and requests to new targets stay queued until then
+    else if (!single && this->connected && (this->targets[0].state != TargetWaiting))
+    {
+        // Note: `AF_UNSPEC` address dissolves the association without reopening the socket
+        sockaddr addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sa_family = AF_UNSPEC;
+        this->socket->connect(&addr, sizeof(addr));
+        this->connected = false;
+    }
+#ifdef MB_UDP_MMSG
+    if (!this->connected && !this->peers.empty() && !this->in.capacity())
+    {
+        this->in.resize(MB_UDP_BATCH_SZ, MB_ASC_IO_BUFF_SZ);
+        this->out.resize(MB_UDP_BATCH_SZ, MB_ASC_IO_BUFF_SZ);
+    }
+#endif // MB_UDP_MMSG
+}
+
+void ModbusUdpMultiClientPrivateUnix::sendQueued()
+{
+#ifdef MB_UDP_MMSG
+    if (!this->connected)
+    {
+        int idx[MB_UDP_BATCH_SZ];
+        uint32_t n = 0;
+        auto sendBatch = [this, &idx, &n]()
+        {
+            uint32_t sent = 0;
+            while (sent < n)
+            {
+                int c = this->socket->sendmmsg(&this->out.msg[sent], n - sent, 0);
+                if (c <= 0)
+                {
+                    // Note: request that can't be sent fails only its own target, the rest of the batch is sent
+                    Target &t = this->targets[idx[sent]];
+                    complete(idx[sent], Status_BadUdpWrite, StringLiteral("UDP. Error while writing to '") + t.host + StringLiteral(":") + toModbusString(t.port) +
+                                                            StringLiteral("'. Error code: ") + toModbusString(errno) +
+                                                            StringLiteral(". ") + getLastErrorText());
+                    ++sent;
+                    continue;
+                }
+                Timer tm = timer();
+                for (uint32_t j = sent; j < sent + static_cast<uint32_t>(c); j++)
+                {
+                    this->targets[idx[j]].state = TargetWaiting;
+                    this->targets[idx[j]].timestamp = tm;
+                }
+                sent += static_cast<uint32_t>(c);
+            }
+            this->out.clear();
+            n = 0;
+        };
+
+        for (size_t i = 0; i < this->targets.size(); i++)
+        {
+            Target &t = this->targets[i];
+            if ((t.state != TargetQueued) || !t.resolved)
+                continue;
+            this->out.append(t.frame->buff, t.frame->sz, this->addrs[i]);
+            idx[n++] = static_cast<int>(i);
+            if (n == this->out.capacity())
+                sendBatch();
+        }
+        if (n)
+            sendBatch();
+        return;
+    }
+#endif // MB_UDP_MMSG
+    for (size_t i = 0; i < this->targets.size(); i++)
+    {
+        // Note: connected socket sends only to the first target
+        Target &t = this->targets[i];
+        if ((t.state != TargetQueued) || !t.resolved || (this->connected && i))
+            continue;
+        ssize_t c;
+        if (this->connected)
+            c = this->socket->send(t.frame->buff, t.frame->sz, 0);
+        else
+            c = this->socket->sendto(t.frame->buff, t.frame->sz, 0, reinterpret_cast<sockaddr*>(&this->addrs[i]), sizeof(sockaddr_in));
+        if (c < 0)
+        {
+            complete(static_cast<int>(i), Status_BadUdpWrite, StringLiteral("UDP. Error while writing to '") + t.host + StringLiteral(":") + toModbusString(t.port) +
+                                                              StringLiteral("'. Error code: ") + toModbusString(errno) +
+                                                              StringLiteral(". ") + getLastErrorText());
+            continue;
+        }
+        t.state = TargetWaiting;
+        t.timestamp = timer();
+    }
+}
+
+void ModbusUdpMultiClientPrivateUnix::receiveAll()
+{
+    if (this->connected)
+    {
+        uint8_t buff[MB_ASC_IO_BUFF_SZ];
+        for (;;)
+        {
+            ssize_t c = this->socket->recv(buff, sizeof(buff), 0);
+            if (c > 0)
+            {
+                receiveReply(0, buff, static_cast<uint16_t>(c));
+                continue;
+            }
+            if (c == 0) // Note: empty datagram is skipped
+                continue;
+            // Note: connected socket reports ICMP 'port unreachable' of the target as refused connection
+            if ((errno == ECONNREFUSED) && (this->targets[0].state == TargetWaiting))
+            {
+                Target &t = this->targets[0];
+                complete(0, Status_BadUdpRead, StringLiteral("UDP. Error while reading from '") + t.host + StringLiteral(":") + toModbusString(t.port) +
+                                               StringLiteral("'. Error code: ") + toModbusString(errno) +
+                                               StringLiteral(". ") + getLastErrorText());
+            }
+            return;
+        }
+    }
+#ifdef MB_UDP_MMSG
+    for (;;)
+    {
+        this->in.prepareToReceive();
+        int c = this->socket->recvmmsg(this->in.msg.data(), this->in.capacity(), 0);
+        if (c <= 0)
+            return;
+        for (int j = 0; j < c; j++)
+            dispatch(this->in.addr[j], this->in.data(j), this->in.size(j));
+        if (static_cast<uint32_t>(c) < this->in.capacity())
+            return;
+    }
+#else
+    uint8_t buff[MB_ASC_IO_BUFF_SZ];
+    for (;;)
+    {
+        sockaddr_in peer;
+        socklen_t addrsz = sizeof(peer);
+        ssize_t c = this->socket->recvfrom(buff, sizeof(buff), 0, reinterpret_cast<sockaddr*>(&peer), &addrsz);
+        if (c < 0)
+            return;
+        dispatch(peer, buff, static_cast<uint16_t>(c));
+    }
+#endif // MB_UDP_MMSG
+}
+
+Modbus::Handle ModbusUdpMultiClient::handle() const
+{
+    return reinterpret_cast<Handle>(d_unix(d_ptr)->socket->socket());
+}
+
+uint32_t ModbusUdpMultiClient::syscallCount() const
+{
+    return d_unix(d_ptr)->socket->syscallCount();
+}
+
+bool ModbusUdpMultiClient::isOpen() const
+{
+    return d_unix(d_ptr)->socket->isValid();
+}
+
+Modbus::StatusCode ModbusUdpMultiClient::open()
+{
+    ModbusUdpMultiClientPrivateUnix *d = d_unix(d_ptr);
+    if (d->socket->isValid())
+        return Status_Good;
+    d->socket->create(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (d->socket->isInvalid())
+        return d->setError(Status_BadUdpCreate, StringLiteral("UDP. Error while creating socket. Error code: ") + toModbusString(errno) +
+                                                StringLiteral(". ") + getLastErrorText());
+    d->socket->setBlocking(false);
+    return Status_Good;
+}
+
+Modbus::StatusCode ModbusUdpMultiClient::close()
+{
+    ModbusUdpMultiClientPrivateUnix *d = d_unix(d_ptr);
+    if (d->socket->isValid())
+        d->socket->close();
+    d->failPending(Status_BadPortClosed, StringLiteral("UDP. Socket is closed"));
+    for (Target &t : d->targets)
+        t.resolved = false;
+    d->peers.clear();
+    d->connected = false;
+    return Status_Good;
+}
+
+Modbus::StatusCode ModbusUdpMultiClient::process()
+{
+    ModbusUdpMultiClientPrivateUnix *d = d_unix(d_ptr);
+    if (d->socket->isInvalid())
+    {
+        StatusCode r = open();
+        if (StatusIsBad(r))
+        {
+            d->failPending(r, d->errorText);
+            return r;
+        }
+    }
+    d->resolveTargets();
+    d->updateConnection();
+    d->sendQueued();
+    d->receiveAll();
+    d->checkTimeouts();
+    return Status_Good;
+}
@@ -14,6 +14,7 @@ public:
         ModbusUdpPortBasePrivate(f, blocking)
     {
         this->timestamp = 0;
+        this->readTimeoutReduced = false;
         this->socket = new ModbusSocket();
     }
 
@@ -31,10 +32,47 @@ public:
     inline sockaddr_in* p_sockaddr_in() { return &sockadr; }
     inline sockaddr* p_sockaddr() { return reinterpret_cast<sockaddr*>(p_sockaddr_in()); }
 
+    // Note: blocking socket waits for the rest of response time only after dropped stale response
+    inline void readTimeoutReduce()
+    {
+        Timer t = timer() - this->timestamp;
+        this->socket->setTimeout(t < this->timeout() ? this->timeout() - t : 1);
+        this->readTimeoutReduced = true;
+    }
+
+    inline void readTimeoutRestore()
+    {
+        if (this->readTimeoutReduced)
+        {
+            this->socket->setTimeout(this->timeout());
+            this->readTimeoutReduced = false;
+        }
+    }
+
+    inline bool isBatched() const { return this->modeServer() && (this->batchSize > 1); }
+
+    // Receives the next datagram into `buff` and its peer address into `sockadr`
+    ssize_t receive(uint8_t *buff, uint16_t sz);
+
+    // Sends datagram to `sockadr`. Replies of the server are queued and sent together
+    // when all requests of the received batch are processed
+    ssize_t sendReply(const uint8_t *buff, uint16_t sz);
+
+    // Sends queued replies
+    void flush();
+
+    // Clears received and queued datagrams
+    void clearBatches();
+
 public:
     ModbusSocket *socket;
     Timer timestamp;
+    bool readTimeoutReduced;
     sockaddr_in sockadr;
+#ifdef MB_UDP_MMSG
+    ModbusUdpBatch in;
+    ModbusUdpBatch out;
+#endif
 };
 
 inline ModbusUdpPortBasePrivateUnix *d_unix(ModbusPortPrivate *d_ptr) { return static_cast<ModbusUdpPortBasePrivateUnix*>(d_ptr); }
@@ -7,11 +7,109 @@ ModbusUdpPortBasePrivate *ModbusUdpPortBasePrivate::create(ModbusFramePrivate *f
     return new ModbusUdpPortBasePrivateUnix(f, blocking);
 }
 
+ssize_t ModbusUdpPortBasePrivateUnix::receive(uint8_t *buff, uint16_t sz)
+{
+#ifdef MB_UDP_MMSG
+    if (isBatched())
+    {
+        for (;;)
+        {
+            if (in.next >= in.count)
+            {
+                // Note: replies to the previous batch are sent before waiting for the next one
+                flush();
+                if ((in.capacity() != batchSize) || (in.szData != buffMaxSize()))
+                {
+                    in.resize(batchSize, buffMaxSize());
+                    out.resize(batchSize, buffMaxSize());
+                }
+                else
+                    in.prepareToReceive();
+                int c = socket->recvmmsg(in.msg.data(), in.capacity(), isBlocking() ? MSG_WAITFORONE : 0);
+                if (c <= 0)
+                    return -1;
+                in.count = static_cast<uint32_t>(c);
+            }
+            uint32_t i = in.next++;
+            uint16_t c = in.size(i);
+            if (!c) // Note: empty datagram is skipped
+                continue;
+            if (c > sz)
+                c = sz;
+            memcpy(buff, in.data(i), c);
+            sockadr = in.addr[i];
+            return c;
+        }
+    }
+#endif // MB_UDP_MMSG
+    socklen_t addrsz = sizeof(sockaddr);
+    return socket->recvfrom(buff, sz, 0, p_sockaddr(), &addrsz);
+}
+
+ssize_t ModbusUdpPortBasePrivateUnix::sendReply(const uint8_t *buff, uint16_t sz)
+{
+#ifdef MB_UDP_MMSG
+    if (isBatched() && out.capacity())
+    {
+        if (out.count >= out.capacity())
+            flush();
+        out.append(buff, sz, sockadr);
+        if (in.next >= in.count)
+            flush();
+        return sz;
+    }
+#endif // MB_UDP_MMSG
+    return socket->sendto(buff, sz, 0, p_sockaddr(), sizeof(sockaddr));
+}
+
+void ModbusUdpPortBasePrivateUnix::flush()
+{
+#ifdef MB_UDP_MMSG
+    uint32_t sent = 0;
+    while (sent < out.count)
+    {
+        int c = socket->sendmmsg(&out.msg[sent], out.count - sent, 0);
+        // Note: datagram that can't be sent is dropped, so one unreachable peer doesn't stop replies to others
+        if (c <= 0)
+            c = 1;
+        sent += static_cast<uint32_t>(c);
+    }
+    out.clear();
+#endif // MB_UDP_MMSG
+}
+
+void ModbusUdpPortBasePrivateUnix::clearBatches()
+{
+#ifdef MB_UDP_MMSG
+    in.clear();
+    out.clear();
+#endif // MB_UDP_MMSG
+}
+
 Modbus::Handle ModbusUdpPortBase::handle() const
 {
     return reinterpret_cast<Handle>(d_unix(d_ptr)->socket->socket());
 }
 
+uint32_t ModbusUdpPortBase::syscallCount() const
+{
+    return d_unix(d_ptr)->socket->syscallCount();
+}
+
+uint32_t ModbusUdpPortBase::batchSize() const
+{
+    return d_unix(d_ptr)->batchSize;
+}
+
+void ModbusUdpPortBase::setBatchSize(uint32_t size)
+{
+    if (size < 1)
+        size = 1;
+    else if (size > MB_UDP_BATCH_MAX)
+        size = MB_UDP_BATCH_MAX;
+    d_unix(d_ptr)->batchSize = size;
+}
+
 Modbus::StatusCode ModbusUdpPortBase::open()
 {
     ModbusUdpPortBasePrivateUnix *d = d_unix(d_ptr);
@@ -85,6 +183,7 @@ Modbus::StatusCode ModbusUdpPortBase::open()
             d->socket->setBlocking(d->isBlocking());
             if (d->isBlocking())
                 d->socket->setTimeout(d->timeout());
+            d->socket->setOptions(d->sockopt(), false);
             d->state = STATE_OPENED;
             return Status_Good;
         default:
@@ -107,9 +206,11 @@ Modbus::StatusCode ModbusUdpPortBase::close()
     ModbusUdpPortBasePrivateUnix *d = d_unix(d_ptr);
     if (!d->socket->isInvalid())
     {
+        d->flush();
         d->socket->shutdown();
         d->socket->close();
     }
+    d->clearBatches();
     d->state = STATE_CLOSED;
     return Status_Good;
 }
@@ -117,14 +218,8 @@ Modbus::StatusCode ModbusUdpPortBase::close()
 bool ModbusUdpPortBase::isOpen() const
 {
     ModbusUdpPortBasePrivateUnix *d = d_unix(d_ptr);
-    if (d->socket->isInvalid())
-        return false;
-    int error = 0;
-    socklen_t error_len = sizeof(error);
-    int r = d->socket->getsockopt(SOL_SOCKET, SO_ERROR, &error, &error_len);
-    if (r != 0)
-        return false;
-    return (error == 0);
+    // Note: state is tracked by results of actual I/O, so `isOpen()` doesn't make system calls
+    return d->socket->isValid();
 }
 
 Modbus::StatusCode ModbusUdpPortBase::write()
@@ -141,12 +236,7 @@ Modbus::StatusCode ModbusUdpPortBase::write()
         case STATE_WAIT_FOR_WRITE:
         case STATE_WAIT_FOR_WRITE_ALL:
         {
-            int c = sendto(d->socket->socket(),
-                        reinterpret_cast<char*>(d->buff()),
-                        d->buffSize(),
-                        0,
-                        d->p_sockaddr(),
-                        sizeof(sockaddr));
+            ssize_t c = d->sendReply(d->buff(), d->buffSize());
             if (c > 0)
             {
                 d->state = STATE_OPENED;
@@ -188,23 +278,40 @@ Modbus::StatusCode ModbusUdpPortBase::read()
         case STATE_OPENED:
         case STATE_PREPARE_TO_READ:
             d->timestamp = timer();
+            d->readTimeoutRestore();
             d->state = STATE_WAIT_FOR_READ;
             MB_FALLTHROUGH
         case STATE_WAIT_FOR_READ:
+            d->state = STATE_WAIT_FOR_READ_ALL;
+            // Note: pipelined stream frame can be already received together with previous one
+            if (d->frame->startRead())
+            {
+                d->state = STATE_OPENED;
+                return Status_Good;
+            }
+            MB_FALLTHROUGH
         case STATE_WAIT_FOR_READ_ALL:
         {
-            socklen_t addrsz = sizeof(sockaddr);
-            int c = recvfrom(d->socket->socket(),
-                            reinterpret_cast<char*>(d->buff()),
-                            d->buffMaxSize(),
-                            0,
-                            d->p_sockaddr(),
-                            &addrsz);
+            ssize_t c = d->receive(d->buffNext(), d->buffFreeSize());
             if (c > 0)
             {
-                d->setBuffSize(static_cast<uint16_t>(c));
-                d->state = STATE_OPENED;
-                return Status_Good;
+                uint16_t offset = d->buffSize();
+                d->addBuffSize(static_cast<uint16_t>(c));
+                // Note: stream frame (ASCII) can be received by parts, so it is accumulated until its end is detected
+                if (!d->frame->isStreamFrame() || !d->buffFreeSize() || d->frame->isFrameEndDetected(offset))
+                {
+                    // Note: late responses to abandoned requests are dropped and actual response is waited within the same timeout
+                    if (d->frame->dropStaleFrames() && !d->buffSize())
+                    {
+                        if (d->isBlocking())
+                            d->readTimeoutReduce();
+                        fRepeatAgain = true;
+                        break;
+                    }
+                    d->state = STATE_OPENED;
+                    return Status_Good;
+                }
+                fRepeatAgain = d->isBlocking();
             }
             else if (c == 0)
             {
@@ -216,6 +323,14 @@ Modbus::StatusCode ModbusUdpPortBase::read()
                     return d->setError(Status_BadUdpRead, StringLiteral("UDP. Error while reading from '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
                                                           StringLiteral("'. Remote connection closed") );
             }
+            else if (d->buffSize() && ((errno == EWOULDBLOCK) || (errno == EAGAIN)) &&
+                     (d->isBlocking() || (timer() - d->timestamp >= d->timeout())))
+            {
+                // Note: incomplete stream frame is passed to `readBuffer()` to be checked,
+                // socket error is reported below even if part of the frame is received
+                d->state = STATE_OPENED;
+                return Status_Good;
+            }
             else if (isNonBlocking() && (timer() - d->timestamp >= d->timeout())) // waiting timeout to read first byte was elapsed
             {
                 //this->close();
@@ -227,11 +342,18 @@ Modbus::StatusCode ModbusUdpPortBase::read()
             {
                 int e = errno;
 #if EWOULDBLOCK == EAGAIN
-                if (d->isNonBlocking() && e == EWOULDBLOCK)
+                bool wouldBlock = (e == EWOULDBLOCK);
 #else
-                if (d->isNonBlocking() && (e == EWOULDBLOCK || e == EAGAIN))              
+                bool wouldBlock = (e == EWOULDBLOCK || e == EAGAIN);
 #endif 
+                if (d->isNonBlocking() && wouldBlock)
                     return Status_Processing; // No data available for non-blocking socket, try again later
+                if (wouldBlock && d->frame->isTransactional()) // blocking socket read timeout
+                {
+                    d->state = STATE_OPENED;
+                    return d->setError(Status_BadUdpReadTimeout, StringLiteral("UDP. Error while reading from '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
+                                                                 StringLiteral("'. Timeout") );
+                }
                 this->close();
                 return d->setError(Status_BadUdpRead, StringLiteral("UDP. Error while reading from '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
                                                       StringLiteral("'. Error code: ") + toModbusString(e) +
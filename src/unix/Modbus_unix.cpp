@@ -1,4 +1,5 @@
 #include "Modbus_unix.h"
+#include "ModbusResolver_unix.h"
 
 #include <time.h>
 #include <dirent.h>
@@ -30,6 +31,14 @@ Timer timer()
     return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
 }
 
+uint64_t timerUs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000 + static_cast<uint64_t>(ts.tv_nsec) / 1000;
+}
+
 Timestamp currentTimestamp()
 {
     struct timespec ts;
@@ -65,6 +74,14 @@ void msleep(uint32_t msec)
     nanosleep(&ts, NULL);
 }
 
+void microsleep(uint32_t usec)
+{
+    struct timespec ts;
+    ts.tv_sec = usec / 1000000;
+    ts.tv_nsec = (usec % 1000000) * 1000;
+    nanosleep(&ts, NULL);
+}
+
 String getLastErrorText()
 {
     String message = std::strerror(errno);  // strerror converts errno to a readable error message
@@ -107,4 +124,100 @@ List<String> availableSerialPorts()
     return ports;
 }
 
+uint32_t hostCacheTtl()
+{
+    return ModbusResolver::instance().ttl();
+}
+
+void setHostCacheTtl(uint32_t msec)
+{
+    ModbusResolver::instance().setTtl(msec);
+}
+
+void clearHostCache()
+{
+    ModbusResolver::instance().clear();
+}
+
 } // namespace Modbus
+
+void ModbusSocket::setOptions(const Modbus::SocketOptions &options, bool stream)
+{
+    int v;
+    if (options.sendBufferSize)
+    {
+        v = static_cast<int>(options.sendBufferSize);
+        setsockopt(SOL_SOCKET, SO_SNDBUF, &v, sizeof(v));
+    }
+    if (options.recvBufferSize)
+    {
+        v = static_cast<int>(options.recvBufferSize);
+        setsockopt(SOL_SOCKET, SO_RCVBUF, &v, sizeof(v));
+    }
+#ifdef SO_BUSY_POLL
+    if (options.busyPoll)
+    {
+        v = static_cast<int>(options.busyPoll);
+        setsockopt(SOL_SOCKET, SO_BUSY_POLL, &v, sizeof(v));
+    }
+#endif
+    if (!stream)
+        return;
+    if (options.noDelay)
+    {
+        v = 1;
+        setsockopt(IPPROTO_TCP, TCP_NODELAY, &v, sizeof(v));
+    }
+    if (options.quickAck)
+        setQuickAck();
+    if (options.keepAlive)
+    {
+        v = 1;
+        setsockopt(SOL_SOCKET, SO_KEEPALIVE, &v, sizeof(v));
+#ifdef TCP_KEEPIDLE
+        if (options.keepAliveIdle)
+        {
+            v = static_cast<int>(options.keepAliveIdle);
+            setsockopt(IPPROTO_TCP, TCP_KEEPIDLE, &v, sizeof(v));
+        }
+#endif
+#ifdef TCP_KEEPINTVL
+        if (options.keepAliveInterval)
+        {
+            v = static_cast<int>(options.keepAliveInterval);
+            setsockopt(IPPROTO_TCP, TCP_KEEPINTVL, &v, sizeof(v));
+        }
+#endif
+#ifdef TCP_KEEPCNT
+        if (options.keepAliveCount)
+        {
+            v = static_cast<int>(options.keepAliveCount);
+            setsockopt(IPPROTO_TCP, TCP_KEEPCNT, &v, sizeof(v));
+        }
+#endif
+    }
+#ifdef TCP_USER_TIMEOUT
+    if (options.userTimeout)
+    {
+        unsigned int t = options.userTimeout;
+        setsockopt(IPPROTO_TCP, TCP_USER_TIMEOUT, &t, sizeof(t));
+    }
+#endif
+}
+
+void ModbusSocket::setFastOpenConnect()
+{
+#ifdef TCP_FASTOPEN_CONNECT
+    int v = 1;
+    setsockopt(IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &v, sizeof(v));
+#endif
+}
+
+void ModbusSocket::setFastOpenListen(int qlen)
+{
+#ifdef TCP_FASTOPEN
+    setsockopt(IPPROTO_TCP, TCP_FASTOPEN, &qlen, sizeof(qlen));
+#else
+    (void)qlen;
+#endif
+}
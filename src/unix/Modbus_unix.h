@@ -2,16 +2,28 @@
 #define MODBUS_UNIX_H
 
 #include <ctime>
+#include <vector>
+#include <cstring>
+#include <cstddef>
 #include <fcntl.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
 #include <netinet/in.h>
 #include <unistd.h>
 #include <arpa/inet.h>
 #include <sys/time.h>
 #include <sys/select.h>
+#include <poll.h>
+#include <netinet/tcp.h>
 
 #include "../Modbus.h"
 
+// Note: several datagrams can be received/sent by one system call (`recvmmsg()`/`sendmmsg()`) only on Linux
+#if defined(__linux__) && defined(MSG_WAITFORONE)
+#define MB_UDP_MMSG
+#endif
+
 typedef int SOCKET;
 #define INVALID_SOCKET (-1)
 #define SOCKET_ERROR (-1)
@@ -19,7 +31,7 @@ typedef int SOCKET;
 class ModbusSocket
 {
 public:
-    ModbusSocket(SOCKET socket = INVALID_SOCKET) : m_socket(socket) {}
+    ModbusSocket(SOCKET socket = INVALID_SOCKET) : m_socket(socket), m_syscalls(0) {}
 
 public:
     inline bool isValid() const { return m_socket != INVALID_SOCKET; }
@@ -27,7 +39,9 @@ public:
     inline SOCKET socket() const { return m_socket; }
     inline void setSocket(SOCKET socket) { m_socket = socket; }
     inline ModbusSocket &operator=(SOCKET socket) { setSocket(socket); return *this; }
-    inline void setBlocking(bool block) { int flags = fcntl(m_socket, F_GETFL, 0); fcntl(m_socket, F_SETFL, block ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK)); }
+    inline uint32_t syscallCount() const { return m_syscalls; }
+    inline void setBlocking(bool block) { m_syscalls += 2; int flags = fcntl(m_socket, F_GETFL, 0); fcntl(m_socket, F_SETFL, block ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK)); }
+    inline int waitWritable(int timeout) { ++m_syscalls; pollfd p; p.fd = m_socket; p.events = POLLOUT; p.revents = 0; return ::poll(&p, 1, timeout); }
     inline void setTimeout(uint32_t timeout)
     {
         timeval tv
@@ -35,24 +49,177 @@ public:
             .tv_sec = timeout / 1000,
             .tv_usec = (timeout % 1000) * 1000
         };
-        setsockopt(m_socket, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
-        setsockopt(m_socket, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        m_syscalls += 2;
+        ::setsockopt(m_socket, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+        ::setsockopt(m_socket, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
     }
 
 public: // socket interface
-    inline SOCKET create(int domain, int type, int protocol) { m_socket = ::socket(domain, type, protocol); return m_socket; }
-    inline int getsockopt(int level, int optname, void *optval, socklen_t *optlen) { return ::getsockopt(m_socket, level, optname, optval, optlen); }
-    inline int connect(const struct sockaddr *name, socklen_t namelen) { return ::connect(m_socket, name, namelen); }
-    inline int bind(const struct sockaddr *name, socklen_t namelen) { return ::bind(m_socket, name, namelen); }
-    inline int listen(int backlog) { return ::listen(m_socket, backlog); }
-    inline SOCKET accept(struct sockaddr *addr, socklen_t *addrlen) { return ::accept(m_socket, addr, addrlen); }
-    inline ssize_t send(const void *buf, size_t len, int flags) { return ::send(m_socket, buf, len, flags); }
-    inline ssize_t recv(void *buf, size_t len, int flags) { return ::recv(m_socket, buf, len, flags); }
-    inline void shutdown() { ::shutdown(m_socket, SHUT_RDWR); }
-    inline void close() { ::close(m_socket); m_socket = INVALID_SOCKET; }
+    inline SOCKET create(int domain, int type, int protocol) { ++m_syscalls; m_socket = ::socket(domain, type, protocol); return m_socket; }
+    inline int getsockopt(int level, int optname, void *optval, socklen_t *optlen) { ++m_syscalls; return ::getsockopt(m_socket, level, optname, optval, optlen); }
+    inline int setsockopt(int level, int optname, const void *optval, socklen_t optlen) { ++m_syscalls; return ::setsockopt(m_socket, level, optname, optval, optlen); }
+    inline int connect(const struct sockaddr *name, socklen_t namelen) { ++m_syscalls; return ::connect(m_socket, name, namelen); }
+    inline int bind(const struct sockaddr *name, socklen_t namelen) { ++m_syscalls; return ::bind(m_socket, name, namelen); }
+    inline int listen(int backlog) { ++m_syscalls; return ::listen(m_socket, backlog); }
+    inline SOCKET accept(struct sockaddr *addr, socklen_t *addrlen) { ++m_syscalls; return ::accept(m_socket, addr, addrlen); }
+    // Accepts connection and makes it non-blocking and close-on-exec, atomically with `accept4()` if it's available
+    inline SOCKET acceptNonBlocking(struct sockaddr *addr, socklen_t *addrlen)
+    {
+#if defined(__linux__) && defined(SOCK_NONBLOCK)
+        ++m_syscalls;
+        return ::accept4(m_socket, addr, addrlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
+        SOCKET s = accept(addr, addrlen);
+        if (s != INVALID_SOCKET)
+        {
+            m_syscalls += 3;
+            fcntl(s, F_SETFL, fcntl(s, F_GETFL, 0) | O_NONBLOCK);
+            fcntl(s, F_SETFD, FD_CLOEXEC);
+        }
+        return s;
+#endif
+    }
+    inline ssize_t send(const void *buf, size_t len, int flags) { ++m_syscalls; return ::send(m_socket, buf, len, flags); }
+    inline ssize_t recv(void *buf, size_t len, int flags) { ++m_syscalls; return ::recv(m_socket, buf, len, flags); }
+    // Sends two buffers by one call (gathering `sendmsg()`), empty buffer is skipped
+    inline ssize_t sendv(const void *buf1, size_t len1, const void *buf2, size_t len2, int flags)
+    {
+        if (!len1)
+            return send(buf2, len2, flags);
+        if (!len2)
+            return send(buf1, len1, flags);
+        ++m_syscalls;
+        iovec iov[2];
+        iov[0].iov_base = const_cast<void*>(buf1);
+        iov[0].iov_len  = len1;
+        iov[1].iov_base = const_cast<void*>(buf2);
+        iov[1].iov_len  = len2;
+        msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov    = iov;
+        msg.msg_iovlen = 2;
+        return ::sendmsg(m_socket, &msg, flags);
+    }
+    inline ssize_t sendto(const void *buf, size_t len, int flags, const struct sockaddr *addr, socklen_t addrlen) { ++m_syscalls; return ::sendto(m_socket, buf, len, flags, addr, addrlen); }
+    inline ssize_t recvfrom(void *buf, size_t len, int flags, struct sockaddr *addr, socklen_t *addrlen) { ++m_syscalls; return ::recvfrom(m_socket, buf, len, flags, addr, addrlen); }
+#ifdef MB_UDP_MMSG
+    inline int sendmmsg(struct mmsghdr *msgvec, unsigned int vlen, int flags) { ++m_syscalls; return ::sendmmsg(m_socket, msgvec, vlen, flags); }
+    inline int recvmmsg(struct mmsghdr *msgvec, unsigned int vlen, int flags) { ++m_syscalls; return ::recvmmsg(m_socket, msgvec, vlen, flags, nullptr); }
+#endif // MB_UDP_MMSG
+    inline void shutdown() { ++m_syscalls; ::shutdown(m_socket, SHUT_RDWR); }
+    inline void close() { ++m_syscalls; ::close(m_socket); m_socket = INVALID_SOCKET; }
+
+public: // options
+    // Applies socket level options and, if `stream` is `true`, TCP options (except fast open) from `options`.
+    // Options are not critical, so errors (e.g. option is not supported by the kernel) are ignored.
+    void setOptions(const Modbus::SocketOptions &options, bool stream);
+
+    // Enables TCP Fast Open for client socket before connect (`TCP_FASTOPEN_CONNECT`)
+    void setFastOpenConnect();
+
+    // Enables TCP Fast Open for listening socket before listen (`TCP_FASTOPEN`) with queue length `qlen`
+    void setFastOpenListen(int qlen);
+
+    // Disables delayed ACK, must be rearmed after read because kernel may leave quick ACK mode
+    inline void setQuickAck()
+    {
+#ifdef TCP_QUICKACK
+        int v = 1;
+        setsockopt(IPPROTO_TCP, TCP_QUICKACK, &v, sizeof(v));
+#endif
+    }
 
 private:
     SOCKET m_socket;
+    uint32_t m_syscalls; // count of system calls made through this object
+};
+
+// Fills address of Unix domain socket with `path`. On Linux path that starts with '@' is the name in abstract namespace.
+// Returns size of the address or 0 if `path` is empty or too long
+inline socklen_t toUnixAddress(const char *path, sockaddr_un *addr)
+{
+    size_t len = strlen(path);
+    if ((len == 0) || (len >= sizeof(addr->sun_path)))
+        return 0;
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    memcpy(addr->sun_path, path, len);
+#ifdef __linux__
+    if (path[0] == '@')
+    {
+        addr->sun_path[0] = '\0'; // Note: the name isn't null-terminated, its size is defined by address size
+        return static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + len);
+    }
+#endif
+    return static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + len + 1);
+}
+
+#ifdef MB_UDP_MMSG
+// Set of datagrams (data and peer address of every one) received or sent by one system call
+class ModbusUdpBatch
+{
+public:
+    ModbusUdpBatch() : count(0), next(0), szData(0) {}
+
+public:
+    inline uint32_t capacity() const { return static_cast<uint32_t>(msg.size()); }
+    inline uint8_t *data(uint32_t i) { return &buff[i * szData]; }
+    inline uint16_t size(uint32_t i) const { return static_cast<uint16_t>(msg[i].msg_len); }
+    inline void clear() { count = 0; next = 0; }
+
+    void resize(uint32_t capacity, uint16_t szData)
+    {
+        this->szData = szData;
+        buff.resize(capacity * szData);
+        addr.resize(capacity);
+        iov.resize(capacity);
+        msg.resize(capacity);
+        memset(msg.data(), 0, capacity * sizeof(mmsghdr));
+        for (uint32_t i = 0; i < capacity; i++)
+        {
+            iov[i].iov_base = data(i);
+            iov[i].iov_len = szData;
+            msg[i].msg_hdr.msg_name = &addr[i];
+            msg[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            msg[i].msg_hdr.msg_iov = &iov[i];
+            msg[i].msg_hdr.msg_iovlen = 1;
+        }
+        clear();
+    }
+
+    // Restores buffer sizes changed by previous `recvmmsg()`
+    void prepareToReceive()
+    {
+        for (uint32_t i = 0; i < capacity(); i++)
+        {
+            iov[i].iov_len = szData;
+            msg[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            msg[i].msg_hdr.msg_flags = 0;
+        }
+        clear();
+    }
+
+    // Appends datagram to be sent to `peer`
+    void append(const uint8_t *buff, uint16_t sz, const sockaddr_in &peer)
+    {
+        if (sz > szData)
+            sz = szData;
+        memcpy(data(count), buff, sz);
+        iov[count].iov_len = sz;
+        addr[count] = peer;
+        msg[count].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        ++count;
+    }
+
+public:
+    std::vector<uint8_t> buff;
+    std::vector<sockaddr_in> addr;
+    std::vector<iovec> iov;
+    std::vector<mmsghdr> msg;
+    uint32_t count; // count of datagrams in the batch
+    uint32_t next;  // index of the next datagram to be processed
+    uint16_t szData;
 };
+#endif // MB_UDP_MMSG
 
 #endif // MODBUS_UNIX_H
@@ -92,6 +92,47 @@ public:
     inline void serialPortClose() { CloseHandle(serialPort); serialPort = INVALID_HANDLE_VALUE; }
     inline void timestampRefresh() { timestamp = GetTickCount(); }
 
+    // Returns count of bytes available in the input queue
+    inline DWORD inputAvailable()
+    {
+        COMSTAT stat;
+        DWORD errors;
+        if (!ClearCommError(serialPort, &errors, &stat))
+            return 0;
+        return stat.cbInQue;
+    }
+
+    // Waits for input data no more than `usec` microseconds. Returns `true` if data is available
+    inline bool waitForInput(uint32_t usec)
+    {
+        uint64_t end = timerUs() + usec;
+        while (inputAvailable() == 0)
+        {
+            if (timerUs() >= end)
+                return false;
+            microsleep(50);
+        }
+        return true;
+    }
+
+    // Note: late response to the failed request can still be on the bus, so received bytes are dropped
+    // until the frame boundary (t3.5 silence) and only then the next request is transmitted.
+    // Returns `true` if input is synchronized
+    inline bool inputResync()
+    {
+        if (!inputResyncRequired)
+            return true;
+        if (inputAvailable())
+        {
+            PurgeComm(serialPort, PURGE_RXCLEAR);
+            activityRefresh();
+        }
+        if (!isInputResynced())
+            return false;
+        inputResyncRequired = false;
+        return true;
+    }
+
 public:
     StatusCode blockingWrite();
     StatusCode blockingRead();
@@ -127,7 +168,12 @@ StatusCode ModbusSerialPortPrivateWin::blockingWrite()
 {
     BOOL r;
     this->state = STATE_OPENED;
-    PurgeComm(this->serialPort, PURGE_TXCLEAR|PURGE_RXCLEAR);
+    // Note: keep minimum gap (t3.5 and/or turnaround delay) before transmit
+    while (!this->inputResync())
+        microsleep(this->resyncDelayUs());
+    uint32_t delay = this->transmitDelayUs();
+    if (delay)
+        microsleep(delay);
     r =  WriteFile(this->serialPort, this->buff(), this->buffSize(), NULL, NULL);
     if (!r)
     {
@@ -136,6 +182,7 @@ StatusCode ModbusSerialPortPrivateWin::blockingWrite()
                                                      StringLiteral("' serial port. Error code: ") + toModbusString(err) +
                                                      StringLiteral(". ") + getLastErrorText());
     }
+    this->activityTransmitted(this->buffSize());
     return Status_Good;
 }
 
@@ -144,15 +191,45 @@ StatusCode ModbusSerialPortPrivateWin::blockingRead()
     BOOL r;
     DWORD c;
     this->state = STATE_OPENED;
-    r = ReadFile(this->serialPort, this->buff(), this->buffMaxSize(), &c, NULL);
-    if (!r)
+    // Note: pipelined stream frame can be already received together with previous one
+    if (this->frame->startRead())
+        return Status_Good;
+    // Note: stream frame (ASCII) and frame with automatic timing are read by the parts available
+    // in the input queue (at least 1 byte), so read is completed as soon as the end of frame is
+    // detected by its content or by t3.5 silence but not by inter-byte timeout
+    const bool byParts = this->frame->isStreamFrame() || this->isAutoTiming();
+    while (true)
     {
-        DWORD err = GetLastError();
-        return this->setError(Status_BadSerialRead, StringLiteral("Error while reading '") + this->portName() +
-                                                    StringLiteral("' serial port. Error code: ") + toModbusString(err) +
-                                                    StringLiteral(". ") + getLastErrorText());
+        DWORD sz = this->buffFreeSize();
+        if (byParts)
+        {
+            DWORD available = inputAvailable();
+            if (available == 0)
+                sz = 1;
+            else if (available < sz)
+                sz = available;
+        }
+        r = ReadFile(this->serialPort, this->buffNext(), sz, &c, NULL);
+        if (!r)
+        {
+            DWORD err = GetLastError();
+            return this->setError(Status_BadSerialRead, StringLiteral("Error while reading '") + this->portName() +
+                                                        StringLiteral("' serial port. Error code: ") + toModbusString(err) +
+                                                        StringLiteral(". ") + getLastErrorText());
+        }
+        uint16_t offset = this->buffSize();
+        this->addBuffSize(static_cast<uint16_t>(c));
+        if ((c == 0) || (this->buffFreeSize() == 0) || !byParts)
+            break;
+        this->activityRefresh();
+        if (this->frame->isStreamFrame())
+        {
+            if (this->frame->isFrameEndDetected(offset))
+                break;
+        }
+        else if (!this->waitForInput(this->timing.interFrameUs))
+            break;
     }
-    this->setBuffSize(static_cast<uint16_t>(c));
     return Status_Good;
 }
 
@@ -167,8 +244,9 @@ StatusCode ModbusSerialPortPrivateWin::nonBlockingWrite()
         {
         case STATE_OPENED:
         case STATE_PREPARE_TO_WRITE:
-            // Note: clean read buffer from garbage before write
-            PurgeComm(this->serialPort, PURGE_TXCLEAR|PURGE_RXCLEAR);
+            // Note: keep minimum gap (t3.5 and/or turnaround delay) before transmit
+            if (!this->inputResync() || this->transmitDelayUs())
+                return Status_Processing;
             zeroOverlapped(this->oWrite);
             this->oWrite.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
             if (this->oWrite.hEvent == NULL)
@@ -197,6 +275,7 @@ StatusCode ModbusSerialPortPrivateWin::nonBlockingWrite()
                                                                  StringLiteral(". ") + getLastErrorText());
                 }
             }
+            this->activityTransmitted(this->buffSize());
             this->state = STATE_OPENED;
             closeEventHandle(this->oWrite);
             return Status_Good;
@@ -227,6 +306,12 @@ StatusCode ModbusSerialPortPrivateWin::nonBlockingRead()
         {
         case STATE_OPENED:
         case STATE_PREPARE_TO_READ:
+            // Note: pipelined stream frame can be already received together with previous one
+            if (this->frame->startRead())
+            {
+                this->state = STATE_OPENED;
+                return Status_Good;
+            }
             zeroOverlapped(this->oRead);
             this->oRead.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
             if (this->oRead.hEvent == NULL)
@@ -237,13 +322,12 @@ StatusCode ModbusSerialPortPrivateWin::nonBlockingRead()
                                                              StringLiteral("' serial port (CreateEvent). Error code: ") + toModbusString(err) +
                                                              StringLiteral(". ") + getLastErrorText());
             }
-            this->setBuffSize(0);
             this->timestampRefresh();
             this->state = STATE_WAIT_FOR_READ;
             MB_FALLTHROUGH
         case STATE_WAIT_FOR_READ:
             // read first bytes
-            r = ReadFile(this->serialPort, this->buff(), this->buffMaxSize(), &c, &this->oRead);
+            r = ReadFile(this->serialPort, this->buffNext(), this->buffFreeSize(), &c, &this->oRead);
             if (!r)
             {
                 DWORD err = GetLastError();
@@ -258,9 +342,12 @@ StatusCode ModbusSerialPortPrivateWin::nonBlockingRead()
             }
             if (c > 0)
             {
+                uint16_t offset = this->buffSize();
                 this->addBuffSize(static_cast<uint16_t>(c));
-                if ((this->timeoutInterByte() == 0) || // timeoutInterByte = 0 means no need to wait next bytes
-                    (this->buffSize() == this->buffMaxSize()))    // input buffer is full. Try to handle it
+                this->activityRefresh();
+                if ((!this->isAutoTiming() && (this->timeoutInterByte() == 0)) || // timeoutInterByte = 0 means no need to wait next bytes
+                    (this->buffSize() == this->buffMaxSize()) ||  // input buffer is full. Try to handle it
+                    this->frame->isFrameEndDetected(offset))      // end of frame is detected by its content (ASCII)
                 {
                     this->state = STATE_OPENED;
                     return Status_Good;
@@ -304,10 +391,14 @@ StatusCode ModbusSerialPortPrivateWin::nonBlockingRead()
             }
             if (c > 0)
             {
+                uint16_t offset = this->buffSize();
                 this->addBuffSize(static_cast<uint16_t>(c));
-                if (this->buffSize() == this->buffMaxSize()) // input buffer is full. Try to handle it
+                this->activityRefresh();
+                if ((this->buffSize() == this->buffMaxSize()) || // input buffer is full. Try to handle it
+                    this->frame->isFrameEndDetected(offset))     // end of frame is detected by its content (ASCII)
                 {
                     this->state = STATE_OPENED;
+                    closeEventHandle(this->oRead);
                     return Status_Good;
                 }
                 if (this->buffSize() > this->buffMaxSize())
@@ -318,7 +409,7 @@ StatusCode ModbusSerialPortPrivateWin::nonBlockingRead()
                 }
                 this->timestampRefresh();
             }
-            else if (GetTickCount() - this->timestamp >= this->timeoutInterByte()) // waiting timeout read next byte elapsed
+            else if (this->isFrameSilenceElapsed(this->timestamp)) // waiting timeout read next byte (or t3.5) elapsed
             {
                 this->state = STATE_OPENED;
                 closeEventHandle(this->oRead);
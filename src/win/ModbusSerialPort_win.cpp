@@ -35,6 +35,8 @@ StatusCode ModbusSerialPort::open()
                 }
             }
             d->clearChanged();
+            d->timingRefresh();
+            d->inputResyncRequest();
             DWORD dwFlags;
             if (d->isBlocking())
                 dwFlags = 0; // Disables overlapped I/O
@@ -90,6 +92,9 @@ StatusCode ModbusSerialPort::open()
             dcb.StopBits = winStopBits(d->stopBits());
             dcb.Parity   = winParity(d->parity());
             winFillDCBFlowControl(&dcb,d->flowControl());
+            // Note: RS-485 transmitter is enabled by the driver while transmitting (RTS delays are not supported)
+            if (d->isRs485())
+                dcb.fRtsControl = RTS_CONTROL_TOGGLE;
 
             if (!SetCommState(d->serialPort, &dcb))
             {
@@ -160,12 +165,18 @@ bool ModbusSerialPort::isOpen() const
 StatusCode ModbusSerialPort::write()
 {
     ModbusSerialPortPrivateWin *d = d_win(d_ptr);
-    return (d->*(d->writeMethod))();
+    // Note: method pointer is taken first, GCC instruments `d->*(d->method)` with `-fsanitize=vptr`
+    // as member access of `this` object instead of `d`
+    ModbusSerialPortPrivateWin::RWMethodPtr_t method = d->writeMethod;
+    return (d->*method)();
 }
 
 StatusCode ModbusSerialPort::read()
 {
     ModbusSerialPortPrivateWin *d = d_win(d_ptr);
-    return (d->*(d->readMethod))();
+    ModbusSerialPortPrivateWin::RWMethodPtr_t method = d->readMethod;
+    StatusCode r = (d->*method)();
+    d->inputCheck(r);
+    return r;
 }
 
@@ -16,6 +16,7 @@ public:
 
         this->timestamp = 0;
         this->addr = nullptr;
+        this->readTimeoutReduced = false;
 
         if (socket)
         {
@@ -52,9 +53,43 @@ public:
         }
     }
 
+    // Note: blocking socket waits for the rest of response time only after dropped stale response
+    inline void readTimeoutReduce()
+    {
+        DWORD t = GetTickCount() - this->timestamp;
+        this->socket->setTimeout(t < this->timeout() ? this->timeout() - t : 1);
+        this->readTimeoutReduced = true;
+    }
+
+    inline void readTimeoutRestore()
+    {
+        if (this->readTimeoutReduced)
+        {
+            this->socket->setTimeout(this->timeout());
+            this->readTimeoutReduced = false;
+        }
+    }
+
+    // Sends output queue followed by `buff` by one call, bytes which were not sent are left in the queue.
+    // Returns count of sent bytes, 0 if socket is not ready to send or -1 if error occurred (`WSAGetLastError()` is set).
+    inline int sendQueued(const uint8_t *buff, uint16_t sz)
+    {
+        int c = this->socket->sendv(reinterpret_cast<const char*>(this->outq.data()), static_cast<int>(this->outq.size()),
+                                    reinterpret_cast<const char*>(buff), sz);
+        if (c < 0)
+        {
+            if (WSAGetLastError() != WSAEWOULDBLOCK)
+                return -1;
+            c = 0;
+        }
+        this->outq.consume(static_cast<size_t>(c), buff, sz);
+        return c;
+    }
+
 public:
     ModbusSocket *socket;
     DWORD timestamp;
+    bool readTimeoutReduced;
     void *addr;
 };
 
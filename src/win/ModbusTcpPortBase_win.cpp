@@ -12,6 +12,34 @@ Modbus::Handle ModbusTcpPortBase::handle() const
     return reinterpret_cast<Handle>(d_win(d_ptr)->socket->socket());
 }
 
+uint32_t ModbusTcpPortBase::syscallCount() const
+{
+    return d_win(d_ptr)->socket->syscallCount();
+}
+
+uint32_t ModbusTcpPortBase::outputQueueSize() const
+{
+    return static_cast<uint32_t>(d_win(d_ptr)->outq.size());
+}
+
+ModbusSocket *ModbusTcpPortBase::replaceSocket(ModbusSocket *socket)
+{
+    ModbusTcpPortBasePrivateWin *d = d_win(d_ptr);
+    if (d->socket->isValid())
+    {
+        d->socket->shutdown();
+        d->socket->close();
+    }
+    ModbusSocket *prev = d->socket;
+    socket->setBlocking(d->isBlocking());
+    d->socket = socket;
+    d->outq.clear();
+    d->frame->sz = 0;
+    d->readTimeoutReduced = false;
+    d->state = socket->isValid() ? STATE_OPENED : STATE_CLOSED;
+    return prev;
+}
+
 Modbus::StatusCode ModbusTcpPortBase::open()
 {
     ModbusTcpPortBasePrivateWin *d = d_win(d_ptr);
@@ -35,6 +63,9 @@ Modbus::StatusCode ModbusTcpPortBase::open()
                 }
             }
             d->clearChanged();
+            if (d->local)
+                return d->setError(Status_BadTcpCreate, StringLiteral("UNIX. Error while creating socket for '") + d->host() +
+                                                        StringLiteral("'. Unix domain sockets are not supported on this platform"));
             ADDRINFO hints;
             ZeroMemory(&hints, sizeof(hints));
             hints.ai_family = AF_INET;
@@ -62,6 +93,7 @@ Modbus::StatusCode ModbusTcpPortBase::open()
             d->socket->setBlocking(false); // Note: in case of block-socket it will be set after connect
             if (d->isBlocking())
                 d->socket->setTimeout(d->timeout());
+            d->socket->setOptions(d->sockopt(), true);
             reinterpret_cast<sockaddr_in*>(reinterpret_cast<ADDRINFO*>(d->addr)->ai_addr)->sin_port = htons(d->port());
             d->timestamp = GetTickCount();
             d->state = STATE_WAIT_FOR_OPEN;
@@ -169,6 +201,7 @@ Modbus::StatusCode ModbusTcpPortBase::close()
         d->socket->shutdown();
         d->socket->close();
     }
+    d->outq.clear();
     d->state = STATE_CLOSED;
     return Status_Good;
 }
@@ -176,19 +209,15 @@ Modbus::StatusCode ModbusTcpPortBase::close()
 bool ModbusTcpPortBase::isOpen() const
 {
     ModbusTcpPortBasePrivateWin *d = d_win(d_ptr);
-    if (d->socket->isInvalid())
-        return false;
-    int error = 0;
-    int error_len = sizeof(error);
-    int r = d->socket->getsockopt(SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &error_len);
-    if (r != 0)
-        return false;
-    return (error == 0);
+    // Note: state is tracked by results of actual I/O (errors and remote close make port closed),
+    // so `isOpen()` doesn't make system calls and can be used on every step of transaction
+    return d->socket->isValid() && (d->state != STATE_WAIT_FOR_OPEN);
 }
 
 Modbus::StatusCode ModbusTcpPortBase::write()
 {
     ModbusTcpPortBasePrivateWin *d = d_win(d_ptr);
+    int c = 0;
     bool fRepeatAgain;
     do
     {
@@ -198,23 +227,13 @@ Modbus::StatusCode ModbusTcpPortBase::write()
         case STATE_OPENED:
         case STATE_PREPARE_TO_WRITE:
         case STATE_WAIT_FOR_WRITE:
+            d->timestamp = GetTickCount();
+            // Note: the rest of previous frames (if any) and current frame are sent by one call
+            c = d->sendQueued(d->buff(), d->buffSize());
+            d->state = STATE_WAIT_FOR_WRITE_ALL;
+            break;
         case STATE_WAIT_FOR_WRITE_ALL:
-        {
-            int c = d->socket->send(reinterpret_cast<char*>(d->buff()), d->buffSize(), 0);
-            if (c > 0)
-            {
-                d->state = STATE_OPENED;
-                return Status_Good;
-            }
-            else
-            {
-                close();
-                DWORD err = WSAGetLastError();
-                return d->setError(Status_BadTcpWrite, StringLiteral("TCP. Error while writing to '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
-                                                       StringLiteral("'. Error code: ") + toModbusString(err) +
-                                                       StringLiteral(". ") + getLastErrorText());
-            }
-        }
+            c = d->sendQueued(nullptr, 0);
             break;
         default:
             if (this->isOpen())
@@ -228,7 +247,39 @@ Modbus::StatusCode ModbusTcpPortBase::write()
         }
     }
     while (fRepeatAgain);
-    return Status_Processing;
+
+    // Note: blocking socket sends the rest of the frame within send timeout
+    while ((c > 0) && d->isBlocking() && !d->outq.isEmpty())
+    {
+        c = d->sendQueued(nullptr, 0);
+        if (c == 0)
+        {
+            WSASetLastError(WSAETIMEDOUT);
+            c = -1;
+        }
+    }
+    if (c < 0)
+    {
+        DWORD err = WSAGetLastError();
+        close();
+        return d->setError(Status_BadTcpWrite, StringLiteral("TCP. Error while writing to '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
+                                               StringLiteral("'. Error code: ") + toModbusString(err) +
+                                               StringLiteral(". ") + getLastErrorText());
+    }
+    // Note: server connection doesn't wait for slow client to receive the response,
+    // the rest of it is sent by next `read()` or together with next response
+    if (d->outq.isEmpty() || (d->modeServer() && (d->outq.size() <= MB_TCP_OUTPUT_QUEUE_SZ)))
+    {
+        d->state = STATE_OPENED;
+        return Status_Good;
+    }
+    if (d->isBlocking() || (GetTickCount() - d->timestamp >= d->timeout()))
+    {
+        close();
+        return d->setError(Status_BadTcpWrite, StringLiteral("TCP. Error while writing to '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
+                                               StringLiteral("'. Timeout") );
+    }
+    return Status_Processing; // Socket buffer is full, try again later
 }
 
 Modbus::StatusCode ModbusTcpPortBase::read()
@@ -243,17 +294,49 @@ Modbus::StatusCode ModbusTcpPortBase::read()
         case STATE_OPENED:
         case STATE_PREPARE_TO_READ:
             d->timestamp = GetTickCount();
+            d->readTimeoutRestore();
             d->state = STATE_WAIT_FOR_READ;
             MB_FALLTHROUGH
         case STATE_WAIT_FOR_READ:
+            d->state = STATE_WAIT_FOR_READ_ALL;
+            // Note: pipelined stream frame can be already received together with previous one
+            if (d->frame->startRead())
+            {
+                d->state = STATE_OPENED;
+                return Status_Good;
+            }
+            MB_FALLTHROUGH
         case STATE_WAIT_FOR_READ_ALL:
         {
-            int c = d->socket->recv(reinterpret_cast<char*>(d->buff()), d->buffMaxSize(), 0);
+            // Note: the rest of previous frames is sent when socket becomes writable
+            if (!d->outq.isEmpty() && (d->sendQueued(nullptr, 0) < 0))
+            {
+                DWORD err = WSAGetLastError();
+                this->close();
+                return d->setError(Status_BadTcpWrite, StringLiteral("TCP. Error while writing to '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
+                                                       StringLiteral("'. Error code: ") + toModbusString(err) +
+                                                       StringLiteral(". ") + getLastErrorText());
+            }
+            int c = d->socket->recv(reinterpret_cast<char*>(d->buffNext()), d->buffFreeSize(), 0);
             if (c > 0)
             {
-                d->setBuffSize(static_cast<uint16_t>(c));
-                d->state = STATE_OPENED;
-                return Status_Good;
+                uint16_t offset = d->buffSize();
+                d->addBuffSize(static_cast<uint16_t>(c));
+                // Note: stream frame (ASCII) can be received by parts, so it is accumulated until its end is detected
+                if (!d->frame->isStreamFrame() || !d->buffFreeSize() || d->frame->isFrameEndDetected(offset))
+                {
+                    // Note: late responses to abandoned requests are dropped and actual response is waited within the same timeout
+                    if (d->frame->dropStaleFrames() && !d->buffSize())
+                    {
+                        if (d->isBlocking())
+                            d->readTimeoutReduce();
+                        fRepeatAgain = true;
+                        break;
+                    }
+                    d->state = STATE_OPENED;
+                    return Status_Good;
+                }
+                fRepeatAgain = d->isBlocking();
             }
             else if (c == 0)
             {
@@ -265,9 +348,21 @@ Modbus::StatusCode ModbusTcpPortBase::read()
                     return d->setError(Status_BadTcpRead, StringLiteral("TCP. Error while reading from '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
                                                           StringLiteral("'. Remote connection closed") );
             }
+            else if (d->buffSize() && ((WSAGetLastError() == WSAEWOULDBLOCK) || (WSAGetLastError() == WSAETIMEDOUT)) &&
+                     (d->isBlocking() || (GetTickCount() - d->timestamp >= d->timeout())))
+            {
+                // Note: incomplete stream frame is passed to `readBuffer()` to be checked,
+                // socket error is reported below even if part of the frame is received
+                d->state = STATE_OPENED;
+                return Status_Good;
+            }
             else if (isNonBlocking() && (GetTickCount() - d->timestamp >= d->timeout())) // waiting timeout read first byte elapsed
             {
-                this->close();
+                // Note: late response is recognized by transaction id and dropped later, so connection is kept
+                if (d->frame->isTransactional())
+                    d->state = STATE_OPENED;
+                else
+                    this->close();
                 return d->setError(Modbus::Status_BadTcpReadTimeout, StringLiteral("TCP. Error while reading from '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
                                                                      StringLiteral("'. Timeout") );
             }
@@ -276,6 +371,12 @@ Modbus::StatusCode ModbusTcpPortBase::read()
                 int e = WSAGetLastError();
                 if (isNonBlocking() && e == WSAEWOULDBLOCK)
                     return Status_Processing; // No data available for non-blocking socket, try again later
+                if ((e == WSAETIMEDOUT) && d->frame->isTransactional()) // blocking socket read timeout
+                {
+                    d->state = STATE_OPENED;
+                    return d->setError(Modbus::Status_BadTcpReadTimeout, StringLiteral("TCP. Error while reading from '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
+                                                                         StringLiteral("'. Timeout") );
+                }
                 this->close();
                 return d->setError(Status_BadTcpRead, StringLiteral("TCP. Error while reading from '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
                                                       StringLiteral("'. Error code: ") + toModbusString(e) +
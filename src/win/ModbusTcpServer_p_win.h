@@ -6,14 +6,6 @@
 
 namespace Modbus {
 
-namespace ModbusTcpServerPrivateNS {
-
-typedef std::list<ModbusServerPort*> Connections_t;
-
-} // namespace ModbusTcpServerPrivateNS
-
-using namespace ModbusTcpServerPrivateNS;
-
 class ModbusTcpServerPrivateWin : public ModbusTcpServerPrivate
 {
 public:
@@ -28,6 +20,7 @@ public:
 
     ~ModbusTcpServerPrivateWin()
     {
+        delete this->spareSocket;
         delete this->socket;
         WSACleanup();
     }
@@ -33,6 +33,7 @@ StatusCode ModbusTcpServer::open()
 {
     ModbusTcpServerPrivateWin *d = d_win(d_ptr);
     d->cmdClose = false;
+    d->changed = false;
     bool fRepeatAgain;
     do
     {
@@ -48,6 +49,10 @@ StatusCode ModbusTcpServer::open()
                 return Status_Good;
             }
 
+            if (d->isLocal())
+                return d->setErrorBase(Status_BadTcpCreate, (StringLiteral("UNIX. Socket creation error for path '") + d->ipaddr +
+                                                             StringLiteral("'. Unix domain sockets are not supported on this platform")).data());
+
             d->socket->create(AF_INET, SOCK_STREAM, IPPROTO_TCP);
             if (d->socket->isInvalid())
             {
@@ -76,8 +81,7 @@ StatusCode ModbusTcpServer::open()
             }
 
             // Listen on the socket
-            //if (d->socket->listen(SOMAXCONN) == SOCKET_ERROR)
-            if (d->socket->listen(d->maxconn) == SOCKET_ERROR)
+            if (d->socket->listen(d->backlog ? static_cast<int>(d->backlog) : SOMAXCONN) == SOCKET_ERROR)
             {
                 d->socket->close();
                 d->state = STATE_CLOSED;
@@ -109,15 +113,15 @@ StatusCode ModbusTcpServer::close()
     if (isOpen())
         d->socket->close();
     d->cmdClose = true;
-    for (ModbusServerPort *c : d->connections)
-        c->close();
+    for (Connection *c = d->connections.first; c; c = c->next)
+        c->resource->close();
     switch (d->state)
     {
     case STATE_WAIT_FOR_CLOSE:
-        for (ModbusServerPort *c : d->connections)
+        for (Connection *c = d->connections.first; c; c = c->next)
         {
-            c->process();
-            if (!c->isStateClosed())
+            c->resource->process();
+            if (!c->resource->isStateClosed())
                 return Status_Processing;
         }
         break;
@@ -135,29 +139,53 @@ bool ModbusTcpServer::isOpen() const
 ModbusSocket *ModbusTcpServer::nextPendingConnection()
 {
     ModbusTcpServerPrivateWin *d = d_win(d_ptr);
-    // Accept the incoming connection
-    sockaddr_in clientAddr;
-    int clientAddrSize = sizeof(clientAddr);
-    SOCKET clientSocket = d->socket->accept((sockaddr*)&clientAddr, &clientAddrSize);
-    if (clientSocket == INVALID_SOCKET)
+    // Note: connections over the limit are not accepted, they wait in the listen queue
+    // until one of the current connections is closed
+    if (d->connections.count >= d->maxconn)
+        return nullptr;
+    SOCKET clientSocket;
+    for (;;)
     {
-        if (WSAGetLastError() != WSAEWOULDBLOCK)
+        // Accept the incoming connection
+        sockaddr_in clientAddr;
+        int clientAddrSize = sizeof(clientAddr);
+        clientSocket = d->socket->accept((sockaddr*)&clientAddr, &clientAddrSize);
+        if (clientSocket == INVALID_SOCKET)
         {
+            int err = WSAGetLastError();
+            if (err == WSAEWOULDBLOCK)
+                return nullptr;
+            // Note: connection was reset while it was in the queue, try the next one
+            if (err == WSAECONNRESET)
+                continue;
             d->socket->close();
             d->state = STATE_CLOSED;
+            return nullptr;
         }
-        return nullptr;
+        break;
     }
-    if (d->connections.size() >= d->maxconn)
+
+    ModbusSocket *tcp = d->spareSocket;
+    if (tcp)
     {
-        ::closesocket(clientSocket);
-        return nullptr;
+        d->spareSocket = nullptr;
+        tcp->setSocket(clientSocket);
     }
-
-    ModbusSocket *tcp = new ModbusSocket(clientSocket);
+    else
+        tcp = new ModbusSocket(clientSocket);
+    tcp->setOptions(d->sockopt, true);
     return tcp;
 }
 
+void ModbusTcpServerPrivate::releaseSocket(ModbusSocket *socket)
+{
+    // Note: one spare object is enough because every accepted connection takes it back
+    if (this->spareSocket)
+        delete socket;
+    else
+        this->spareSocket = socket;
+}
+
 bool ModbusTcpServerPrivate::getHostService(ModbusSocket *socket, String &host, String &service)
 {
     sockaddr_storage clientAddr;
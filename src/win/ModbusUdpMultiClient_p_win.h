@@ -0,0 +1,63 @@
+#ifndef MODBUSUDPMULTICLIENT_P_WIN_H
+#define MODBUSUDPMULTICLIENT_P_WIN_H
+
+#include <map>
+
+#include "../ModbusUdpMultiClient_p.h"
+
+#include "Modbus_win.h"
+
+class ModbusUdpMultiClientPrivateWin : public ModbusUdpMultiClientPrivate
+{
+public:
+    ModbusUdpMultiClientPrivateWin(ProtocolType type) :
+        ModbusUdpMultiClientPrivate(type)
+    {
+        WSADATA data;
+        WSAStartup(0x202, &data);
+
+        this->connected = false;
+        this->socket = new ModbusSocket();
+    }
+
+    ~ModbusUdpMultiClientPrivateWin()
+    {
+        if (!this->socket->isInvalid())
+            this->socket->close();
+        delete this->socket;
+        WSACleanup();
+    }
+
+public:
+    static inline uint64_t peerKey(const sockaddr_in &a) { return (static_cast<uint64_t>(a.sin_addr.s_addr) << 16) | a.sin_port; }
+
+    // Passes datagram received from `peer` to the targets with the same address
+    inline void dispatch(const sockaddr_in &peer, const uint8_t *data, uint16_t sz)
+    {
+        auto it = this->peers.find(peerKey(peer));
+        if (it == this->peers.end())
+            return;
+        for (int i : it->second)
+        {
+            if (receiveReply(i, data, sz))
+                return;
+        }
+    }
+
+    // Resolves addresses of targets with queued requests
+    void resolveTargets();
+    // Connects the socket to the single target or disconnects it when other targets are added
+    void updateConnection();
+    void sendQueued();
+    void receiveAll();
+
+public:
+    ModbusSocket *socket;
+    bool connected;
+    std::vector<sockaddr_in> addrs; // resolved addresses of targets
+    std::map<uint64_t, std::vector<int> > peers; // address -> indexes of targets with this address
+};
+
+static inline ModbusUdpMultiClientPrivateWin *d_win(ModbusObjectPrivate *d_ptr) { return static_cast<ModbusUdpMultiClientPrivateWin*>(d_ptr); }
+
+#endif // MODBUSUDPMULTICLIENT_P_WIN_H
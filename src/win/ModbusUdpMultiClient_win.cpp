@@ -0,0 +1,189 @@
+#include "ModbusUdpMultiClient_p_win.h"
+
+ModbusUdpMultiClientPrivate *ModbusUdpMultiClientPrivate::create(ProtocolType type)
+{
+    return new ModbusUdpMultiClientPrivateWin(type);
+}
+
+void ModbusUdpMultiClientPrivateWin::resolveTargets()
+{
+    this->addrs.resize(this->targets.size());
+    for (size_t i = 0; i < this->targets.size(); i++)
+    {
+        Target &t = this->targets[i];
+        if (t.resolved || (t.state != TargetQueued))
+            continue;
+        ADDRINFO hints;
+        memset(&hints, 0, sizeof hints);
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_DGRAM;
+        hints.ai_protocol = IPPROTO_UDP;
+
+        ADDRINFO* addr = nullptr;
+        DWORD status = getaddrinfo(t.host.data(), NULL, &hints, &addr);
+        // Note: failed resolution fails only the request of this target, the next request resolves the host again
+        if (status != 0)
+        {
+            complete(static_cast<int>(i), Status_BadUdpCreate, StringLiteral("UDP. Error while getting address info for '") + t.host + StringLiteral(":") + toModbusString(t.port) +
+                                                               StringLiteral("'. Error code: ") + toModbusString(status) +
+                                                               StringLiteral(". ") + getLastErrorText());
+            continue;
+        }
+        memcpy(&this->addrs[i], addr->ai_addr, sizeof(sockaddr_in));
+        freeaddrinfo(addr);
+        this->addrs[i].sin_port = htons(t.port);
+        this->peers[peerKey(this->addrs[i])].push_back(static_cast<int>(i));
+        t.resolved = true;
+    }
+}
+
+void ModbusUdpMultiClientPrivateWin::updateConnection()
+{
+    // Note: socket of the single target is connected, so the stack drops datagrams of other peers
+    bool single = (this->targets.size() == 1) && this->targets[0].resolved;
+    if (single && !this->connected)
+    {
+        // Note: if the socket can't be connected the target is served by unconnected socket
+        this->connected = (this->socket->connect(reinterpret_cast<sockaddr*>(&this->addrs[0]), sizeof(sockaddr_in)) != SOCKET_ERROR);
+    }
+    // Note: association is dissolved after the request in progress is completed, so its reply isn't lost,
+    // requests to new targets stay queued until then
+    else if (!single && this->connected && (this->targets[0].state != TargetWaiting))
+    {
+        // Note: all-zero address dissolves the association without reopening the socket
+        sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        this->socket->connect(reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        this->connected = false;
+    }
+}
+
+void ModbusUdpMultiClientPrivateWin::sendQueued()
+{
+    // Note: Winsock has no call to send several datagrams, so requests are sent one by one
+    for (size_t i = 0; i < this->targets.size(); i++)
+    {
+        // Note: connected socket sends only to the first target
+        Target &t = this->targets[i];
+        if ((t.state != TargetQueued) || !t.resolved || (this->connected && i))
+            continue;
+        int c;
+        if (this->connected)
+            c = this->socket->send(reinterpret_cast<char*>(t.frame->buff), t.frame->sz, 0);
+        else
+            c = this->socket->sendto(reinterpret_cast<char*>(t.frame->buff), t.frame->sz, 0, reinterpret_cast<sockaddr*>(&this->addrs[i]), sizeof(sockaddr_in));
+        if (c == SOCKET_ERROR)
+        {
+            int err = WSAGetLastError();
+            complete(static_cast<int>(i), Status_BadUdpWrite, StringLiteral("UDP. Error while writing to '") + t.host + StringLiteral(":") + toModbusString(t.port) +
+                                                              StringLiteral("'. Error code: ") + toModbusString(err) +
+                                                              StringLiteral(". ") + getLastErrorText());
+            continue;
+        }
+        t.state = TargetWaiting;
+        t.timestamp = timer();
+    }
+}
+
+void ModbusUdpMultiClientPrivateWin::receiveAll()
+{
+    char buff[MB_ASC_IO_BUFF_SZ];
+    for (;;)
+    {
+        sockaddr_in peer;
+        int addrsz = sizeof(peer);
+        int c;
+        if (this->connected)
+            c = this->socket->recv(buff, sizeof(buff), 0);
+        else
+            c = this->socket->recvfrom(buff, sizeof(buff), 0, reinterpret_cast<sockaddr*>(&peer), &addrsz);
+        if (c >= 0)
+        {
+            if (this->connected)
+                receiveReply(0, reinterpret_cast<uint8_t*>(buff), static_cast<uint16_t>(c));
+            else
+                dispatch(peer, reinterpret_cast<uint8_t*>(buff), static_cast<uint16_t>(c));
+            continue;
+        }
+        int err = WSAGetLastError();
+        // Note: Winsock reports ICMP 'port unreachable' of any peer by the next receive call
+        if (err == WSAECONNRESET)
+        {
+            if (!this->connected)
+                continue;
+            if (this->targets[0].state == TargetWaiting)
+            {
+                Target &t = this->targets[0];
+                complete(0, Status_BadUdpRead, StringLiteral("UDP. Error while reading from '") + t.host + StringLiteral(":") + toModbusString(t.port) +
+                                               StringLiteral("'. Error code: ") + toModbusString(err) +
+                                               StringLiteral(". ") + getLastErrorText());
+            }
+        }
+        return;
+    }
+}
+
+Modbus::Handle ModbusUdpMultiClient::handle() const
+{
+    return reinterpret_cast<Handle>(d_win(d_ptr)->socket->socket());
+}
+
+uint32_t ModbusUdpMultiClient::syscallCount() const
+{
+    return d_win(d_ptr)->socket->syscallCount();
+}
+
+bool ModbusUdpMultiClient::isOpen() const
+{
+    return d_win(d_ptr)->socket->isValid();
+}
+
+Modbus::StatusCode ModbusUdpMultiClient::open()
+{
+    ModbusUdpMultiClientPrivateWin *d = d_win(d_ptr);
+    if (d->socket->isValid())
+        return Status_Good;
+    d->socket->create(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (d->socket->isInvalid())
+    {
+        int err = WSAGetLastError();
+        return d->setError(Status_BadUdpCreate, StringLiteral("UDP. Error while creating socket. Error code: ") + toModbusString(err) +
+                                                StringLiteral(". ") + getLastErrorText());
+    }
+    d->socket->setBlocking(false);
+    return Status_Good;
+}
+
+Modbus::StatusCode ModbusUdpMultiClient::close()
+{
+    ModbusUdpMultiClientPrivateWin *d = d_win(d_ptr);
+    if (d->socket->isValid())
+        d->socket->close();
+    d->failPending(Status_BadPortClosed, StringLiteral("UDP. Socket is closed"));
+    for (Target &t : d->targets)
+        t.resolved = false;
+    d->peers.clear();
+    d->connected = false;
+    return Status_Good;
+}
+
+Modbus::StatusCode ModbusUdpMultiClient::process()
+{
+    ModbusUdpMultiClientPrivateWin *d = d_win(d_ptr);
+    if (d->socket->isInvalid())
+    {
+        StatusCode r = open();
+        if (StatusIsBad(r))
+        {
+            d->failPending(r, d->errorText);
+            return r;
+        }
+    }
+    d->resolveTargets();
+    d->updateConnection();
+    d->sendQueued();
+    d->receiveAll();
+    d->checkTimeouts();
+    return Status_Good;
+}
@@ -15,6 +15,7 @@ public:
         WSAStartup(0x202, &data);
 
         this->timestamp = 0;
+        this->readTimeoutReduced = false;
         this->socket = new ModbusSocket();
     }
 
@@ -33,9 +34,27 @@ public:
     inline sockaddr_in* p_sockaddr_in() { return &sockadr; }
     inline sockaddr* p_sockaddr() { return reinterpret_cast<sockaddr*>(p_sockaddr_in()); }
 
+    // Note: blocking socket waits for the rest of response time only after dropped stale response
+    inline void readTimeoutReduce()
+    {
+        DWORD t = GetTickCount() - this->timestamp;
+        this->socket->setTimeout(t < this->timeout() ? this->timeout() - t : 1);
+        this->readTimeoutReduced = true;
+    }
+
+    inline void readTimeoutRestore()
+    {
+        if (this->readTimeoutReduced)
+        {
+            this->socket->setTimeout(this->timeout());
+            this->readTimeoutReduced = false;
+        }
+    }
+
 public:
     ModbusSocket *socket;
     DWORD timestamp;
+    bool readTimeoutReduced;
     sockaddr_in sockadr;
 };
 
@@ -12,6 +12,25 @@ Modbus::Handle ModbusUdpPortBase::handle() const
     return reinterpret_cast<Handle>(d_win(d_ptr)->socket->socket());
 }
 
+uint32_t ModbusUdpPortBase::syscallCount() const
+{
+    return d_win(d_ptr)->socket->syscallCount();
+}
+
+uint32_t ModbusUdpPortBase::batchSize() const
+{
+    return d_win(d_ptr)->batchSize;
+}
+
+void ModbusUdpPortBase::setBatchSize(uint32_t size)
+{
+    if (size < 1)
+        size = 1;
+    else if (size > MB_UDP_BATCH_MAX)
+        size = MB_UDP_BATCH_MAX;
+    d_win(d_ptr)->batchSize = size;
+}
+
 Modbus::StatusCode ModbusUdpPortBase::open()
 {
     ModbusUdpPortBasePrivateWin *d = d_win(d_ptr);
@@ -88,6 +107,7 @@ Modbus::StatusCode ModbusUdpPortBase::open()
             d->socket->setBlocking(d->isBlocking());
             if (d->isBlocking())
                 d->socket->setTimeout(d->timeout());
+            d->socket->setOptions(d->sockopt(), false);
             d->state = STATE_OPENED;
             return Status_Good;
         default:
@@ -120,14 +140,8 @@ Modbus::StatusCode ModbusUdpPortBase::close()
 bool ModbusUdpPortBase::isOpen() const
 {
     ModbusUdpPortBasePrivateWin *d = d_win(d_ptr);
-    if (d->socket->isInvalid())
-        return false;
-    int error = 0;
-    int error_len = sizeof(error);
-    int r = d->socket->getsockopt(SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &error_len);
-    if (r != 0)
-        return false;
-    return (error == 0);
+    // Note: state is tracked by results of actual I/O, so `isOpen()` doesn't make system calls
+    return d->socket->isValid();
 }
 
 Modbus::StatusCode ModbusUdpPortBase::write()
@@ -144,12 +158,11 @@ Modbus::StatusCode ModbusUdpPortBase::write()
         case STATE_WAIT_FOR_WRITE:
         case STATE_WAIT_FOR_WRITE_ALL:
         {
-            int c = sendto(d->socket->socket(),
-                        reinterpret_cast<char*>(d->buff()),
-                        d->buffSize(),
-                        0,
-                        d->p_sockaddr(),
-                        sizeof(sockaddr));
+            int c = d->socket->sendto(reinterpret_cast<char*>(d->buff()),
+                                      d->buffSize(),
+                                      0,
+                                      d->p_sockaddr(),
+                                      sizeof(sockaddr));
             if (c > 0)
             {
                 d->state = STATE_OPENED;
@@ -192,23 +205,45 @@ Modbus::StatusCode ModbusUdpPortBase::read()
         case STATE_OPENED:
         case STATE_PREPARE_TO_READ:
             d->timestamp = GetTickCount();
+            d->readTimeoutRestore();
             d->state = STATE_WAIT_FOR_READ;
             MB_FALLTHROUGH
         case STATE_WAIT_FOR_READ:
+            d->state = STATE_WAIT_FOR_READ_ALL;
+            // Note: pipelined stream frame can be already received together with previous one
+            if (d->frame->startRead())
+            {
+                d->state = STATE_OPENED;
+                return Status_Good;
+            }
+            MB_FALLTHROUGH
         case STATE_WAIT_FOR_READ_ALL:
         {
             int addrsz = sizeof(sockaddr);
-            int c = recvfrom(d->socket->socket(),
-                            reinterpret_cast<char*>(d->buff()),
-                            d->buffMaxSize(),
-                            0,
-                            d->p_sockaddr(),
-                            &addrsz);
+            int c = d->socket->recvfrom(reinterpret_cast<char*>(d->buffNext()),
+                                        d->buffFreeSize(),
+                                        0,
+                                        d->p_sockaddr(),
+                                        &addrsz);
             if (c > 0)
             {
-                d->setBuffSize(static_cast<uint16_t>(c));
-                d->state = STATE_OPENED;
-                return Status_Good;
+                uint16_t offset = d->buffSize();
+                d->addBuffSize(static_cast<uint16_t>(c));
+                // Note: stream frame (ASCII) can be received by parts, so it is accumulated until its end is detected
+                if (!d->frame->isStreamFrame() || !d->buffFreeSize() || d->frame->isFrameEndDetected(offset))
+                {
+                    // Note: late responses to abandoned requests are dropped and actual response is waited within the same timeout
+                    if (d->frame->dropStaleFrames() && !d->buffSize())
+                    {
+                        if (d->isBlocking())
+                            d->readTimeoutReduce();
+                        fRepeatAgain = true;
+                        break;
+                    }
+                    d->state = STATE_OPENED;
+                    return Status_Good;
+                }
+                fRepeatAgain = d->isBlocking();
             }
             else if (c == 0)
             {
@@ -220,6 +255,14 @@ Modbus::StatusCode ModbusUdpPortBase::read()
                     return d->setError(Status_BadUdpRead, StringLiteral("UDP. Error while reading from '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
                                                           StringLiteral("'. Remote connection closed") );
             }
+            else if (d->buffSize() && ((WSAGetLastError() == WSAEWOULDBLOCK) || (WSAGetLastError() == WSAETIMEDOUT)) &&
+                     (d->isBlocking() || (GetTickCount() - d->timestamp >= d->timeout())))
+            {
+                // Note: incomplete stream frame is passed to `readBuffer()` to be checked,
+                // socket error is reported below even if part of the frame is received
+                d->state = STATE_OPENED;
+                return Status_Good;
+            }
             else if (isNonBlocking() && (GetTickCount() - d->timestamp >= d->timeout())) // waiting timeout to read first byte was elapsed
             {
                 //this->close();
@@ -232,6 +275,12 @@ Modbus::StatusCode ModbusUdpPortBase::read()
                 int e = WSAGetLastError();
                 if (isNonBlocking() && e == WSAEWOULDBLOCK)
                     return Status_Processing; // No data available for non-blocking socket, try again later
+                if ((e == WSAETIMEDOUT) && d->frame->isTransactional()) // blocking socket read timeout
+                {
+                    d->state = STATE_OPENED;
+                    return d->setError(Status_BadUdpReadTimeout, StringLiteral("UDP. Error while reading from '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
+                                                                 StringLiteral("'. Timeout") );
+                }
                 this->close();
                 return d->setError(Status_BadUdpRead, StringLiteral("UDP. Error while reading from '") + d->host() + StringLiteral(":") + toModbusString(d->port()) +
                                                       StringLiteral("'. Error code: ") + toModbusString(e) +
@@ -1,4 +1,4 @@
-#include "../Modbus.h"
+#include "Modbus_win.h"
 
 #include <vector>
 
@@ -31,6 +31,17 @@ Timer timer()
     return GetTickCount();
 }
 
+uint64_t timerUs()
+{
+    static LARGE_INTEGER freq = { };
+    LARGE_INTEGER counter;
+    if (freq.QuadPart == 0)
+        QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return static_cast<uint64_t>(counter.QuadPart / freq.QuadPart) * 1000000 +
+           static_cast<uint64_t>(counter.QuadPart % freq.QuadPart) * 1000000 / static_cast<uint64_t>(freq.QuadPart);
+}
+
 Timestamp currentTimestamp()
 {
     Timestamp ft;
@@ -81,6 +92,16 @@ void msleep(uint32_t msec)
     */
 }
 
+void microsleep(uint32_t usec)
+{
+    // Note: Sleep() has millisecond resolution, so the rest of interval is spinned
+    uint64_t end = timerUs() + usec;
+    if (usec >= 2000)
+        msleep(usec / 1000 - 1);
+    while (timerUs() < end)
+        YieldProcessor();
+}
+
 String getLastErrorText()
 {
     // Retrieve the error code from the last WinAPI call
@@ -257,4 +278,77 @@ List<String> availableSerialPorts()
     return ports;
 }
 
+// Note: host names are resolved on every connection on Windows, TTL is only kept for API compatibility
+static uint32_t s_hostCacheTtl = 60000;
+
+uint32_t hostCacheTtl()
+{
+    return s_hostCacheTtl;
+}
+
+void setHostCacheTtl(uint32_t msec)
+{
+    s_hostCacheTtl = msec;
+}
+
+void clearHostCache()
+{
+}
+
 } // namespace Modbus
+
+void ModbusSocket::setOptions(const Modbus::SocketOptions &options, bool stream)
+{
+    int v;
+    if (options.sendBufferSize)
+    {
+        v = static_cast<int>(options.sendBufferSize);
+        setsockopt(SOL_SOCKET, SO_SNDBUF, reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+    if (options.recvBufferSize)
+    {
+        v = static_cast<int>(options.recvBufferSize);
+        setsockopt(SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+    if (!stream)
+        return;
+    if (options.noDelay)
+    {
+        v = 1;
+        setsockopt(IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+    if (options.keepAlive)
+    {
+        v = 1;
+        setsockopt(SOL_SOCKET, SO_KEEPALIVE, reinterpret_cast<const char*>(&v), sizeof(v));
+#ifdef TCP_KEEPIDLE
+        if (options.keepAliveIdle)
+        {
+            v = static_cast<int>(options.keepAliveIdle);
+            setsockopt(IPPROTO_TCP, TCP_KEEPIDLE, reinterpret_cast<const char*>(&v), sizeof(v));
+        }
+#endif
+#ifdef TCP_KEEPINTVL
+        if (options.keepAliveInterval)
+        {
+            v = static_cast<int>(options.keepAliveInterval);
+            setsockopt(IPPROTO_TCP, TCP_KEEPINTVL, reinterpret_cast<const char*>(&v), sizeof(v));
+        }
+#endif
+#ifdef TCP_KEEPCNT
+        if (options.keepAliveCount)
+        {
+            v = static_cast<int>(options.keepAliveCount);
+            setsockopt(IPPROTO_TCP, TCP_KEEPCNT, reinterpret_cast<const char*>(&v), sizeof(v));
+        }
+#endif
+    }
+#ifdef TCP_MAXRT
+    // Note: Windows analog of `TCP_USER_TIMEOUT` has resolution of seconds
+    if (options.userTimeout)
+    {
+        v = static_cast<int>((options.userTimeout + 999) / 1000);
+        setsockopt(IPPROTO_TCP, TCP_MAXRT, reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+#endif
+}
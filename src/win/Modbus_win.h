@@ -8,7 +8,7 @@
 class ModbusSocket
 {
 public:
-    ModbusSocket(SOCKET socket = INVALID_SOCKET) : m_socket(socket) {}
+    ModbusSocket(SOCKET socket = INVALID_SOCKET) : m_socket(socket), m_syscalls(0) {}
 
 public:
     inline bool isValid() const { return m_socket != INVALID_SOCKET; }
@@ -16,27 +16,56 @@ public:
     inline SOCKET socket() const { return m_socket; }
     inline void setSocket(SOCKET socket) { m_socket = socket; }
     inline ModbusSocket &operator=(SOCKET socket) { setSocket(socket); return *this; }
-    inline void setBlocking(bool block) { unsigned long ul = !block; ioctlsocket(m_socket, FIONBIO, (unsigned long *)&ul); }
+    inline uint32_t syscallCount() const { return m_syscalls; }
+    inline void setBlocking(bool block) { ++m_syscalls; unsigned long ul = !block; ioctlsocket(m_socket, FIONBIO, (unsigned long *)&ul); }
     inline void setTimeout(uint32_t timeout)
     {
-        setsockopt(m_socket, SOL_SOCKET, SO_SNDTIMEO, (char *)&timeout, sizeof(timeout));
-        setsockopt(m_socket, SOL_SOCKET, SO_RCVTIMEO, (char *)&timeout, sizeof(timeout));
+        m_syscalls += 2;
+        ::setsockopt(m_socket, SOL_SOCKET, SO_SNDTIMEO, (char *)&timeout, sizeof(timeout));
+        ::setsockopt(m_socket, SOL_SOCKET, SO_RCVTIMEO, (char *)&timeout, sizeof(timeout));
     }
 
 public: // socket interface
-    inline SOCKET create(int af, int type, int protocol) { m_socket = ::socket(af, type, protocol); return m_socket; }
-    inline int getsockopt( int level, int optname, char *optval, int *optlen) { return ::getsockopt(m_socket, level, optname, optval, optlen); }
-    inline int connect(const struct sockaddr *name, int namelen) { return ::connect(m_socket, name, namelen); }
-    inline int bind(const struct sockaddr *name, int namelen) { return ::bind(m_socket, name, namelen); }
-    inline int listen(int backlog) { return ::listen(m_socket, backlog); }
-    inline SOCKET accept(struct sockaddr *addr, int *addrlen) { return ::accept(m_socket, addr, addrlen); }
-    inline int send(const char *buf, int len, int flags) { return ::send(m_socket, buf, len, flags); }
-    inline int recv(char *buf, int len, int flags) { return ::recv(m_socket, buf, len, flags); }
-    inline void shutdown() { ::shutdown(m_socket, SD_BOTH); }
-    inline void close() { closesocket(m_socket); m_socket = INVALID_SOCKET; }
+    inline SOCKET create(int af, int type, int protocol) { ++m_syscalls; m_socket = ::socket(af, type, protocol); return m_socket; }
+    inline int getsockopt( int level, int optname, char *optval, int *optlen) { ++m_syscalls; return ::getsockopt(m_socket, level, optname, optval, optlen); }
+    inline int setsockopt( int level, int optname, const char *optval, int optlen) { ++m_syscalls; return ::setsockopt(m_socket, level, optname, optval, optlen); }
+    inline int connect(const struct sockaddr *name, int namelen) { ++m_syscalls; return ::connect(m_socket, name, namelen); }
+    inline int bind(const struct sockaddr *name, int namelen) { ++m_syscalls; return ::bind(m_socket, name, namelen); }
+    inline int listen(int backlog) { ++m_syscalls; return ::listen(m_socket, backlog); }
+    inline SOCKET accept(struct sockaddr *addr, int *addrlen) { ++m_syscalls; return ::accept(m_socket, addr, addrlen); }
+    inline int send(const char *buf, int len, int flags) { ++m_syscalls; return ::send(m_socket, buf, len, flags); }
+    inline int recv(char *buf, int len, int flags) { ++m_syscalls; return ::recv(m_socket, buf, len, flags); }
+    // Sends two buffers by one call (gathering `WSASend()`), empty buffer is skipped
+    inline int sendv(const char *buf1, int len1, const char *buf2, int len2)
+    {
+        if (!len1)
+            return send(buf2, len2, 0);
+        if (!len2)
+            return send(buf1, len1, 0);
+        ++m_syscalls;
+        WSABUF bufs[2];
+        bufs[0].buf = const_cast<char*>(buf1);
+        bufs[0].len = static_cast<ULONG>(len1);
+        bufs[1].buf = const_cast<char*>(buf2);
+        bufs[1].len = static_cast<ULONG>(len2);
+        DWORD sent = 0;
+        if (WSASend(m_socket, bufs, 2, &sent, 0, nullptr, nullptr) == SOCKET_ERROR)
+            return SOCKET_ERROR;
+        return static_cast<int>(sent);
+    }
+    inline int sendto(const char *buf, int len, int flags, const struct sockaddr *addr, int addrlen) { ++m_syscalls; return ::sendto(m_socket, buf, len, flags, addr, addrlen); }
+    inline int recvfrom(char *buf, int len, int flags, struct sockaddr *addr, int *addrlen) { ++m_syscalls; return ::recvfrom(m_socket, buf, len, flags, addr, addrlen); }
+    inline void shutdown() { ++m_syscalls; ::shutdown(m_socket, SD_BOTH); }
+    inline void close() { ++m_syscalls; closesocket(m_socket); m_socket = INVALID_SOCKET; }
+
+public: // options
+    // Applies socket level options and, if `stream` is `true`, TCP options from `options`.
+    // Options that are not supported by Windows (quick ACK, fast open, busy poll) are ignored.
+    void setOptions(const Modbus::SocketOptions &options, bool stream);
 
 private:
     SOCKET m_socket;
+    uint32_t m_syscalls; // count of system calls made through this object
 };
 
 
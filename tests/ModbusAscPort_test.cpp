@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <vector>
+
 #include <ModbusAscPort.h>
 #include <ModbusPort_p.h>
 #include <ModbusSerialPort_p.h>
@@ -33,6 +35,22 @@ public:
         d_ptr->setBuffSize(size);
     }
 
+    // Append data to the internal buffer and check if end of frame is detected
+    bool appendAndCheckFrameEnd(const char *data)
+    {
+        uint16_t offset = d_ptr->buffSize();
+        uint16_t size = static_cast<uint16_t>(strlen(data));
+        memcpy(d_ptr->buffNext(), data, size);
+        d_ptr->addBuffSize(size);
+        return d_ptr->frame->isFrameEndDetected(offset);
+    }
+
+    // Start reading of the next frame (restores pipelined data)
+    bool startRead()
+    {
+        return d_ptr->frame->startRead();
+    }
+
     // Expose write() and read() for testing
     StatusCode testWrite()
     {
@@ -865,3 +883,152 @@ TEST_F(ModbusAscPortTest, AsciiConversionRoundtrip)
     // Should match original
     EXPECT_EQ(memcmp(original, decoded, 8), 0);
 }
+
+TEST_F(ModbusAscPortTest, WriteReadBufferMaxSizeRoundtrip)
+{
+    port = new ModbusAscPortTestHelper();
+
+    // Maximum data size to cover vectorized and tail parts of ASCII codec
+    uint8_t data[(MB_ASC_IO_BUFF_SZ-3)/2-3];
+    for (uint16_t i = 0; i < sizeof(data); i++)
+        data[i] = static_cast<uint8_t>(i * 29 + 3);
+
+    StatusCode result = port->testWriteBuffer(0x11, 0x10, data, sizeof(data));
+    ASSERT_EQ(result, Status_Good);
+    EXPECT_EQ(port->writeBufferSize(), 1 + (sizeof(data) + 3) * 2 + 2);
+
+    // Move written frame to the read buffer
+    std::vector<uint8_t> frame(port->writeBufferData(), port->writeBufferData() + port->writeBufferSize());
+    port->setInternalBuffer(frame.data(), static_cast<uint16_t>(frame.size()));
+
+    uint8_t outUnit, outFunc;
+    uint8_t outBuff[sizeof(data)];
+    uint16_t outSize;
+    result = port->testReadBuffer(outUnit, outFunc, outBuff, sizeof(outBuff), &outSize);
+    ASSERT_EQ(result, Status_Good);
+    EXPECT_EQ(outUnit, 0x11);
+    EXPECT_EQ(outFunc, 0x10);
+    ASSERT_EQ(outSize, sizeof(data));
+    EXPECT_EQ(memcmp(outBuff, data, sizeof(data)), 0);
+
+    // Corrupt a data symbol inside of the frame
+    frame[100] = 'g';
+    port->setInternalBuffer(frame.data(), static_cast<uint16_t>(frame.size()));
+    result = port->testReadBuffer(outUnit, outFunc, outBuff, sizeof(outBuff), &outSize);
+    EXPECT_EQ(result, Status_BadAscChar);
+
+    // Wrong but valid symbol must break LRC
+    frame[100] = (frame[100] == '0') ? '1' : '0';
+    port->setInternalBuffer(frame.data(), static_cast<uint16_t>(frame.size()));
+    result = port->testReadBuffer(outUnit, outFunc, outBuff, sizeof(outBuff), &outSize);
+    EXPECT_EQ(result, Status_BadLrc);
+}
+
+TEST_F(ModbusAscPortTest, FrameEndDetectedOnCrLf)
+{
+    port = new ModbusAscPortTestHelper();
+    port->setInternalBuffer(nullptr, 0);
+
+    EXPECT_FALSE(port->appendAndCheckFrameEnd(":0103"));
+    EXPECT_FALSE(port->appendAndCheckFrameEnd("020001F9\r"));
+    EXPECT_TRUE (port->appendAndCheckFrameEnd("\n"));
+    EXPECT_EQ(port->readBufferSize(), 15);
+
+    uint8_t outUnit, outFunc;
+    uint8_t outBuff[16];
+    uint16_t outSize;
+    EXPECT_EQ(port->testReadBuffer(outUnit, outFunc, outBuff, sizeof(outBuff), &outSize), Status_Good);
+    EXPECT_EQ(outUnit, 0x01);
+    EXPECT_EQ(outFunc, 0x03);
+    EXPECT_EQ(outSize, 3);
+}
+
+TEST_F(ModbusAscPortTest, FrameEndResyncOnColon)
+{
+    port = new ModbusAscPortTestHelper();
+    port->setInternalBuffer(nullptr, 0);
+
+    // Garbage and broken frame before the real start of the frame must be dropped
+    EXPECT_FALSE(port->appendAndCheckFrameEnd("\x00\xFF:01"));
+    EXPECT_FALSE(port->appendAndCheckFrameEnd("03:0103"));
+    EXPECT_TRUE (port->appendAndCheckFrameEnd("020001F9\r\ngarbage"));
+    ASSERT_EQ(port->readBufferSize(), 15);
+    EXPECT_EQ(memcmp(port->readBufferData(), ":0103020001F9\r\n", 13), 0);
+}
+
+TEST_F(ModbusAscPortTest, PipelinedFrameKeptForNextRead)
+{
+    port = new ModbusAscPortTestHelper();
+    port->setServerMode(true);
+    port->setInternalBuffer(nullptr, 0);
+
+    EXPECT_TRUE(port->appendAndCheckFrameEnd(":0103020001F9\r\n:0103020002F8\r\n:01"));
+    ASSERT_EQ(port->readBufferSize(), 15);
+    EXPECT_EQ(memcmp(port->readBufferData(), ":0103020001F9\r\n", 15), 0);
+
+    // Next complete frame is available without reading
+    EXPECT_TRUE(port->startRead());
+    ASSERT_EQ(port->readBufferSize(), 15);
+    EXPECT_EQ(memcmp(port->readBufferData(), ":0103020002F8\r\n", 15), 0);
+
+    // Beginning of the third frame is completed by the next received data
+    EXPECT_FALSE(port->startRead());
+    ASSERT_EQ(port->readBufferSize(), 3);
+    EXPECT_TRUE(port->appendAndCheckFrameEnd("03020003F7\r\n"));
+    EXPECT_EQ(memcmp(port->readBufferData(), ":0103020003F7\r\n", 15), 0);
+
+    EXPECT_FALSE(port->startRead());
+    EXPECT_EQ(port->readBufferSize(), 0);
+}
+
+TEST_F(ModbusAscPortTest, PendingDataDroppedByClientRequest)
+{
+    port = new ModbusAscPortTestHelper();
+    port->setInternalBuffer(nullptr, 0);
+    EXPECT_TRUE(port->appendAndCheckFrameEnd(":0103020001F9\r\n:0103020002F8\r\n"));
+
+    uint8_t data[4] = {0x00, 0x00, 0x00, 0x01};
+    ASSERT_EQ(port->testWriteBuffer(0x01, 0x03, data, sizeof(data)), Status_Good);
+    EXPECT_FALSE(port->startRead());
+    EXPECT_EQ(port->readBufferSize(), 0);
+}
+
+TEST_F(ModbusAscPortTest, FrameEndNotDetectedWithoutColon)
+{
+    port = new ModbusAscPortTestHelper();
+    port->setInternalBuffer(nullptr, 0);
+
+    EXPECT_FALSE(port->appendAndCheckFrameEnd("0103020001F9\r\n"));
+}
+
+TEST_F(ModbusAscPortTest, AsciiInputDelimiter)
+{
+    port = new ModbusAscPortTestHelper();
+    EXPECT_EQ(port->asciiInputDelimiter(), '\n');
+    port->setAsciiInputDelimiter('!');
+    EXPECT_EQ(port->asciiInputDelimiter(), '!');
+
+    // Client ends requests with the delimiter
+    uint8_t data[4] = {0x00, 0x00, 0x00, 0x01};
+    ASSERT_EQ(port->testWriteBuffer(0x01, 0x03, data, sizeof(data)), Status_Good);
+    EXPECT_EQ(port->writeBufferData()[port->writeBufferSize()-2], '\r');
+    EXPECT_EQ(port->writeBufferData()[port->writeBufferSize()-1], '!');
+
+    // Client expects responses ended with LF
+    port->setInternalBuffer(nullptr, 0);
+    EXPECT_FALSE(port->appendAndCheckFrameEnd(":0103020001F9\r!"));
+    port->setInternalBuffer(nullptr, 0);
+    EXPECT_TRUE (port->appendAndCheckFrameEnd(":0103020001F9\r\n"));
+
+    // Server expects requests ended with the delimiter
+    port->setServerMode(true);
+    port->setInternalBuffer(nullptr, 0);
+    EXPECT_FALSE(port->appendAndCheckFrameEnd(":0103020001F9\r\n"));
+    port->setInternalBuffer(nullptr, 0);
+    EXPECT_TRUE (port->appendAndCheckFrameEnd(":0103020001F9\r!"));
+
+    uint8_t outUnit, outFunc;
+    uint8_t outBuff[16];
+    uint16_t outSize;
+    EXPECT_EQ(port->testReadBuffer(outUnit, outFunc, outBuff, sizeof(outBuff), &outSize), Status_Good);
+}
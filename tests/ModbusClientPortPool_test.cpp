@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+
+#include <ModbusClientPort.h>
+#include <ModbusClientPortPool.h>
+#include <Modbus.h>
+#include <ModbusGlobal.h>
+
+#include "MockModbusPort.h"
+
+using namespace testing;
+using namespace Modbus;
+
+// Non-blocking port that answers FC03 with value 0x002A, every response takes two `read()` calls
+static NiceMock<MockModbusPort> *createMockPort(bool open)
+{
+    NiceMock<MockModbusPort> *port = new NiceMock<MockModbusPort>(false);
+    std::shared_ptr<bool> ready = std::make_shared<bool>(false);
+    ON_CALL(*port, isOpen()).WillByDefault(Return(open));
+    ON_CALL(*port, writeBuffer(_, _, _, _)).WillByDefault(Return(Status_Good));
+    ON_CALL(*port, write()).WillByDefault(Return(Status_Good));
+    ON_CALL(*port, read()).WillByDefault(Invoke([ready]() {
+        *ready = !*ready;
+        return *ready ? Status_Processing : Status_Good;
+    }));
+    ON_CALL(*port, readBuffer(_, _, _, _, _))
+        .WillByDefault(Invoke([](uint8_t &unit, uint8_t &func, uint8_t *buff, uint16_t, uint16_t *szOutBuff) {
+            unit = 1;
+            func = MBF_READ_HOLDING_REGISTERS;
+            buff[0] = 2;
+            buff[1] = 0x00;
+            buff[2] = 0x2A;
+            *szOutBuff = 3;
+            return Status_Good;
+        }));
+    return port;
+}
+
+TEST(ModbusClientPortPool, LeastOutstandingDispatch)
+{
+    ModbusClientPortPool pool;
+    pool.addPort(createMockPort(true));
+    pool.addPort(createMockPort(true));
+    ASSERT_EQ(pool.memberCount(), 2);
+
+    ModbusObject c1, c2, c3;
+    uint16_t v1 = 0, v2 = 0, v3 = 0;
+
+    // Note: requests of different clients are in progress on different connections at the same time
+    EXPECT_EQ(pool.readHoldingRegisters(&c1, 1, 0, 1, &v1), Status_Processing);
+    EXPECT_EQ(pool.boundMember(&c1), pool.member(0));
+    EXPECT_EQ(pool.readHoldingRegisters(&c2, 1, 0, 1, &v2), Status_Processing);
+    EXPECT_EQ(pool.boundMember(&c2), pool.member(1));
+    EXPECT_EQ(pool.outstandingCount(0), 1u);
+    EXPECT_EQ(pool.outstandingCount(1), 1u);
+    EXPECT_EQ(pool.member(0)->currentClient(), &c1);
+    EXPECT_EQ(pool.member(1)->currentClient(), &c2);
+
+    EXPECT_EQ(pool.readHoldingRegisters(&c1, 1, 0, 1, &v1), Status_Good);
+    EXPECT_EQ(v1, 0x2A);
+    EXPECT_EQ(pool.boundMember(&c1), nullptr);
+    EXPECT_EQ(pool.outstandingCount(0), 0u);
+
+    // Note: the idle member is chosen while the other one is busy
+    EXPECT_EQ(pool.readHoldingRegisters(&c3, 1, 0, 1, &v3), Status_Processing);
+    EXPECT_EQ(pool.boundMember(&c3), pool.member(0));
+
+    EXPECT_EQ(pool.readHoldingRegisters(&c2, 1, 0, 1, &v2), Status_Good);
+    EXPECT_EQ(v2, 0x2A);
+    pool.cancelRequest(&c3);
+    EXPECT_EQ(pool.boundMember(&c3), nullptr);
+    EXPECT_EQ(pool.outstandingCount(0), 0u);
+    EXPECT_EQ(pool.member(0)->currentClient(), nullptr);
+}
+
+TEST(ModbusClientPortPool, CreateAcceptsTcpProtocolsOnly)
+{
+    NetSettings settings;
+    settings.host    = "localhost";
+    settings.port    = STANDARD_TCP_PORT;
+    settings.timeout = 5000;
+    settings.maxconn = 0;
+    for (ProtocolType type : {TCP, ASCvTCP, RTUvTCP})
+    {
+        std::unique_ptr<ModbusClientPortPool> pool(createClientPortPool(type, &settings, 2, false));
+        ASSERT_NE(pool.get(), nullptr);
+        EXPECT_EQ(pool->memberCount(), 2);
+        EXPECT_EQ(pool->member(0)->type(), type);
+    }
+    for (ProtocolType type : {RTU, ASC, UDP, ASCvUDP, RTUvUDP, UNIX})
+        EXPECT_EQ(createClientPortPool(type, &settings, 2, false), nullptr);
+}
+
+TEST(ModbusClientPortPool, OpenMembers)
+{
+    ModbusClientPortPool pool;
+    uint16_t v = 0;
+    EXPECT_EQ(pool.readHoldingRegisters(1, 0, 1, &v), Status_BadPortClosed);
+
+    NiceMock<MockModbusPort> *closed = createMockPort(false);
+    NiceMock<MockModbusPort> *opened = createMockPort(true);
+    pool.addPort(closed);
+    pool.addPort(opened);
+    EXPECT_EQ(pool.openCount(), 1);
+
+    // Note: member with open connection is preferred
+    EXPECT_EQ(pool.readHoldingRegisters(1, 0, 1, &v), Status_Processing);
+    EXPECT_EQ(pool.boundMember(&pool), pool.member(1));
+    EXPECT_EQ(pool.readHoldingRegisters(1, 0, 1, &v), Status_Good);
+
+    // Note: warm-up opens idle closed members only
+    EXPECT_CALL(*closed, open()).WillOnce(Return(Status_Processing)).WillOnce(Return(Status_Good));
+    EXPECT_CALL(*opened, open()).Times(0);
+    EXPECT_EQ(pool.open(), Status_Processing);
+    EXPECT_EQ(pool.open(), Status_Good);
+
+    EXPECT_CALL(*closed, open()).WillOnce(Return(Status_BadTcpConnect));
+    EXPECT_EQ(pool.open(), Status_BadTcpConnect);
+}
@@ -2888,6 +2888,795 @@ TEST_F(ModbusClientPortTest, BroadcastDisabled)
     EXPECT_EQ(result, Status_Good);
 }
 
+// ============================================================================
+// Bus Scheduler Tests
+// ============================================================================
+
+TEST_F(ModbusClientPortTest, UnitStatisticsCollected)
+{
+    const uint8_t unit = 1;
+    uint8_t requestData[4] = {0x00, 0x00, 0x00, 0x02};
+    uint8_t responseData[5] = {0x04, 0x00, 0x0A, 0x00, 0x14};
+
+    setupSuccessfulTransaction(unit, MBF_READ_HOLDING_REGISTERS, requestData, 4, responseData, 5);
+
+    ModbusClientPort::UnitStatistics stats;
+    EXPECT_FALSE(clientPort->unitStatistics(unit, &stats));
+
+    uint16_t values[2];
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_Good);
+
+    ASSERT_TRUE(clientPort->unitStatistics(unit, &stats));
+    EXPECT_EQ(stats.requests, 1u);
+    EXPECT_EQ(stats.responses, 1u);
+    EXPECT_EQ(stats.failures, 0u);
+    EXPECT_FALSE(stats.offline);
+    EXPECT_EQ(stats.minResponseTimeUs, stats.lastResponseTimeUs);
+
+    ModbusClientPort::BusStatistics bus = clientPort->busStatistics();
+    EXPECT_EQ(bus.txBytes, 4u);
+    EXPECT_EQ(bus.rxBytes, 5u);
+    EXPECT_EQ(bus.trafficUs, 0u); // Note: not a serial port
+    EXPECT_EQ(bus.transactions, 1u);
+    EXPECT_EQ(bus.syscalls, 0u);  // Note: mock port doesn't count system calls
+}
+
+TEST_F(ModbusClientPortTest, UnitStatisticsIgnoreInvalidResponse)
+{
+    const uint8_t unit = 1;
+    uint8_t responseData[5] = {0x04, 0x00, 0x0A, 0x00, 0x14};
+
+    EXPECT_CALL(*mockPort, isOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockPort, writeBuffer(unit, _, _, _))
+        .Times(3)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, writeBufferSize())
+        .WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockPort, writeBufferData())
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*mockPort, write())
+        .Times(3)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, read())
+        .Times(3)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, readBuffer(_, _, _, _, _))
+        .WillOnce(DoAll(
+            SetArgReferee<0>(unit),
+            SetArgReferee<1>(MBF_READ_HOLDING_REGISTERS),
+            SetArrayArgument<2>(responseData, responseData + 5),
+            SetArgPointee<4>(5),
+            Return(Status_Good)))
+        .WillOnce(Return(Status_BadCrc))
+        .WillOnce(DoAll(
+            SetArgReferee<0>(unit + 1),
+            SetArgReferee<1>(MBF_READ_HOLDING_REGISTERS),
+            SetArrayArgument<2>(responseData, responseData + 5),
+            SetArgPointee<4>(5),
+            Return(Status_Good)));
+    EXPECT_CALL(*mockPort, readBufferSize())
+        .WillRepeatedly(Return(5));
+    EXPECT_CALL(*mockPort, readBufferData())
+        .WillRepeatedly(Return(responseData));
+
+    uint16_t values[2];
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_Good);
+    // Note: response with wrong checksum or of the other unit is not a response of the unit
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadCrc);
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadNotCorrectResponse);
+
+    ModbusClientPort::UnitStatistics stats;
+    ASSERT_TRUE(clientPort->unitStatistics(unit, &stats));
+    EXPECT_EQ(stats.responses, 1u);
+    EXPECT_EQ(stats.failures, 2u);
+    EXPECT_EQ(stats.consecutiveFailures, 2u);
+    EXPECT_FALSE(clientPort->unitStatistics(unit + 1, &stats));
+}
+
+TEST_F(ModbusClientPortTest, BusSchedulerSkipsOfflineUnit)
+{
+    const uint8_t unit = 5;
+    clientPort->setBusSchedulerEnabled(true);
+    clientPort->setUnitOfflineThreshold(2);
+    clientPort->setUnitProbeInterval(100000);
+
+    EXPECT_CALL(*mockPort, isOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockPort, writeBuffer(unit, _, _, _))
+        .Times(2)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, writeBufferSize())
+        .WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockPort, writeBufferData())
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*mockPort, write())
+        .Times(2)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, read())
+        .Times(2)
+        .WillRepeatedly(Return(Status_BadSerialReadTimeout));
+
+    uint16_t values[2];
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadSerialReadTimeout);
+    EXPECT_FALSE(clientPort->isUnitOffline(unit));
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadSerialReadTimeout);
+    EXPECT_TRUE(clientPort->isUnitOffline(unit));
+
+    // Note: request to offline unit fails immediately without bus access
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadUnitOffline);
+
+    ModbusClientPort::UnitStatistics stats;
+    ASSERT_TRUE(clientPort->unitStatistics(unit, &stats));
+    EXPECT_EQ(stats.requests, 2u);
+    EXPECT_EQ(stats.failures, 2u);
+    EXPECT_EQ(stats.consecutiveFailures, 2u);
+    EXPECT_EQ(stats.skipped, 1u);
+    EXPECT_TRUE(stats.offline);
+}
+
+TEST_F(ModbusClientPortTest, BusSchedulerProbesOfflineUnit)
+{
+    const uint8_t unit = 1;
+    clientPort->setBusSchedulerEnabled(true);
+    clientPort->setUnitOfflineThreshold(1);
+    clientPort->setUnitProbeInterval(1);
+
+    uint8_t responseData[5] = {0x04, 0x00, 0x0A, 0x00, 0x14};
+
+    EXPECT_CALL(*mockPort, isOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockPort, writeBuffer(unit, _, _, _))
+        .Times(2)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, writeBufferSize())
+        .WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockPort, writeBufferData())
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*mockPort, write())
+        .Times(2)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, read())
+        .WillOnce(Return(Status_BadSerialReadTimeout))
+        .WillOnce(Return(Status_Good));
+    EXPECT_CALL(*mockPort, readBuffer(_, _, _, _, _))
+        .WillOnce(DoAll(
+            SetArgReferee<0>(unit),
+            SetArgReferee<1>(MBF_READ_HOLDING_REGISTERS),
+            SetArrayArgument<2>(responseData, responseData + 5),
+            SetArgPointee<4>(5),
+            Return(Status_Good)));
+    EXPECT_CALL(*mockPort, readBufferSize())
+        .WillRepeatedly(Return(5));
+    EXPECT_CALL(*mockPort, readBufferData())
+        .WillRepeatedly(Return(responseData));
+
+    uint16_t values[2];
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadSerialReadTimeout);
+    EXPECT_TRUE(clientPort->isUnitOffline(unit));
+
+    // Note: probe interval is elapsed and bus is idle, so next request probes the unit
+    Modbus::msleep(5);
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_Good);
+    EXPECT_FALSE(clientPort->isUnitOffline(unit));
+}
+
+struct UnitStateRecorder
+{
+    std::vector<ModbusClientPort::CircuitState> states;
+
+    void onUnitStateChanged(const Modbus::Char *, uint8_t, ModbusClientPort::CircuitState state)
+    {
+        states.push_back(state);
+    }
+};
+
+TEST_F(ModbusClientPortTest, BusSchedulerCircuitBreaker)
+{
+    const uint8_t unit = 1;
+    mockPort->setTimeout(300);
+    clientPort->setBusSchedulerEnabled(true);
+    clientPort->setUnitOfflineThreshold(1);
+    clientPort->setUnitProbeInterval(1);
+    clientPort->setUnitProbeJitter(0);
+
+    UnitStateRecorder recorder;
+    clientPort->connect(&ModbusClientPort::signalUnitStateChanged, &recorder, &UnitStateRecorder::onUnitStateChanged);
+
+    uint8_t responseData[5] = {0x04, 0x00, 0x0A, 0x00, 0x14};
+
+    EXPECT_CALL(*mockPort, isOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockPort, writeBuffer(unit, _, _, _))
+        .Times(3)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, writeBufferSize())
+        .WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockPort, writeBufferData())
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*mockPort, write())
+        .Times(3)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, read())
+        .WillOnce(Return(Status_BadSerialReadTimeout))
+        .WillOnce(Return(Status_BadSerialReadTimeout))
+        .WillOnce(Return(Status_Good));
+    EXPECT_CALL(*mockPort, readBuffer(_, _, _, _, _))
+        .WillOnce(DoAll(
+            SetArgReferee<0>(unit),
+            SetArgReferee<1>(MBF_READ_HOLDING_REGISTERS),
+            SetArrayArgument<2>(responseData, responseData + 5),
+            SetArgPointee<4>(5),
+            Return(Status_Good)));
+    EXPECT_CALL(*mockPort, readBufferSize())
+        .WillRepeatedly(Return(5));
+    EXPECT_CALL(*mockPort, readBufferData())
+        .WillRepeatedly(Return(responseData));
+
+    uint16_t values[2];
+    Modbus::Timer tm = Modbus::timer();
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadSerialReadTimeout);
+    // Note: missed response does not wait port timeout once more
+    EXPECT_LT(Modbus::timer() - tm, 300u);
+    EXPECT_EQ(clientPort->unitCircuitState(unit), ModbusClientPort::CircuitOpen);
+
+    // Note: failed probe opens circuit again
+    Modbus::msleep(5);
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadSerialReadTimeout);
+    EXPECT_EQ(clientPort->unitCircuitState(unit), ModbusClientPort::CircuitOpen);
+
+    // Note: probe interval is doubled after failed probe
+    Modbus::msleep(5);
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_Good);
+    EXPECT_EQ(clientPort->unitCircuitState(unit), ModbusClientPort::CircuitClosed);
+
+    std::vector<ModbusClientPort::CircuitState> expected = {
+        ModbusClientPort::CircuitOpen,
+        ModbusClientPort::CircuitHalfOpen,
+        ModbusClientPort::CircuitOpen,
+        ModbusClientPort::CircuitHalfOpen,
+        ModbusClientPort::CircuitClosed
+    };
+    EXPECT_EQ(recorder.states, expected);
+}
+
+TEST_F(ModbusClientPortTest, BusSchedulerCircuitBreakerCorruptedProbe)
+{
+    const uint8_t unit = 1;
+    clientPort->setBusSchedulerEnabled(true);
+    clientPort->setUnitOfflineThreshold(1);
+    clientPort->setUnitProbeInterval(1);
+    clientPort->setUnitProbeJitter(0);
+
+    UnitStateRecorder recorder;
+    clientPort->connect(&ModbusClientPort::signalUnitStateChanged, &recorder, &UnitStateRecorder::onUnitStateChanged);
+
+    EXPECT_CALL(*mockPort, isOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockPort, writeBuffer(unit, _, _, _))
+        .Times(2)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, writeBufferSize())
+        .WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockPort, writeBufferData())
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*mockPort, write())
+        .Times(2)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, read())
+        .WillOnce(Return(Status_BadSerialReadTimeout))
+        .WillOnce(Return(Status_Good));
+    EXPECT_CALL(*mockPort, readBuffer(_, _, _, _, _))
+        .WillOnce(Return(Status_BadCrc));
+    EXPECT_CALL(*mockPort, readBufferSize())
+        .WillRepeatedly(Return(0));
+    EXPECT_CALL(*mockPort, readBufferData())
+        .WillRepeatedly(Return(nullptr));
+
+    uint16_t values[2];
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadSerialReadTimeout);
+    EXPECT_EQ(clientPort->unitCircuitState(unit), ModbusClientPort::CircuitOpen);
+
+    // Note: device answers the probe with garbage, so the probe is failed and circuit is opened again
+    Modbus::msleep(5);
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadCrc);
+    EXPECT_EQ(clientPort->unitCircuitState(unit), ModbusClientPort::CircuitOpen);
+    EXPECT_TRUE(clientPort->isUnitOffline(unit));
+
+    std::vector<ModbusClientPort::CircuitState> expected = {
+        ModbusClientPort::CircuitOpen,
+        ModbusClientPort::CircuitHalfOpen,
+        ModbusClientPort::CircuitOpen
+    };
+    EXPECT_EQ(recorder.states, expected);
+
+    ModbusClientPort::UnitStatistics stats;
+    ASSERT_TRUE(clientPort->unitStatistics(unit, &stats));
+    EXPECT_EQ(stats.responses, 0u);
+    EXPECT_EQ(stats.failures, 2u);
+}
+
+TEST_F(ModbusClientPortTest, AdaptiveTimeout)
+{
+    const uint8_t unit = 1;
+    uint8_t responseData[5] = {0x04, 0x00, 0x0A, 0x00, 0x14};
+
+    EXPECT_FALSE(clientPort->isAdaptiveTimeoutEnabled());
+    mockPort->setTimeout(500);
+    clientPort->setAdaptiveTimeoutEnabled(true);
+    clientPort->setAdaptiveTimeoutMin(5);
+
+    EXPECT_CALL(*mockPort, isOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockPort, writeBuffer(unit, _, _, _))
+        .Times(2)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, writeBufferSize())
+        .WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockPort, writeBufferData())
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*mockPort, write())
+        .Times(2)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, read())
+        .WillOnce(Return(Status_Good))
+        .WillOnce(Return(Status_BadSerialReadTimeout));
+    EXPECT_CALL(*mockPort, readBuffer(_, _, _, _, _))
+        .WillOnce(DoAll(
+            SetArgReferee<0>(unit),
+            SetArgReferee<1>(MBF_READ_HOLDING_REGISTERS),
+            SetArrayArgument<2>(responseData, responseData + 5),
+            SetArgPointee<4>(5),
+            Return(Status_Good)));
+    EXPECT_CALL(*mockPort, readBufferSize())
+        .WillRepeatedly(Return(5));
+    EXPECT_CALL(*mockPort, readBufferData())
+        .WillRepeatedly(Return(responseData));
+
+    ModbusClientPort::RttEstimate rtt;
+    EXPECT_FALSE(clientPort->rttEstimate(unit, 0, &rtt));
+
+    uint16_t values[2];
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_Good);
+    ASSERT_TRUE(clientPort->rttEstimate(unit, 0, &rtt));
+    EXPECT_EQ(rtt.samples, 1u);
+    // Note: mock port responds immediately, so timeout is clamped to the lower bound
+    EXPECT_EQ(rtt.timeout, 5u);
+    EXPECT_EQ(mockPort->timeout(), 5u);
+
+    // Note: missed response doubles timeout of the unit
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadSerialReadTimeout);
+    ASSERT_TRUE(clientPort->rttEstimate(unit, 0, &rtt));
+    EXPECT_EQ(rtt.timeout, 10u);
+
+    clientPort->setAdaptiveTimeoutEnabled(false);
+    EXPECT_EQ(mockPort->timeout(), 500u);
+}
+
+TEST_F(ModbusClientPortTest, AdaptiveTimeoutIgnoresInvalidResponse)
+{
+    const uint8_t unit = 1;
+    uint8_t responseData[5] = {0x04, 0x00, 0x0A, 0x00, 0x14};
+
+    mockPort->setTimeout(500);
+    clientPort->setAdaptiveTimeoutEnabled(true);
+    clientPort->setAdaptiveTimeoutMin(5);
+
+    EXPECT_CALL(*mockPort, isOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockPort, writeBuffer(unit, _, _, _))
+        .Times(2)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, writeBufferSize())
+        .WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockPort, writeBufferData())
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*mockPort, write())
+        .Times(2)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, read())
+        .Times(2)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, readBuffer(_, _, _, _, _))
+        .WillOnce(Return(Status_BadCrc))
+        .WillOnce(DoAll(
+            SetArgReferee<0>(unit),
+            SetArgReferee<1>(MBF_READ_INPUT_REGISTERS),
+            SetArrayArgument<2>(responseData, responseData + 5),
+            SetArgPointee<4>(5),
+            Return(Status_Good)));
+    EXPECT_CALL(*mockPort, readBufferSize())
+        .WillRepeatedly(Return(5));
+    EXPECT_CALL(*mockPort, readBufferData())
+        .WillRepeatedly(Return(responseData));
+
+    // Note: corrupted or foreign response is not a round-trip time sample
+    uint16_t values[2];
+    ModbusClientPort::RttEstimate rtt;
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadCrc);
+    EXPECT_FALSE(clientPort->rttEstimate(unit, 0, &rtt));
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadNotCorrectResponse);
+    EXPECT_FALSE(clientPort->rttEstimate(unit, 0, &rtt));
+    EXPECT_EQ(mockPort->timeout(), 500u);
+}
+
+// ============================================================================
+// Request Options Tests
+// ============================================================================
+
+TEST_F(ModbusClientPortTest, RequestOptionsTimeout)
+{
+    const uint8_t unit = 1;
+    uint8_t responseData[5] = {0x04, 0x00, 0x0A, 0x00, 0x14};
+
+    mockPort->setTimeout(500);
+    clientPort->setRequestOptions(clientPort, ModbusClientPort::RequestOptions{50, 0});
+
+    uint32_t readTimeout = 0;
+    EXPECT_CALL(*mockPort, isOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockPort, writeBuffer(unit, _, _, _))
+        .WillOnce(Return(Status_Good));
+    EXPECT_CALL(*mockPort, writeBufferSize())
+        .WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockPort, writeBufferData())
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*mockPort, write())
+        .WillOnce(Return(Status_Good));
+    EXPECT_CALL(*mockPort, read())
+        .WillOnce(Invoke([&]() {
+            readTimeout = mockPort->timeout();
+            return Status_Good;
+        }));
+    EXPECT_CALL(*mockPort, readBuffer(_, _, _, _, _))
+        .WillOnce(DoAll(
+            SetArgReferee<0>(unit),
+            SetArgReferee<1>(MBF_READ_HOLDING_REGISTERS),
+            SetArrayArgument<2>(responseData, responseData + 5),
+            SetArgPointee<4>(5),
+            Return(Status_Good)));
+    EXPECT_CALL(*mockPort, readBufferSize())
+        .WillRepeatedly(Return(5));
+    EXPECT_CALL(*mockPort, readBufferData())
+        .WillRepeatedly(Return(responseData));
+
+    uint16_t values[2];
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_Good);
+    EXPECT_EQ(readTimeout, 50u);
+    // Note: port timeout is restored when request is completed
+    EXPECT_EQ(mockPort->timeout(), 500u);
+}
+
+TEST_F(ModbusClientPortTest, RequestOptionsDeadline)
+{
+    const uint8_t unit = 1;
+    mockPort->setTimeout(25);
+    clientPort->setTries(10);
+    clientPort->setRequestOptions(clientPort, ModbusClientPort::RequestOptions{0, 30});
+
+    EXPECT_CALL(*mockPort, isOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockPort, writeBuffer(unit, _, _, _))
+        .WillOnce(Return(Status_Good));
+    EXPECT_CALL(*mockPort, writeBufferSize())
+        .WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockPort, writeBufferData())
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*mockPort, write())
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, read())
+        .WillRepeatedly(Return(Status_BadSerialReadTimeout));
+
+    uint16_t values[2];
+    Modbus::Timer tm = Modbus::timer();
+    EXPECT_EQ(clientPort->readHoldingRegisters(unit, 0, 2, values), Status_BadSerialReadTimeout);
+    // Note: tries are stopped by the deadline
+    EXPECT_LT(clientPort->lastTries(), 10u);
+    EXPECT_LT(Modbus::timer() - tm, 100u);
+    EXPECT_EQ(mockPort->timeout(), 25u);
+}
+
+// ============================================================================
+// Write Coalescing Tests
+// ============================================================================
+
+struct CoalescedWrite
+{
+    uint8_t func;
+    std::vector<uint8_t> data;
+};
+
+// Emulates device which echoes write requests or answers by 'Illegal data address' exception for `failFunc`
+static void setupWriteDevice(MockModbusPort *mockPort, std::vector<CoalescedWrite> &writes, uint8_t failFunc)
+{
+    EXPECT_CALL(*mockPort, isOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockPort, writeBuffer(_, _, _, _))
+        .WillRepeatedly(Invoke([&writes](uint8_t, uint8_t func, const uint8_t *buff, uint16_t szInBuff) {
+            writes.push_back(CoalescedWrite{func, std::vector<uint8_t>(buff, buff + szInBuff)});
+            return Status_Good;
+        }));
+    EXPECT_CALL(*mockPort, writeBufferSize())
+        .WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockPort, writeBufferData())
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*mockPort, write())
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, read())
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, readBuffer(_, _, _, _, _))
+        .WillRepeatedly(Invoke([&writes, failFunc](uint8_t &unit, uint8_t &func, uint8_t *buff, uint16_t, uint16_t *szOutBuff) {
+            unit = 1;
+            func = writes.back().func;
+            if (func == failFunc)
+            {
+                func |= 0x80;
+                buff[0] = 0x02;
+                *szOutBuff = 1;
+                return Status_Good;
+            }
+            memcpy(buff, writes.back().data.data(), 4);
+            *szOutBuff = 4;
+            return Status_Good;
+        }));
+    EXPECT_CALL(*mockPort, readBufferSize())
+        .WillRepeatedly(Return(0));
+    EXPECT_CALL(*mockPort, readBufferData())
+        .WillRepeatedly(Return(nullptr));
+}
+
+TEST_F(ModbusClientPortTest, WriteCoalescingMerge)
+{
+    std::vector<CoalescedWrite> writes;
+    setupWriteDevice(mockPort, writes, 0);
+
+    uint32_t t1 = clientPort->queueWriteSingleRegister(1, 10, 0x1111);
+    uint32_t t2 = clientPort->queueWriteSingleRegister(1, 11, 0x2222);
+    uint32_t t3 = clientPort->queueWriteSingleRegister(1, 12, 0x3333);
+    uint32_t t4 = clientPort->queueWriteSingleRegister(1, 11, 0x4444); // Note: last writer wins
+    uint32_t t5 = clientPort->queueWriteSingleRegister(1, 20, 0x5555);
+    uint32_t t6 = clientPort->queueWriteSingleCoil(1, 5, true);
+    EXPECT_EQ(clientPort->queuedWriteCount(), 5u);
+    EXPECT_EQ(clientPort->queuedWriteStatus(t1), Status_Processing);
+
+    EXPECT_EQ(clientPort->flushWrites(), Status_Good);
+    EXPECT_EQ(clientPort->queuedWriteCount(), 0u);
+    ASSERT_EQ(writes.size(), 3u);
+    EXPECT_EQ(writes[0].func, MBF_WRITE_MULTIPLE_REGISTERS);
+    EXPECT_EQ(writes[0].data, std::vector<uint8_t>({0x00, 0x0A, 0x00, 0x03, 0x06, 0x11, 0x11, 0x44, 0x44, 0x33, 0x33}));
+    EXPECT_EQ(writes[1].func, MBF_WRITE_SINGLE_REGISTER);
+    EXPECT_EQ(writes[1].data, std::vector<uint8_t>({0x00, 0x14, 0x55, 0x55}));
+    EXPECT_EQ(writes[2].func, MBF_WRITE_SINGLE_COIL);
+    EXPECT_EQ(writes[2].data, std::vector<uint8_t>({0x00, 0x05, 0xFF, 0x00}));
+    for (uint32_t t : {t1, t2, t3, t4, t5, t6})
+        EXPECT_EQ(clientPort->queuedWriteStatus(t), Status_Good);
+    EXPECT_EQ(clientPort->queuedWriteStatus(t6 + 1), Status_Uncertain);
+}
+
+TEST_F(ModbusClientPortTest, WriteCoalescingKeepsIssueOrder)
+{
+    std::vector<CoalescedWrite> writes;
+    setupWriteDevice(mockPort, writes, 0);
+
+    // Note: lower address is written after higher one, so writes are not merged and not reordered
+    clientPort->queueWriteSingleRegister(1, 20, 0x2020);
+    clientPort->queueWriteSingleRegister(1, 19, 0x1919);
+    clientPort->queueWriteSingleRegister(1, 10, 0x1010);
+    clientPort->queueWriteSingleRegister(1, 20, 0x2121);
+    EXPECT_EQ(clientPort->queuedWriteCount(), 4u);
+
+    EXPECT_EQ(clientPort->flushWrites(), Status_Good);
+    ASSERT_EQ(writes.size(), 4u);
+    EXPECT_EQ(writes[0].data, std::vector<uint8_t>({0x00, 0x14, 0x20, 0x20}));
+    EXPECT_EQ(writes[1].data, std::vector<uint8_t>({0x00, 0x13, 0x19, 0x19}));
+    EXPECT_EQ(writes[2].data, std::vector<uint8_t>({0x00, 0x0A, 0x10, 0x10}));
+    EXPECT_EQ(writes[3].data, std::vector<uint8_t>({0x00, 0x14, 0x21, 0x21}));
+}
+
+TEST_F(ModbusClientPortTest, WriteCoalescingStatusAndWindow)
+{
+    std::vector<CoalescedWrite> writes;
+    setupWriteDevice(mockPort, writes, MBF_WRITE_MULTIPLE_COILS);
+    clientPort->setWriteCoalescingWindow(1000);
+
+    uint32_t t1 = clientPort->queueWriteSingleCoil(1, 0, true);
+    uint32_t t2 = clientPort->queueWriteSingleCoil(1, 1, false);
+    uint32_t t3 = clientPort->queueWriteSingleRegister(1, 0, 1);
+    // Note: window is not elapsed, nothing is sent
+    EXPECT_EQ(clientPort->processWrites(), Status_Good);
+    EXPECT_EQ(writes.size(), 0u);
+
+    EXPECT_EQ(clientPort->flushWrites(), Status_BadIllegalDataAddress);
+    ASSERT_EQ(writes.size(), 2u);
+    EXPECT_EQ(clientPort->queuedWriteStatus(t1), Status_BadIllegalDataAddress);
+    EXPECT_EQ(clientPort->queuedWriteStatus(t2), Status_BadIllegalDataAddress);
+    EXPECT_EQ(clientPort->queuedWriteStatus(t3), Status_Good);
+}
+
+// Emulates device which answers read/write requests by registers {1, 2}, echoes write requests
+// and answers by 'Illegal function' exception for FC23 if `fc23` is false
+static void setupFusionDevice(MockModbusPort *mockPort, std::vector<CoalescedWrite> &writes, bool fc23)
+{
+    EXPECT_CALL(*mockPort, isOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockPort, writeBuffer(_, _, _, _))
+        .WillRepeatedly(Invoke([&writes](uint8_t, uint8_t func, const uint8_t *buff, uint16_t szInBuff) {
+            writes.push_back(CoalescedWrite{func, std::vector<uint8_t>(buff, buff + szInBuff)});
+            return Status_Good;
+        }));
+    EXPECT_CALL(*mockPort, writeBufferSize())
+        .WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockPort, writeBufferData())
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*mockPort, write())
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, read())
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, readBuffer(_, _, _, _, _))
+        .WillRepeatedly(Invoke([&writes, fc23](uint8_t &unit, uint8_t &func, uint8_t *buff, uint16_t, uint16_t *szOutBuff) {
+            const uint8_t regs[5] = {0x04, 0x00, 0x01, 0x00, 0x02};
+            unit = 1;
+            func = writes.back().func;
+            if ((func == MBF_READ_WRITE_MULTIPLE_REGISTERS) && !fc23)
+            {
+                func |= 0x80;
+                buff[0] = 0x01;
+                *szOutBuff = 1;
+            }
+            else if ((func == MBF_READ_WRITE_MULTIPLE_REGISTERS) || (func == MBF_READ_HOLDING_REGISTERS))
+            {
+                memcpy(buff, regs, 5);
+                *szOutBuff = 5;
+            }
+            else
+            {
+                memcpy(buff, writes.back().data.data(), 4);
+                *szOutBuff = 4;
+            }
+            return Status_Good;
+        }));
+    EXPECT_CALL(*mockPort, readBufferSize())
+        .WillRepeatedly(Return(0));
+    EXPECT_CALL(*mockPort, readBufferData())
+        .WillRepeatedly(Return(nullptr));
+}
+
+TEST_F(ModbusClientPortTest, ReadWriteFusion)
+{
+    std::vector<CoalescedWrite> writes;
+    setupFusionDevice(mockPort, writes, true);
+    clientPort->setUnitCapabilities(1, ModbusClientPort::CapabilityReadWriteMultipleRegisters);
+
+    uint32_t t1 = clientPort->queueWriteSingleRegister(1, 10, 0x1111);
+    uint32_t t2 = clientPort->queueWriteSingleRegister(1, 11, 0x2222);
+    clientPort->queueWriteSingleRegister(2, 10, 0x3333); // Note: other unit, not fused
+
+    uint16_t values[2] = {0, 0};
+    EXPECT_EQ(clientPort->readHoldingRegisters(1, 100, 2, values), Status_Good);
+    ASSERT_EQ(writes.size(), 1u);
+    EXPECT_EQ(writes[0].func, MBF_READ_WRITE_MULTIPLE_REGISTERS);
+    EXPECT_EQ(writes[0].data, std::vector<uint8_t>({0x00, 0x64, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x02, 0x04, 0x11, 0x11, 0x22, 0x22}));
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(values[1], 2);
+    EXPECT_EQ(clientPort->queuedWriteStatus(t1), Status_Good);
+    EXPECT_EQ(clientPort->queuedWriteStatus(t2), Status_Good);
+    EXPECT_EQ(clientPort->queuedWriteCount(), 1u);
+}
+
+TEST_F(ModbusClientPortTest, ReadWriteFusionNotSupported)
+{
+    std::vector<CoalescedWrite> writes;
+    setupFusionDevice(mockPort, writes, false);
+    clientPort->setUnitCapabilities(1, ModbusClientPort::CapabilityReadWriteMultipleRegisters);
+
+    uint32_t t1 = clientPort->queueWriteSingleRegister(1, 10, 0x1111);
+    uint16_t values[2] = {0, 0};
+    EXPECT_EQ(clientPort->readHoldingRegisters(1, 100, 2, values), Status_Good);
+    EXPECT_EQ(clientPort->unitCapabilities(1), ModbusClientPort::CapabilityNone);
+    // Note: taken write is sent before the read, so the read returns the written value
+    ASSERT_EQ(writes.size(), 3u);
+    EXPECT_EQ(writes[1].func, MBF_WRITE_SINGLE_REGISTER);
+    EXPECT_EQ(writes[1].data, std::vector<uint8_t>({0x00, 0x0A, 0x11, 0x11}));
+    EXPECT_EQ(writes[2].func, MBF_READ_HOLDING_REGISTERS);
+    EXPECT_EQ(values[1], 2);
+    EXPECT_EQ(clientPort->queuedWriteStatus(t1), Status_Good);
+    EXPECT_EQ(clientPort->queuedWriteCount(), 0u);
+    EXPECT_EQ(clientPort->flushWrites(), Status_Good);
+    EXPECT_EQ(writes.size(), 3u);
+}
+
+// ============================================================================
+// Range Requests Tests
+// ============================================================================
+
+typedef std::pair<uint16_t, uint16_t> RangeChunk; // offset, count
+
+// Emulates device which answers every FC03 request by register values equal to its addresses
+// or by 'Illegal data address' exception for the request which begins from `failOffset`
+static void setupRangeDevice(MockModbusPort *mockPort, std::vector<RangeChunk> &chunks, int failOffset)
+{
+    EXPECT_CALL(*mockPort, isOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockPort, writeBuffer(_, MBF_READ_HOLDING_REGISTERS, _, 4))
+        .WillRepeatedly(Invoke([&chunks](uint8_t, uint8_t, const uint8_t *buff, uint16_t) {
+            chunks.push_back(std::make_pair(static_cast<uint16_t>((buff[0] << 8) | buff[1]),
+                                            static_cast<uint16_t>((buff[2] << 8) | buff[3])));
+            return Status_Good;
+        }));
+    EXPECT_CALL(*mockPort, writeBufferSize())
+        .WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockPort, writeBufferData())
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*mockPort, write())
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, read())
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, readBuffer(_, _, _, _, _))
+        .WillRepeatedly(Invoke([&chunks, failOffset](uint8_t &unit, uint8_t &func, uint8_t *buff, uint16_t, uint16_t *szOutBuff) {
+            unit = 1;
+            uint16_t offset = chunks.back().first;
+            uint16_t count = chunks.back().second;
+            if (offset == failOffset)
+            {
+                func = MBF_READ_HOLDING_REGISTERS | 0x80;
+                buff[0] = 0x02;
+                *szOutBuff = 1;
+                return Status_Good;
+            }
+            func = MBF_READ_HOLDING_REGISTERS;
+            buff[0] = static_cast<uint8_t>(count * 2);
+            for (uint16_t i = 0; i < count; i++)
+            {
+                buff[1 + i * 2] = static_cast<uint8_t>((offset + i) >> 8);
+                buff[2 + i * 2] = static_cast<uint8_t>(offset + i);
+            }
+            *szOutBuff = 1 + count * 2;
+            return Status_Good;
+        }));
+    EXPECT_CALL(*mockPort, readBufferSize())
+        .WillRepeatedly(Return(0));
+    EXPECT_CALL(*mockPort, readBufferData())
+        .WillRepeatedly(Return(nullptr));
+}
+
+TEST_F(ModbusClientPortTest, RangeRequestSplit)
+{
+    std::vector<RangeChunk> chunks;
+    setupRangeDevice(mockPort, chunks, -1);
+
+    uint16_t values[300];
+    EXPECT_EQ(clientPort->readHoldingRegistersRange(1, 100, 300, values), Status_Good);
+    ASSERT_EQ(chunks.size(), 3u);
+    EXPECT_EQ(chunks[0], RangeChunk(100, 125));
+    EXPECT_EQ(chunks[1], RangeChunk(225, 125));
+    EXPECT_EQ(chunks[2], RangeChunk(350, 50));
+    for (uint16_t i = 0; i < 300; i++)
+        EXPECT_EQ(values[i], 100 + i);
+    EXPECT_EQ(clientPort->lastRangeChunkCount(), 3);
+    EXPECT_EQ(clientPort->currentClient(), nullptr);
+}
+
+TEST_F(ModbusClientPortTest, RangeRequestChunkStatus)
+{
+    std::vector<RangeChunk> chunks;
+    setupRangeDevice(mockPort, chunks, 10);
+    clientPort->setUnitMaxRegisters(1, 10);
+    EXPECT_EQ(clientPort->unitMaxRegisters(1), 10);
+
+    uint16_t values[25];
+    // Note: Modbus-exception for one chunk does not stop the rest of range
+    EXPECT_EQ(clientPort->readHoldingRegistersRange(1, 0, 25, values), Status_BadIllegalDataAddress);
+    ASSERT_EQ(chunks.size(), 3u);
+    EXPECT_EQ(chunks[2], RangeChunk(20, 5));
+    ASSERT_EQ(clientPort->lastRangeChunkCount(), 3);
+    EXPECT_EQ(clientPort->lastRangeChunkStatus(0), Status_Good);
+    EXPECT_EQ(clientPort->lastRangeChunkStatus(1), Status_BadIllegalDataAddress);
+    EXPECT_EQ(clientPort->lastRangeChunkStatus(2), Status_Good);
+    EXPECT_EQ(values[24], 24);
+
+    EXPECT_EQ(clientPort->readHoldingRegistersRange(1, 0xFFF0, 0x20, values), Status_BadNotCorrectRequest);
+}
+
 // ============================================================================
 // Algorithm Test (Similar to ServerPort test)
 // ============================================================================
@@ -3277,4 +4066,57 @@ TEST(ModbusClientPort, testMultipleClients)
     EXPECT_EQ(signalCounter.completeCount, 3); // Complete signal should be emitted because 3rd client's operation is complete
 
     EXPECT_EQ(clientPort.currentClient(), nullptr); // Current client should be nullptr because all clients have completed their operations
-}
\ No newline at end of file
+}
+
+TEST(ModbusClientPort, testCancelRequest)
+{
+    NiceMock<MockModbusPort> *mockPort = new NiceMock<MockModbusPort>(false);
+
+    uint8_t func = MBF_READ_HOLDING_REGISTERS;
+    uint8_t requestData[4] = {0x00, 0x00, 0x00, 0x02};
+    uint8_t responseData[5] = {0x04, 0x00, 0x0A, 0x00, 0x14};
+    uint16_t responseSize = sizeof(responseData);
+
+    EXPECT_CALL(*mockPort, isOpen())
+        .WillRepeatedly(Return(true));
+    // Note: request of the 2nd client is written anew after request of the 1st client is abandoned
+    EXPECT_CALL(*mockPort, writeBuffer(_, func, _, _))
+        .Times(2)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, writeBufferSize())
+        .WillRepeatedly(Return(sizeof(requestData)));
+    EXPECT_CALL(*mockPort, writeBufferData())
+        .WillRepeatedly(Return(requestData));
+    EXPECT_CALL(*mockPort, write())
+        .Times(2)
+        .WillRepeatedly(Return(Status_Good));
+    EXPECT_CALL(*mockPort, read())
+        .WillOnce(Return(Status_Processing))
+        .WillOnce(Return(Status_Good));
+    EXPECT_CALL(*mockPort, readBuffer(_, _, _, _, _))
+        .WillOnce(DoAll(
+                SetArgReferee<0>(2),
+                SetArgReferee<1>(func),
+                SetArrayArgument<2>(responseData, responseData + responseSize),
+                SetArgPointee<4>(responseSize),
+                Return(Status_Good)));
+    EXPECT_CALL(*mockPort, readBufferSize())
+        .WillRepeatedly(Return(responseSize));
+    EXPECT_CALL(*mockPort, readBufferData())
+        .WillRepeatedly(Return(responseData));
+
+    ModbusClientPort clientPort(mockPort);
+    ModbusClient client1(1, &clientPort);
+    ModbusClient client2(2, &clientPort);
+
+    uint16_t readValues[2];
+    EXPECT_EQ(client1.readHoldingRegisters(0, 2, readValues), Status_Processing);
+    EXPECT_EQ(clientPort.currentClient(), &client1);
+
+    clientPort.cancelRequest(&client1);
+    EXPECT_EQ(clientPort.currentClient(), nullptr);
+
+    EXPECT_EQ(client2.readHoldingRegisters(0, 2, readValues), Status_Good);
+    EXPECT_EQ(readValues[0], 0x000A);
+    EXPECT_EQ(readValues[1], 0x0014);
+}
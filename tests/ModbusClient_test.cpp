@@ -85,6 +85,111 @@ TEST_F(ModbusClientTest, BasicProperties)
     EXPECT_EQ(client->type(), ProtocolType::TCP);
 }
 
+TEST_F(ModbusClientTest, RequestOptions)
+{
+    EXPECT_EQ(client->requestTimeout(), 0u);
+    EXPECT_EQ(client->requestDeadline(), 0u);
+
+    client->setRequestTimeout(50);
+    client->setRequestDeadline(200);
+    EXPECT_EQ(client->requestTimeout(), 50u);
+    EXPECT_EQ(client->requestDeadline(), 200u);
+
+    ModbusClientPort::RequestOptions options = clientPort->requestOptions(client);
+    EXPECT_EQ(options.timeout, 50u);
+    EXPECT_EQ(options.deadline, 200u);
+    // Note: options of the client do not affect requests of the port itself
+    EXPECT_EQ(clientPort->requestOptions(clientPort).timeout, 0u);
+}
+
+TEST_F(ModbusClientTest, TransactionGroup)
+{
+    ModbusClient other(kUnit, clientPort);
+    EXPECT_EQ(client->beginGroup(), Status_Good);
+    EXPECT_EQ(clientPort->groupClient(), client);
+
+    // Note: port is not touched by other client while the group is active
+    EXPECT_CALL(*mockPort, writeBuffer(_, _, _, _)).Times(0);
+    uint16_t values[1] = {0};
+    EXPECT_EQ(other.readHoldingRegisters(0, 1, values), Status_Processing);
+    EXPECT_EQ(other.beginGroup(), Status_Processing);
+    Mock::VerifyAndClearExpectations(mockPort);
+    EXPECT_CALL(*mockPort, isOpen()).WillRepeatedly(Return(true));
+
+    uint8_t req[]  = {0x00, 0x00, 0x00, 0x01};
+    uint8_t resp[] = {0x02, 0x12, 0x34};
+    for (int i = 0; i < 2; i++)
+    {
+        verifyWrappedCall(MBF_READ_HOLDING_REGISTERS, req, sizeof(req), resp, sizeof(resp), [&] {
+            return client->readHoldingRegisters(0, 1, values);
+        });
+        EXPECT_EQ(clientPort->groupClient(), client);
+    }
+
+    client->endGroup();
+    EXPECT_EQ(clientPort->groupClient(), nullptr);
+    EXPECT_EQ(other.beginGroup(), Status_Good);
+    other.endGroup();
+}
+
+TEST_F(ModbusClientTest, TransactionGroupReleasedByCancelRequest)
+{
+    ModbusClient other(kUnit, clientPort);
+    EXPECT_EQ(client->beginGroup(), Status_Good);
+    clientPort->cancelRequest(client);
+    EXPECT_EQ(clientPort->groupClient(), nullptr);
+    EXPECT_EQ(other.beginGroup(), Status_Good);
+    other.endGroup();
+}
+
+TEST_F(ModbusClientTest, TransactionGroupReleasedByClientDestruction)
+{
+    ModbusClient *owner = new ModbusClient(kUnit, clientPort);
+    EXPECT_EQ(owner->beginGroup(), Status_Good);
+    delete owner;
+    EXPECT_EQ(clientPort->groupClient(), nullptr);
+    EXPECT_EQ(client->beginGroup(), Status_Good);
+    client->endGroup();
+}
+
+TEST_F(ModbusClientTest, RequestOptionsRemovedByClientDestruction)
+{
+    ModbusClient *owner = new ModbusClient(kUnit, clientPort);
+    owner->setRequestTimeout(50);
+    owner->setRequestDeadline(200);
+    const ModbusObject *key = owner;
+    EXPECT_EQ(clientPort->requestOptions(key).timeout, 50u);
+    delete owner;
+    EXPECT_EQ(clientPort->requestOptions(key).timeout, 0u);
+    EXPECT_EQ(clientPort->requestOptions(key).deadline, 0u);
+}
+
+TEST_F(ModbusClientTest, PortDestroyedBeforeClient)
+{
+    ModbusClientPort *port = new ModbusClientPort(new NiceMock<MockModbusPort>(true));
+    ModbusClient *owner = new ModbusClient(kUnit, port);
+    ModbusClient other(kUnit, port);
+    EXPECT_EQ(owner->port(), port);
+    delete owner; // Note: destroyed client is not detached again by the port
+    delete port;
+    EXPECT_EQ(other.port(), nullptr);
+}
+
+TEST_F(ModbusClientTest, TransactionGroupReleasedByTimeout)
+{
+    EXPECT_EQ(clientPort->groupTimeout(), 10000u);
+    clientPort->setGroupTimeout(20);
+    ModbusClient other(kUnit, clientPort);
+    EXPECT_EQ(client->beginGroup(), Status_Good);
+    EXPECT_EQ(other.beginGroup(), Status_Processing);
+
+    // Note: group client made no request during group timeout (e.g. forgot to call `endGroup()`)
+    msleep(30);
+    EXPECT_EQ(other.beginGroup(), Status_Good);
+    EXPECT_EQ(clientPort->groupClient(), &other);
+    other.endGroup();
+}
+
 TEST_F(ModbusClientTest, WrappedFunctionsCallPortWithExpectedParams)
 {
 #ifndef MBF_READ_COILS_DISABLE
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <ModbusClient.h>
+#include <ModbusClientPort.h>
+#include <ModbusSubscription.h>
+#include <ModbusPollScheduler.h>
+#include <ModbusGlobal.h>
+
+#include "MockModbusPort.h"
+
+using namespace testing;
+using namespace Modbus;
+
+class ModbusPollSchedulerTest : public ::testing::Test
+{
+protected:
+    NiceMock<MockModbusPort> *mockPort {nullptr};
+    ModbusClientPort *clientPort {nullptr};
+    ModbusClient *client {nullptr};
+    uint16_t regs[16];
+    uint16_t reqOffset {0};
+    uint16_t reqCount {0};
+    uint32_t delay {0};
+
+    // Emulates device which answers FC03 by `regs` and increments `regs[0]` on every read of it
+    void SetUp() override
+    {
+        memset(regs, 0, sizeof(regs));
+        mockPort = new NiceMock<MockModbusPort>(true);
+        EXPECT_CALL(*mockPort, setServerMode(false)).Times(AtLeast(0));
+        EXPECT_CALL(*mockPort, isOpen()).WillRepeatedly(Return(true));
+        EXPECT_CALL(*mockPort, writeBuffer(_, _, _, _))
+            .WillRepeatedly(Invoke([this](uint8_t, uint8_t, const uint8_t *buff, uint16_t) {
+                reqOffset = static_cast<uint16_t>((buff[0] << 8) | buff[1]);
+                reqCount  = static_cast<uint16_t>((buff[2] << 8) | buff[3]);
+                return Status_Good;
+            }));
+        EXPECT_CALL(*mockPort, write()).WillRepeatedly(Invoke([this]() {
+                if (delay)
+                    Modbus::msleep(delay);
+                return Status_Good;
+            }));
+        EXPECT_CALL(*mockPort, read()).WillRepeatedly(Return(Status_Good));
+        EXPECT_CALL(*mockPort, readBuffer(_, _, _, _, _))
+            .WillRepeatedly(Invoke([this](uint8_t &unit, uint8_t &f, uint8_t *buff, uint16_t, uint16_t *szOutBuff) {
+                unit = 1;
+                f = MBF_READ_HOLDING_REGISTERS;
+                if (reqOffset == 0)
+                    ++regs[0];
+                buff[0] = static_cast<uint8_t>(reqCount * 2);
+                for (uint16_t i = 0; i < reqCount; i++)
+                {
+                    buff[1 + i * 2] = static_cast<uint8_t>(regs[reqOffset + i] >> 8);
+                    buff[2 + i * 2] = static_cast<uint8_t>(regs[reqOffset + i]);
+                }
+                *szOutBuff = 1 + reqCount * 2;
+                return Status_Good;
+            }));
+
+        clientPort = new ModbusClientPort(mockPort);
+        client = new ModbusClient(1, clientPort);
+    }
+
+    void TearDown() override
+    {
+        delete client;
+        delete clientPort;
+    }
+};
+
+TEST_F(ModbusPollSchedulerTest, AdaptivePeriod)
+{
+    ModbusSubscription changing(client, Memory_4x, 0, 4);
+    ModbusSubscription constant(client, Memory_4x, 8, 4);
+    ModbusPollScheduler scheduler;
+    int ic = scheduler.addSubscription(&changing, 1, 20);
+    int is = scheduler.addSubscription(&constant, 1, 20);
+    EXPECT_EQ(scheduler.itemCount(), 2);
+    EXPECT_EQ(scheduler.subscription(is), &constant);
+    EXPECT_EQ(scheduler.period(is), 1u);
+
+    Timer tm = timer();
+    while ((scheduler.pollCount(is) < 12) && (timer() - tm < 3000))
+    {
+        EXPECT_EQ(scheduler.process(), Status_Good);
+        Modbus::msleep(1);
+    }
+    ASSERT_GE(scheduler.pollCount(is), 12u);
+
+    // Note: changing data keeps minimal period, static data backs off to maximal period
+    EXPECT_DOUBLE_EQ(scheduler.changeRate(ic), 1.0);
+    EXPECT_EQ(scheduler.period(ic), 1u);
+    EXPECT_LT(scheduler.changeRate(is), 0.1);
+    EXPECT_GE(scheduler.period(is), 18u);
+    EXPECT_LE(scheduler.period(is), 20u);
+    EXPECT_GT(scheduler.pollCount(ic), scheduler.pollCount(is));
+}
+
+TEST_F(ModbusPollSchedulerTest, BusBudget)
+{
+    ModbusSubscription s1(client, Memory_4x, 0, 4);
+    ModbusSubscription s2(client, Memory_4x, 8, 4);
+    ModbusPollScheduler scheduler;
+    EXPECT_EQ(scheduler.busBudget(), 80u);
+    scheduler.setBusBudget(50);
+    int i1 = scheduler.addSubscription(&s1, 4, 1000);
+    int i2 = scheduler.addSubscription(&s2, 4, 1000);
+
+    // Note: every poll takes at least 2 ms, so minimal periods need more than 100% of the bus
+    delay = 2;
+    EXPECT_EQ(scheduler.process(), Status_Good);
+    EXPECT_EQ(scheduler.process(), Status_Good);
+    EXPECT_EQ(scheduler.pollCount(i1), 1u);
+    EXPECT_EQ(scheduler.pollCount(i2), 1u);
+    EXPECT_GE(scheduler.pollTimeUs(i1), 2000u);
+    EXPECT_GE(scheduler.period(i1), 8u);
+    EXPECT_GE(scheduler.period(i2), 8u);
+    EXPECT_LE(scheduler.busLoad(), 50.01);
+    EXPECT_GT(scheduler.timeToNextPoll(), 0u);
+}
+
+TEST_F(ModbusPollSchedulerTest, BusBudgetCappedByPeriodMax)
+{
+    ModbusSubscription s1(client, Memory_4x, 0, 4);
+    ModbusSubscription s2(client, Memory_4x, 8, 4);
+    ModbusPollScheduler scheduler;
+    scheduler.setBusBudget(10);
+    int i1 = scheduler.addSubscription(&s1, 4, 6);
+    int i2 = scheduler.addSubscription(&s2, 4, 6);
+
+    // Note: every poll takes at least 2 ms, so even maximal periods need more than 60% of the bus
+    delay = 2;
+    EXPECT_EQ(scheduler.process(), Status_Good);
+    EXPECT_EQ(scheduler.process(), Status_Good);
+    EXPECT_EQ(scheduler.period(i1), 6u);
+    EXPECT_EQ(scheduler.period(i2), 6u);
+    EXPECT_GT(scheduler.busLoad(), 60.0);
+}
@@ -360,3 +360,31 @@ TEST(ModbusQtTest, CreateAsciiPortFromSettings)
     delete p;
 }
 
+// ----------------------------------------------------------------------------
+// Socket options
+// ----------------------------------------------------------------------------
+TEST(ModbusQtTest, SocketOptionsProfileAndOverride)
+{
+    Settings s;
+    bool ok = true;
+    SocketOptions o = getSettingSocketOptions(s, &ok);
+    EXPECT_FALSE(ok);
+    EXPECT_EQ(o.noDelay, 0);
+    EXPECT_EQ(o.userTimeout, 0u);
+
+    s[Strings::instance().socketProfile] = Strings::instance().LowLatencyProfile;
+    s[Strings::instance().tcpUserTimeout] = 2000;
+    s[Strings::instance().busyPoll] = 0;
+    o = getSettingSocketOptions(s, &ok);
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(o.noDelay, 1);
+    EXPECT_EQ(o.keepAliveIdle, 5u);
+    EXPECT_EQ(o.userTimeout, 2000u);
+    EXPECT_EQ(o.busyPoll, 0u);
+
+    Settings s2;
+    setSettingSocketOptions(s2, o);
+    SocketOptions o2 = getSettingSocketOptions(s2, &ok);
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(memcmp(&o, &o2, sizeof(o)), 0);
+}
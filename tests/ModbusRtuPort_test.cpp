@@ -7,6 +7,12 @@
 #include <ModbusSerialPort_p.h>
 #include <ModbusGlobal.h>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
 using namespace Modbus;
 
 // Helper class to access protected members for testing
@@ -545,6 +551,248 @@ TEST_F(ModbusRtuPortTest, DefaultSerialSettings)
     EXPECT_EQ(port->flowControl(), defaults.flowControl );
 }
 
+TEST_F(ModbusRtuPortTest, Rs485Settings)
+{
+    port = new ModbusRtuPortTestHelper();
+
+    EXPECT_FALSE(port->isRs485Enabled());
+    EXPECT_EQ(port->rs485DelayRtsBeforeSend(), 0u);
+    EXPECT_EQ(port->rs485DelayRtsAfterSend(), 0u);
+    EXPECT_FALSE(port->isLowLatency());
+    EXPECT_EQ(port->turnaroundDelay(), 0u);
+
+    port->setRs485Enabled(true);
+    port->setRs485DelayRtsBeforeSend(1);
+    port->setRs485DelayRtsAfterSend(2);
+    port->setLowLatency(true);
+    port->setTurnaroundDelay(500);
+    EXPECT_TRUE(port->isRs485Enabled());
+    EXPECT_EQ(port->rs485DelayRtsBeforeSend(), 1u);
+    EXPECT_EQ(port->rs485DelayRtsAfterSend(), 2u);
+    EXPECT_TRUE(port->isLowLatency());
+    EXPECT_EQ(port->turnaroundDelay(), 500u);
+}
+
+TEST_F(ModbusRtuPortTest, AutoTimingSettings)
+{
+    port = new ModbusRtuPortTestHelper();
+
+    EXPECT_FALSE(port->isAutoTimingEnabled());
+    port->setAutoTimingEnabled(true);
+    EXPECT_TRUE(port->isAutoTimingEnabled());
+
+    port->setBaudRate(9600);
+    port->setDataBits(8);
+    port->setParity(Modbus::NoParity);
+    port->setStopBits(Modbus::OneStop);
+    EXPECT_EQ(port->charTimeUs(), 1042u);
+    EXPECT_EQ(port->interCharTimeoutUs(), 1563u);
+    EXPECT_EQ(port->interFrameDelayUs(), 3647u);
+
+    port->setBaudRate(115200);
+    EXPECT_EQ(port->interCharTimeoutUs(), 750u);
+    EXPECT_EQ(port->interFrameDelayUs(), 1750u);
+}
+
+#ifndef _WIN32
+// Opens pseudo-terminal master device, slave side is used as serial port
+static int openPtyMaster()
+{
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0)
+        return -1;
+    if (grantpt(master) != 0 || unlockpt(master) != 0)
+    {
+        ::close(master);
+        return -1;
+    }
+    return master;
+}
+
+TEST_F(ModbusRtuPortTest, AutoTimingCompletesFrameByInterFrameDelay)
+{
+    int master = openPtyMaster();
+    ASSERT_GE(master, 0);
+
+    port = new ModbusRtuPortTestHelper(false);
+    port->setPortName(ptsname(master));
+    port->setBaudRate(115200);
+    port->setTimeoutFirstByte(1000);
+    port->setTimeoutInterByte(1000);
+    port->setAutoTimingEnabled(true);
+    ASSERT_EQ(port->open(), Status_Good);
+
+    const uint8_t frame[] = { 0x01, 0x03, 0x02, 0x00, 0x01, 0x79, 0x84 };
+    ASSERT_EQ(::write(master, frame, sizeof(frame)), static_cast<ssize_t>(sizeof(frame)));
+
+    // Note: frame must be completed by t3.5 silence, not by 1000 ms inter-byte timeout
+    Timer start = timer();
+    StatusCode r;
+    while (StatusIsProcessing(r = port->testRead()))
+        microsleep(100);
+    EXPECT_EQ(r, Status_Good);
+    EXPECT_LT(timer() - start, 500u);
+
+    uint8_t unit, func, buff[16];
+    uint16_t sz;
+    EXPECT_EQ(port->testReadBuffer(unit, func, buff, sizeof(buff), &sz), Status_Good);
+    EXPECT_EQ(sz, 3);
+
+    port->close();
+    ::close(master);
+}
+
+TEST_F(ModbusRtuPortTest, OpenHighStandardBaudRate)
+{
+    int master = openPtyMaster();
+    ASSERT_GE(master, 0);
+
+    port = new ModbusRtuPortTestHelper();
+    port->setPortName(ptsname(master));
+    port->setBaudRate(921600);
+    EXPECT_EQ(port->open(), Status_Good);
+    EXPECT_EQ(port->interFrameDelayUs(), 1750u);
+
+    port->close();
+    ::close(master);
+}
+
+#ifdef __linux__
+TEST_F(ModbusRtuPortTest, OpenCustomBaudRate)
+{
+    int master = openPtyMaster();
+    ASSERT_GE(master, 0);
+
+    port = new ModbusRtuPortTestHelper();
+    port->setPortName(ptsname(master));
+    port->setBaudRate(250000);
+    EXPECT_EQ(port->open(), Status_Good);
+    EXPECT_TRUE(port->isOpen());
+
+    port->close();
+    ::close(master);
+}
+#endif // __linux__
+
+TEST_F(ModbusRtuPortTest, OpenInvalidBaudRateFails)
+{
+    int master = openPtyMaster();
+    ASSERT_GE(master, 0);
+
+    port = new ModbusRtuPortTestHelper();
+    port->setPortName(ptsname(master));
+    port->setBaudRate(0);
+    EXPECT_EQ(port->open(), Status_BadSerialOpen);
+    EXPECT_FALSE(port->isOpen());
+
+    ::close(master);
+}
+
+TEST_F(ModbusRtuPortTest, LowLatencyIsIgnoredIfNotSupported)
+{
+    int master = openPtyMaster();
+    ASSERT_GE(master, 0);
+
+    port = new ModbusRtuPortTestHelper();
+    port->setPortName(ptsname(master));
+    port->setLowLatency(true);
+    EXPECT_EQ(port->open(), Status_Good);
+
+    port->close();
+    ::close(master);
+}
+
+#ifdef __linux__
+TEST_F(ModbusRtuPortTest, Rs485NotSupportedFailsOpen)
+{
+    int master = openPtyMaster();
+    ASSERT_GE(master, 0);
+
+    // Note: pseudo-terminal driver does not support kernel RS-485 mode
+    port = new ModbusRtuPortTestHelper();
+    port->setPortName(ptsname(master));
+    port->setRs485Enabled(true);
+    EXPECT_EQ(port->open(), Status_BadSerialOpen);
+    EXPECT_FALSE(port->isOpen());
+
+    ::close(master);
+}
+#endif // __linux__
+
+TEST_F(ModbusRtuPortTest, TurnaroundDelayBeforeTransmit)
+{
+    int master = openPtyMaster();
+    ASSERT_GE(master, 0);
+
+    port = new ModbusRtuPortTestHelper(false);
+    port->setPortName(ptsname(master));
+    port->setTurnaroundDelay(200000);
+    ASSERT_EQ(port->open(), Status_Good);
+
+    const uint8_t frame[] = { 0x01, 0x03, 0x00, 0x00, 0x00, 0x01, 0x84, 0x0A };
+    port->setInternalBuffer(frame, sizeof(frame));
+    EXPECT_EQ(port->testWrite(), Status_Good);
+    // Note: next transmit is delayed until turnaround delay after own transmission is elapsed
+    port->setInternalBuffer(frame, sizeof(frame));
+    EXPECT_EQ(port->testWrite(), Status_Processing);
+    StatusCode r;
+    while (StatusIsProcessing(r = port->testWrite()))
+        microsleep(1000);
+    EXPECT_EQ(r, Status_Good);
+
+    port->close();
+    ::close(master);
+}
+
+TEST_F(ModbusRtuPortTest, LateResponseAfterTimeoutIsDropped)
+{
+    int master = openPtyMaster();
+    ASSERT_GE(master, 0);
+
+    port = new ModbusRtuPortTestHelper(false);
+    port->setPortName(ptsname(master));
+    port->setTimeoutFirstByte(50);
+    port->setTimeoutInterByte(5);
+    ASSERT_EQ(port->open(), Status_Good);
+
+    const uint8_t request[] = { 0x01, 0x03, 0x00, 0x00, 0x00, 0x01, 0x84, 0x0A };
+    uint8_t input[64];
+    port->setInternalBuffer(request, sizeof(request));
+    EXPECT_EQ(port->testWrite(), Status_Good);
+    EXPECT_EQ(::read(master, input, sizeof(input)), static_cast<ssize_t>(sizeof(request)));
+    StatusCode r;
+    while (StatusIsProcessing(r = port->testRead()))
+        microsleep(1000);
+    EXPECT_EQ(r, Status_BadSerialReadTimeout);
+
+    // Note: response to the timed out request arrives before the next one is sent
+    const uint8_t lateResponse[] = { 0x01, 0x03, 0x02, 0x00, 0x02, 0x39, 0x85 };
+    ASSERT_EQ(::write(master, lateResponse, sizeof(lateResponse)), static_cast<ssize_t>(sizeof(lateResponse)));
+
+    port->setInternalBuffer(request, sizeof(request));
+    while (StatusIsProcessing(r = port->testWrite()))
+        microsleep(1000);
+    EXPECT_EQ(r, Status_Good);
+    EXPECT_EQ(::read(master, input, sizeof(input)), static_cast<ssize_t>(sizeof(request)));
+
+    const uint8_t response[] = { 0x01, 0x03, 0x02, 0x00, 0x01, 0x79, 0x84 };
+    ASSERT_EQ(::write(master, response, sizeof(response)), static_cast<ssize_t>(sizeof(response)));
+    while (StatusIsProcessing(r = port->testRead()))
+        microsleep(1000);
+    EXPECT_EQ(r, Status_Good);
+
+    uint8_t unit, func, buff[16];
+    uint16_t sz;
+    EXPECT_EQ(port->testReadBuffer(unit, func, buff, sizeof(buff), &sz), Status_Good);
+    ASSERT_EQ(sz, 3);
+    EXPECT_EQ(buff[2], 0x01);
+
+    port->close();
+    ::close(master);
+}
+
+#endif // _WIN32
+
 // ============================================================================
 // CRC Validation Tests
 // ============================================================================
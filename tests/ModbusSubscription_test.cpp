@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <ModbusClient.h>
+#include <ModbusClientPort.h>
+#include <ModbusSubscription.h>
+#include <ModbusGlobal.h>
+
+#include "MockModbusPort.h"
+
+using namespace testing;
+using namespace Modbus;
+
+typedef std::pair<uint16_t, uint16_t> RangeChunk; // offset, count
+
+class ModbusSubscriptionTest : public ::testing::Test
+{
+protected:
+    struct Recorder
+    {
+        std::vector<RangeChunk> ranges;
+        std::vector<std::pair<int, double> > tags;
+
+        void onRangeChanged(const Char *, uint16_t offset, uint16_t count) { ranges.push_back(std::make_pair(offset, count)); }
+        void onTagChanged(const Char *, int tag, double value) { tags.push_back(std::make_pair(tag, value)); }
+        void clear() { ranges.clear(); tags.clear(); }
+    };
+
+    NiceMock<MockModbusPort> *mockPort {nullptr};
+    ModbusClientPort *clientPort {nullptr};
+    ModbusClient *client {nullptr};
+    uint16_t regs[16];
+    uint8_t coils[4];
+    uint8_t func {0};
+    uint16_t reqOffset {0};
+    uint16_t reqCount {0};
+    Recorder recorder;
+
+    // Emulates device which answers FC01 by `coils` and FC03 by `regs`
+    void SetUp() override
+    {
+        memset(regs, 0, sizeof(regs));
+        memset(coils, 0, sizeof(coils));
+        mockPort = new NiceMock<MockModbusPort>(true);
+        EXPECT_CALL(*mockPort, setServerMode(false)).Times(AtLeast(0));
+        EXPECT_CALL(*mockPort, isOpen()).WillRepeatedly(Return(true));
+        EXPECT_CALL(*mockPort, writeBuffer(_, _, _, _))
+            .WillRepeatedly(Invoke([this](uint8_t, uint8_t f, const uint8_t *buff, uint16_t) {
+                func = f;
+                reqOffset = static_cast<uint16_t>((buff[0] << 8) | buff[1]);
+                reqCount  = static_cast<uint16_t>((buff[2] << 8) | buff[3]);
+                return Status_Good;
+            }));
+        EXPECT_CALL(*mockPort, write()).WillRepeatedly(Return(Status_Good));
+        EXPECT_CALL(*mockPort, read()).WillRepeatedly(Return(Status_Good));
+        EXPECT_CALL(*mockPort, readBuffer(_, _, _, _, _))
+            .WillRepeatedly(Invoke([this](uint8_t &unit, uint8_t &f, uint8_t *buff, uint16_t, uint16_t *szOutBuff) {
+                unit = 1;
+                f = func;
+                if (func == MBF_READ_COILS)
+                {
+                    buff[0] = static_cast<uint8_t>((reqCount + 7) / 8);
+                    for (uint16_t i = 0; i < buff[0]; i++)
+                        buff[1 + i] = 0;
+                    for (uint16_t i = 0; i < reqCount; i++)
+                    {
+                        uint16_t c = reqOffset + i;
+                        if (coils[c / 8] & (1 << (c % 8)))
+                            buff[1 + i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+                    }
+                    *szOutBuff = 1 + buff[0];
+                    return Status_Good;
+                }
+                buff[0] = static_cast<uint8_t>(reqCount * 2);
+                for (uint16_t i = 0; i < reqCount; i++)
+                {
+                    buff[1 + i * 2] = static_cast<uint8_t>(regs[reqOffset + i] >> 8);
+                    buff[2 + i * 2] = static_cast<uint8_t>(regs[reqOffset + i]);
+                }
+                *szOutBuff = 1 + reqCount * 2;
+                return Status_Good;
+            }));
+
+        clientPort = new ModbusClientPort(mockPort);
+        client = new ModbusClient(1, clientPort);
+    }
+
+    void TearDown() override
+    {
+        delete client;
+        delete clientPort;
+    }
+
+    void connect(ModbusSubscription &sub)
+    {
+        sub.connect(&ModbusSubscription::signalRangeChanged, &recorder, &Recorder::onRangeChanged);
+        sub.connect(&ModbusSubscription::signalTagChanged  , &recorder, &Recorder::onTagChanged  );
+    }
+};
+
+TEST_F(ModbusSubscriptionTest, RangeChanges)
+{
+    ModbusSubscription sub(client, Memory_4x, 2, 10);
+    connect(sub);
+
+    // Note: the first poll reports the whole block
+    EXPECT_EQ(sub.poll(), Status_Good);
+    ASSERT_EQ(recorder.ranges.size(), 1u);
+    EXPECT_EQ(recorder.ranges[0], RangeChunk(2, 10));
+    EXPECT_EQ(sub.changedCount(), 10u);
+
+    recorder.clear();
+    EXPECT_EQ(sub.poll(), Status_Good);
+    EXPECT_TRUE(recorder.ranges.empty());
+    EXPECT_EQ(sub.changedCount(), 0u);
+
+    regs[5] = 1;
+    regs[6] = 2;
+    regs[11] = 3;
+    regs[12] = 4; // Note: out of the block
+    EXPECT_EQ(sub.poll(), Status_Good);
+    ASSERT_EQ(recorder.ranges.size(), 2u);
+    EXPECT_EQ(recorder.ranges[0], RangeChunk(5, 2));
+    EXPECT_EQ(recorder.ranges[1], RangeChunk(11, 1));
+    EXPECT_EQ(sub.changedCount(), 3u);
+    EXPECT_TRUE(sub.isChanged(6));
+    EXPECT_FALSE(sub.isChanged(7));
+    EXPECT_EQ(reinterpret_cast<const uint16_t*>(sub.values())[3], 1);
+}
+
+TEST_F(ModbusSubscriptionTest, TagDeadband)
+{
+    ModbusSubscription sub(client, Memory_4x, 0, 8);
+    connect(sub);
+    float f = 100.0f;
+    uint32_t v32;
+    memcpy(&v32, &f, sizeof(v32));
+    regs[0] = static_cast<uint16_t>(v32 >> 16);
+    regs[1] = static_cast<uint16_t>(v32);
+    regs[2] = 100;
+    int tf = sub.addTag(0, ModbusSubscription::TagFloat32, ModbusSubscription::DeadbandAbsolute, 0.5);
+    int ti = sub.addTag(2, ModbusSubscription::TagInt16, ModbusSubscription::DeadbandPercent, 10);
+    EXPECT_EQ(sub.addTag(7, ModbusSubscription::TagUInt32), -1);
+
+    EXPECT_EQ(sub.poll(), Status_Good);
+    ASSERT_EQ(recorder.tags.size(), 2u);
+    EXPECT_DOUBLE_EQ(sub.tagValue(tf), 100.0);
+    EXPECT_DOUBLE_EQ(sub.tagValue(ti), 100.0);
+
+    // Note: changes within deadband are not notified, but the range is
+    recorder.clear();
+    f = 100.25f;
+    memcpy(&v32, &f, sizeof(v32));
+    regs[1] = static_cast<uint16_t>(v32);
+    regs[2] = 105;
+    EXPECT_EQ(sub.poll(), Status_Good);
+    EXPECT_EQ(recorder.ranges.size(), 1u);
+    EXPECT_TRUE(recorder.tags.empty());
+
+    recorder.clear();
+    f = 101.0f;
+    memcpy(&v32, &f, sizeof(v32));
+    regs[0] = static_cast<uint16_t>(v32 >> 16);
+    regs[1] = static_cast<uint16_t>(v32);
+    regs[2] = static_cast<uint16_t>(-20);
+    EXPECT_EQ(sub.poll(), Status_Good);
+    ASSERT_EQ(recorder.tags.size(), 2u);
+    EXPECT_EQ(recorder.tags[0].first, tf);
+    EXPECT_DOUBLE_EQ(recorder.tags[0].second, 101.0);
+    EXPECT_EQ(recorder.tags[1].first, ti);
+    EXPECT_DOUBLE_EQ(recorder.tags[1].second, -20.0);
+}
+
+TEST_F(ModbusSubscriptionTest, CoilChanges)
+{
+    ModbusSubscription sub(client, Memory_0x, 0, 20);
+    connect(sub);
+    int t = sub.addTag(17, ModbusSubscription::TagUInt16);
+
+    EXPECT_EQ(sub.poll(), Status_Good);
+    recorder.clear();
+
+    coils[2] = 0x02; // coil 17
+    EXPECT_EQ(sub.poll(), Status_Good);
+    ASSERT_EQ(recorder.ranges.size(), 1u);
+    EXPECT_EQ(recorder.ranges[0], RangeChunk(17, 1));
+    ASSERT_EQ(recorder.tags.size(), 1u);
+    EXPECT_EQ(recorder.tags[0].first, t);
+    EXPECT_DOUBLE_EQ(recorder.tags[0].second, 1.0);
+}
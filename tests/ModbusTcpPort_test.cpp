@@ -5,6 +5,14 @@
 #include <ModbusPort_p.h>
 #include <ModbusGlobal.h>
 
+#ifndef _WIN32
+#include <thread>
+#include <netinet/tcp.h>
+#include <ModbusClientPort.h>
+#include <unix/ModbusResolver_unix.h>
+#include <unix/Modbus_unix.h>
+#endif
+
 // Helper class to access protected members for testing
 class ModbusTcpPortTestHelper : public ModbusTcpPort
 {
@@ -40,6 +48,11 @@ public:
         return this->transactionId();
     }
 
+    uint16_t testDropStaleFrames()
+    {
+        return d_ptr->frame->dropStaleFrames();
+    }
+
     // Expose write() and read() for testing
     StatusCode testWrite()
     {
@@ -526,6 +539,48 @@ TEST_F(ModbusTcpPortTest, ReadBufferTransactionMismatch)
     EXPECT_EQ(result, Status_BadNotCorrectResponse);
 }
 
+TEST_F(ModbusTcpPortTest, ReadBufferStaleResponseDropped)
+{
+    port = new ModbusTcpPortTestHelper();
+    port->setServerMode(false);
+
+    uint8_t unit = 1;
+    uint8_t func = MBF_READ_HOLDING_REGISTERS;
+    uint8_t sendData[4] = {0x00, 0x00, 0x00, 0x01};
+
+    // Note: response to the 1st (abandoned) request arrives right before response to the 2nd one
+    port->testWriteBuffer(unit, func, sendData, sizeof(sendData));
+    uint16_t staleTransaction = port->transactionId();
+    port->testWriteBuffer(unit, func, sendData, sizeof(sendData));
+    uint16_t expectedTransaction = port->transactionId();
+
+    uint8_t responseData[22] = {
+        static_cast<uint8_t>(staleTransaction >> 8), static_cast<uint8_t>(staleTransaction), 0x00, 0x00, 0x00, 0x05, unit, func, 0x02, 0x00, 0x01,
+        static_cast<uint8_t>(expectedTransaction >> 8), static_cast<uint8_t>(expectedTransaction), 0x00, 0x00, 0x00, 0x05, unit, func, 0x02, 0x00, 0x02
+    };
+    port->setInternalBuffer(responseData, sizeof(responseData));
+
+    EXPECT_EQ(port->testDropStaleFrames(), 1);
+    EXPECT_EQ(port->staleResponseCount(), 1u);
+
+    uint8_t outUnit, outFunc;
+    uint8_t outBuff[255];
+    uint16_t outSize;
+
+    StatusCode result = port->testReadBuffer(outUnit, outFunc, outBuff, sizeof(outBuff), &outSize);
+
+    EXPECT_EQ(result, Status_Good);
+    EXPECT_EQ(outSize, 3);
+    EXPECT_EQ(outBuff[2], 0x02);
+
+    // Note: response with transaction id greater than current one is not stale
+    responseData[0] = static_cast<uint8_t>((expectedTransaction + 1) >> 8);
+    responseData[1] = static_cast<uint8_t>(expectedTransaction + 1);
+    port->setInternalBuffer(responseData, 11);
+    EXPECT_EQ(port->testDropStaleFrames(), 0);
+    EXPECT_EQ(port->staleResponseCount(), 1u);
+}
+
 // ============================================================================
 // Open/Close/IsOpen Tests
 // ============================================================================
@@ -1414,3 +1469,314 @@ TEST_F(ModbusTcpPortTest, SocketReadDifferentResponseSizes)
     EXPECT_EQ(result, Status_Good);
     EXPECT_EQ(outSize, 252); // 260 - 6 (header) - 1 (unit) - 1 (func)
 }
+
+#ifndef _WIN32
+// ============================================================================
+// Host Resolution and Connection Tests (Unix)
+// ============================================================================
+
+TEST_F(ModbusTcpPortTest, ResolverCache)
+{
+    ModbusResolver &resolver = ModbusResolver::instance();
+    Modbus::clearHostCache();
+    EXPECT_EQ(Modbus::hostCacheTtl(), 60000u);
+
+    sockaddr_in addr;
+    int err = 0;
+    uint32_t lookups = resolver.lookupCount();
+    // Note: IP literal doesn't need lookup
+    EXPECT_EQ(resolver.resolve("127.0.0.1", false, &addr, &err), Status_Good);
+    EXPECT_EQ(addr.sin_addr.s_addr, htonl(INADDR_LOOPBACK));
+    EXPECT_EQ(resolver.lookupCount(), lookups);
+
+    // Note: non-blocking resolution is done by background thread
+    StatusCode r = resolver.resolve("localhost", false, &addr, &err);
+    EXPECT_EQ(r, Status_Processing);
+    Modbus::Timer tm = Modbus::timer();
+    while ((r == Status_Processing) && (Modbus::timer() - tm < 5000))
+    {
+        Modbus::msleep(1);
+        r = resolver.resolve("localhost", false, &addr, &err);
+    }
+    ASSERT_EQ(r, Status_Good);
+    EXPECT_EQ(resolver.lookupCount(), lookups + 1);
+
+    // Note: cached address is used by blocking resolution too
+    EXPECT_EQ(resolver.resolve("localhost", true, &addr, &err), Status_Good);
+    EXPECT_EQ(resolver.lookupCount(), lookups + 1);
+
+    Modbus::clearHostCache();
+    EXPECT_EQ(resolver.resolve("localhost", true, &addr, &err), Status_Good);
+    EXPECT_EQ(resolver.lookupCount(), lookups + 2);
+}
+
+TEST_F(ModbusTcpPortTest, NonBlockingConnectCompletesByWritability)
+{
+    int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_NE(listener, -1);
+    sockaddr_in sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sa.sin_port = 0;
+    ASSERT_EQ(::bind(listener, reinterpret_cast<sockaddr*>(&sa), sizeof(sa)), 0);
+    ASSERT_EQ(::listen(listener, 8), 0);
+    socklen_t len = sizeof(sa);
+    ::getsockname(listener, reinterpret_cast<sockaddr*>(&sa), &len);
+
+    ModbusTcpPort port(false);
+    port.setHost("127.0.0.1");
+    port.setPort(ntohs(sa.sin_port));
+    port.setTimeout(2000);
+    StatusCode r = port.open();
+    Modbus::Timer tm = Modbus::timer();
+    while ((r == Status_Processing) && (Modbus::timer() - tm < 3000))
+    {
+        Modbus::msleep(1);
+        r = port.open();
+    }
+    EXPECT_EQ(r, Status_Good);
+    EXPECT_TRUE(port.isOpen());
+    port.close();
+    ::close(listener);
+
+    // Note: refused connection is reported as error without waiting for timeout
+    port.setTimeout(5000);
+    tm = Modbus::timer();
+    r = port.open();
+    while ((r == Status_Processing) && (Modbus::timer() - tm < 3000))
+    {
+        Modbus::msleep(1);
+        r = port.open();
+    }
+    EXPECT_EQ(r, Status_BadTcpConnect);
+    EXPECT_LT(Modbus::timer() - tm, 3000u);
+}
+
+TEST_F(ModbusTcpPortTest, SocketOptionsAppliedOnOpen)
+{
+    int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_NE(listener, -1);
+    sockaddr_in sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sa.sin_port = 0;
+    ASSERT_EQ(::bind(listener, reinterpret_cast<sockaddr*>(&sa), sizeof(sa)), 0);
+    ASSERT_EQ(::listen(listener, 8), 0);
+    socklen_t len = sizeof(sa);
+    ::getsockname(listener, reinterpret_cast<sockaddr*>(&sa), &len);
+
+    Modbus::SocketOptions opt = Modbus::lowLatencySocketOptions();
+    opt.recvBufferSize = 65536;
+    ModbusTcpPort port(true);
+    port.setHost("127.0.0.1");
+    port.setPort(ntohs(sa.sin_port));
+    port.setTimeout(2000);
+    port.setSocketOptions(opt);
+    ASSERT_EQ(port.open(), Status_Good);
+
+    int s = static_cast<int>(reinterpret_cast<intptr_t>(port.handle()));
+    int v = 0;
+    len = sizeof(v);
+    ASSERT_EQ(::getsockopt(s, IPPROTO_TCP, TCP_NODELAY, &v, &len), 0);
+    EXPECT_NE(v, 0);
+    ASSERT_EQ(::getsockopt(s, SOL_SOCKET, SO_KEEPALIVE, &v, &len), 0);
+    EXPECT_NE(v, 0);
+    ASSERT_EQ(::getsockopt(s, IPPROTO_TCP, TCP_KEEPIDLE, &v, &len), 0);
+    EXPECT_EQ(v, 5);
+    ASSERT_EQ(::getsockopt(s, IPPROTO_TCP, TCP_KEEPCNT, &v, &len), 0);
+    EXPECT_EQ(v, 3);
+#ifdef TCP_USER_TIMEOUT
+    ASSERT_EQ(::getsockopt(s, IPPROTO_TCP, TCP_USER_TIMEOUT, &v, &len), 0);
+    EXPECT_EQ(v, 5000);
+#endif
+    // Note: kernel may round buffer size (Linux doubles it for bookkeeping)
+    ASSERT_EQ(::getsockopt(s, SOL_SOCKET, SO_RCVBUF, &v, &len), 0);
+    EXPECT_GE(v, 65536);
+
+    port.close();
+    ::close(listener);
+}
+
+// Note: benchmark of the transaction path, blocking transaction must cost exactly `perTransaction` system calls
+static void benchmarkSyscalls(const Modbus::SocketOptions *options, uint32_t perTransaction)
+{
+    const uint32_t count = 1000;
+    int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_NE(listener, -1);
+    sockaddr_in sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sa.sin_port = 0;
+    ASSERT_EQ(::bind(listener, reinterpret_cast<sockaddr*>(&sa), sizeof(sa)), 0);
+    ASSERT_EQ(::listen(listener, 8), 0);
+    socklen_t len = sizeof(sa);
+    ::getsockname(listener, reinterpret_cast<sockaddr*>(&sa), &len);
+
+    // Note: device answers every FC03 request for 1 register with value 0x1234
+    std::thread device([listener]() {
+        int s = ::accept(listener, nullptr, nullptr);
+        if (s < 0)
+            return;
+        uint8_t buff[260];
+        for (;;)
+        {
+            ssize_t c = 0;
+            while (c < 12)
+            {
+                ssize_t r = ::recv(s, buff + c, 12 - c, 0);
+                if (r <= 0)
+                {
+                    ::close(s);
+                    return;
+                }
+                c += r;
+            }
+            uint8_t resp[11] = { buff[0], buff[1], 0x00, 0x00, 0x00, 0x05, buff[6], MBF_READ_HOLDING_REGISTERS, 0x02, 0x12, 0x34 };
+            ::send(s, resp, sizeof(resp), 0);
+        }
+    });
+
+    ModbusTcpPort *tcp = new ModbusTcpPort(true);
+    tcp->setHost("127.0.0.1");
+    tcp->setPort(ntohs(sa.sin_port));
+    tcp->setTimeout(2000);
+    if (options)
+        tcp->setSocketOptions(*options);
+    ModbusClientPort client(tcp);
+
+    uint16_t value = 0;
+    uint64_t tm = Modbus::timerUs();
+    for (uint32_t i = 0; i < count; i++)
+    {
+        ASSERT_EQ(client.readHoldingRegisters(1, 0, 1, &value), Status_Good);
+        ASSERT_EQ(value, 0x1234);
+    }
+    tm = Modbus::timerUs() - tm;
+
+    ModbusClientPort::BusStatistics bus = client.busStatistics();
+    EXPECT_EQ(bus.transactions, count);
+    EXPECT_EQ(bus.syscalls, count * perTransaction);
+    EXPECT_DOUBLE_EQ(client.syscallsPerTransaction(), static_cast<double>(perTransaction));
+    ::testing::Test::RecordProperty("syscallsPerTransaction", std::to_string(client.syscallsPerTransaction()));
+    ::testing::Test::RecordProperty("transactionTimeUs", std::to_string(tm / count));
+
+    // Note: state check doesn't touch the socket
+    uint32_t syscalls = tcp->syscallCount();
+    EXPECT_TRUE(tcp->isOpen());
+    EXPECT_EQ(tcp->syscallCount(), syscalls);
+
+    client.close();
+    device.join();
+    ::close(listener);
+}
+
+// Note: one `send()` and one `recv()` (state checks used to add `getsockopt()` before write and after read)
+TEST_F(ModbusTcpPortTest, BenchmarkSyscallsPerTransaction)
+{
+    benchmarkSyscalls(nullptr, 2);
+}
+
+// Note: `TCP_QUICKACK` is re-armed once per response, so low-latency profile adds one `setsockopt()`
+TEST_F(ModbusTcpPortTest, BenchmarkSyscallsPerTransactionLowLatency)
+{
+    Modbus::SocketOptions options = Modbus::lowLatencySocketOptions();
+#ifdef TCP_QUICKACK
+    benchmarkSyscalls(&options, 3);
+#else
+    benchmarkSyscalls(&options, 2);
+#endif
+}
+
+// Fills socket buffers of the connection, so the next `send()` would block
+static void fillSocketBuffers(int fd)
+{
+    char junk[1024];
+    memset(junk, 0, sizeof(junk));
+    while (::send(fd, junk, sizeof(junk), MSG_DONTWAIT) > 0) {}
+    while (::send(fd, junk, 1, MSG_DONTWAIT) > 0) {}
+}
+
+// Reads all available data and returns count of read bytes
+static size_t drainSocket(int fd, uint8_t *tail, size_t szTail)
+{
+    uint8_t buff[4096];
+    size_t total = 0;
+    for (;;)
+    {
+        ssize_t c = ::recv(fd, buff, sizeof(buff), MSG_DONTWAIT);
+        if (c <= 0)
+            break;
+        // Note: keep the end of the stream to check frames that follow the junk
+        if (static_cast<size_t>(c) >= szTail)
+            memcpy(tail, buff + c - szTail, szTail);
+        else
+        {
+            memmove(tail, tail + c, szTail - c);
+            memcpy(tail + szTail - c, buff, c);
+        }
+        total += c;
+    }
+    return total;
+}
+
+TEST_F(ModbusTcpPortTest, PartialWriteClientWaitsForWritability)
+{
+    int sv[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+    ModbusTcpPort port(new ModbusSocket(sv[0]), false);
+    fillSocketBuffers(sv[0]);
+
+    const uint8_t data[] = {0x00, 0x00, 0x00, 0x0A};
+    ASSERT_EQ(port.writeBuffer(1, MBF_READ_HOLDING_REGISTERS, data, sizeof(data)), Status_Good);
+    const uint16_t sz = port.writeBufferSize();
+    uint8_t frame[32];
+    memcpy(frame, port.writeBufferData(), sz);
+
+    // Note: request is not reported as written until it is sent completely
+    EXPECT_EQ(port.write(), Status_Processing);
+    EXPECT_EQ(port.outputQueueSize(), sz);
+    EXPECT_EQ(port.write(), Status_Processing);
+
+    uint8_t tail[32];
+    drainSocket(sv[1], tail, sz);
+    EXPECT_EQ(port.write(), Status_Good);
+    EXPECT_EQ(port.outputQueueSize(), 0u);
+    EXPECT_GE(drainSocket(sv[1], tail, sz), sz);
+    EXPECT_EQ(memcmp(tail, frame, sz), 0);
+    ::close(sv[1]);
+}
+
+TEST_F(ModbusTcpPortTest, PartialWriteServerQueuesPipelinedResponses)
+{
+    int sv[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+    ModbusTcpPort port(new ModbusSocket(sv[0]), false);
+    port.setServerMode(true);
+    fillSocketBuffers(sv[0]);
+
+    // Note: server connection doesn't wait for the slow client, responses are queued in order
+    const uint8_t data1[] = {0x02, 0x12, 0x34};
+    const uint8_t data2[] = {0x02, 0x56, 0x78};
+    ASSERT_EQ(port.writeBuffer(1, MBF_READ_HOLDING_REGISTERS, data1, sizeof(data1)), Status_Good);
+    const uint16_t sz = port.writeBufferSize();
+    uint8_t frames[64];
+    memcpy(frames, port.writeBufferData(), sz);
+    EXPECT_EQ(port.write(), Status_Good);
+    ASSERT_EQ(port.writeBuffer(1, MBF_READ_HOLDING_REGISTERS, data2, sizeof(data2)), Status_Good);
+    memcpy(frames + sz, port.writeBufferData(), sz);
+    EXPECT_EQ(port.write(), Status_Good);
+    EXPECT_EQ(port.outputQueueSize(), 2u * sz);
+
+    // Note: queue is flushed while the connection waits for the next request
+    uint8_t tail[64];
+    drainSocket(sv[1], tail, 2 * sz);
+    EXPECT_EQ(port.read(), Status_Processing);
+    EXPECT_EQ(port.outputQueueSize(), 0u);
+    EXPECT_GE(drainSocket(sv[1], tail, 2 * sz), 2u * sz);
+    EXPECT_EQ(memcmp(tail, frames, 2 * sz), 0);
+    ::close(sv[1]);
+}
+#endif // _WIN32
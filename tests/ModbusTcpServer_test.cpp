@@ -9,6 +9,12 @@
 #include "MockModbusPort.h"
 #include "MockModbusDevice.h"
 
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
 using namespace testing;
 using namespace Modbus;
 
@@ -852,4 +858,120 @@ TEST(ModbusTcpServerSignalsTest, testSignals)
     EXPECT_EQ(signalHandler.newConnectionCount  ,   expected_newConnectionCount  );
     EXPECT_EQ(signalHandler.closeConnectionCount,   expected_closeConnectionCount);
 
-}
\ No newline at end of file
+}
+
+TEST_F(ModbusTcpServerTest, BacklogSetter)
+{
+    EXPECT_EQ(tcpServer->backlog(), ModbusTcpServer::Defaults::instance().backlog);
+    tcpServer->setBacklog(1024);
+    EXPECT_EQ(tcpServer->backlog(), 1024u);
+}
+
+#ifndef _WIN32
+static int connectLoopback(uint16_t port)
+{
+    int s = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sa.sin_port = htons(port);
+    if (::connect(s, reinterpret_cast<sockaddr*>(&sa), sizeof(sa)) != 0)
+    {
+        ::close(s);
+        return -1;
+    }
+    return s;
+}
+
+TEST_F(ModbusTcpServerTest, AcceptBurstAndConnectionPool)
+{
+    const uint16_t port = 50510;
+    const int burst = 50;
+    tcpServer->setIpaddr("127.0.0.1");
+    tcpServer->setPort(port);
+    tcpServer->setMaxConnections(40);
+    tcpServer->process();
+    ASSERT_TRUE(tcpServer->isOpen());
+
+    int clients[burst];
+    for (int i = 0; i < burst; i++)
+    {
+        clients[i] = connectLoopback(port);
+        ASSERT_NE(clients[i], -1);
+    }
+
+    // Note: connections are accepted up to the limit, the rest wait in the listen queue
+    tcpServer->process();
+    EXPECT_EQ(tcpServer->connectionCount(), 40u);
+    EXPECT_EQ(tcpServer->pooledConnectionCount(), 0u);
+
+    const uint8_t req[] = {0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x01, 0x03, 0x00, 0x00, 0x00, 0x01};
+    EXPECT_CALL(*mockDevice, readHoldingRegisters(1, 0, 1, _))
+        .Times(2)
+        .WillRepeatedly(DoAll(SetArgPointee<3>(0x1234), Return(Status_Good)));
+    auto request = [&](int client)
+    {
+        ASSERT_EQ(::send(client, req, sizeof(req), 0), static_cast<ssize_t>(sizeof(req)));
+        uint8_t resp[16];
+        ssize_t sz = 0;
+        Timer tm = timer();
+        while ((sz < 11) && (timer() - tm < 2000))
+        {
+            tcpServer->process();
+            ssize_t c = ::recv(client, resp + sz, sizeof(resp) - sz, MSG_DONTWAIT);
+            if (c > 0)
+                sz += c;
+            else
+                Modbus::msleep(1);
+        }
+        ASSERT_EQ(sz, 11);
+        EXPECT_EQ(resp[7], 0x03);
+        EXPECT_EQ(resp[8], 2);
+        EXPECT_EQ(resp[9], 0x12);
+        EXPECT_EQ(resp[10], 0x34);
+    };
+
+    // Note: waiting client is accepted into the connection object released by closed one
+    for (int i = 0; i < 10; i++)
+    {
+        ::close(clients[i]);
+        clients[i] = -1;
+    }
+    request(clients[burst-1]);
+    EXPECT_EQ(tcpServer->connectionCount(), 40u);
+    EXPECT_EQ(tcpServer->pooledConnectionCount(), 0u);
+
+    for (int i = 10; i < 20; i++)
+    {
+        ::close(clients[i]);
+        clients[i] = -1;
+    }
+    Timer tm = timer();
+    while ((tcpServer->connectionCount() > 30) && (timer() - tm < 2000))
+    {
+        tcpServer->process();
+        Modbus::msleep(1);
+    }
+    EXPECT_EQ(tcpServer->connectionCount(), 30u);
+    EXPECT_EQ(tcpServer->pooledConnectionCount(), 10u);
+
+    for (int i = 0; i < 5; i++)
+    {
+        clients[i] = connectLoopback(port);
+        ASSERT_NE(clients[i], -1);
+    }
+    tcpServer->process();
+    EXPECT_EQ(tcpServer->connectionCount(), 35u);
+    EXPECT_EQ(tcpServer->pooledConnectionCount(), 5u);
+
+    // Note: reused connection object serves requests of the new client
+    request(clients[0]);
+
+    for (int i = 0; i < burst; i++)
+    {
+        if (clients[i] != -1)
+            ::close(clients[i]);
+    }
+}
+#endif // _WIN32
@@ -0,0 +1,337 @@
+#include <gtest/gtest.h>
+
+#include <ModbusUdpMultiClient.h>
+#include <ModbusGlobal.h>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace Modbus;
+
+// UDP socket bound to an ephemeral loopback port
+static int bindLoopback(uint16_t *port)
+{
+    int s = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(addr);
+    if ((s < 0) || ::bind(s, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) ||
+        ::getsockname(s, reinterpret_cast<sockaddr*>(&addr), &len))
+        return -1;
+    *port = ntohs(addr.sin_port);
+    return s;
+}
+
+// Answers all received FC03 requests (MBAP) with value `unit * 100 + offset`, in reverse order if `reverse` is set
+static int serveRequests(int s, bool reverse)
+{
+    struct Req { uint8_t data[32]; sockaddr_in peer; };
+    Req reqs[16];
+    int c = 0;
+    socklen_t len = sizeof(sockaddr_in);
+    while ((c < 16) && (::recvfrom(s, reqs[c].data, sizeof(reqs[c].data), MSG_DONTWAIT, reinterpret_cast<sockaddr*>(&reqs[c].peer), &len) == 12))
+        ++c;
+    for (int k = 0; k < c; k++)
+    {
+        Req &r = reqs[reverse ? c - 1 - k : k];
+        uint16_t value = static_cast<uint16_t>(r.data[6] * 100 + ((r.data[8] << 8) | r.data[9]));
+        const uint8_t resp[] = {r.data[0], r.data[1], 0x00, 0x00, 0x00, 0x05, r.data[6], 0x03, 0x02,
+                                static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value)};
+        ::sendto(s, resp, sizeof(resp), 0, reinterpret_cast<sockaddr*>(&r.peer), sizeof(sockaddr_in));
+    }
+    return c;
+}
+
+static uint16_t localPort(ModbusUdpMultiClient &client)
+{
+    sockaddr_in addr;
+    socklen_t len = sizeof(addr);
+    ::getsockname(static_cast<int>(reinterpret_cast<intptr_t>(client.handle())), reinterpret_cast<sockaddr*>(&addr), &len);
+    return ntohs(addr.sin_port);
+}
+
+static void sendTo(int s, uint16_t port, const uint8_t *data, size_t sz)
+{
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ::sendto(s, data, sz, 0, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+}
+
+TEST(ModbusUdpMultiClient, ConcurrentTargets)
+{
+    uint16_t portA, portB, portC;
+    int devA = bindLoopback(&portA); // gateway with units 1 and 2
+    int devB = bindLoopback(&portB);
+    int devC = bindLoopback(&portC); // never answers
+    ASSERT_NE(devA, -1);
+    ASSERT_NE(devB, -1);
+    ASSERT_NE(devC, -1);
+
+    ModbusUdpMultiClient client;
+    int a1 = client.addTarget("127.0.0.1", portA, 1);
+    int a2 = client.addTarget("127.0.0.1", portA, 2);
+    int b  = client.addTarget("127.0.0.1", portB, 3);
+    int c  = client.addTarget("127.0.0.1", portC, 4);
+    EXPECT_EQ(client.targetCount(), 4);
+    client.setTimeout(c, 50);
+    ASSERT_EQ(client.open(), Status_Good);
+
+    uint16_t values[4] = {0, 0, 0, 0};
+    StatusCode status[4];
+    for (int i = 0; i < 4; i++)
+        EXPECT_EQ(client.readHoldingRegisters(i, static_cast<uint16_t>(10 + i), 1, &values[i]), Status_Processing);
+    EXPECT_EQ(client.pendingCount(), 4);
+
+    // Note: all requests are sent by one call and all targets wait for replies at the same time
+    uint32_t syscalls = client.syscallCount();
+    EXPECT_EQ(client.process(), Status_Good);
+#ifdef __linux__
+    EXPECT_LE(client.syscallCount() - syscalls, 2u);
+#endif
+    EXPECT_EQ(serveRequests(devA, true), 2);
+    EXPECT_EQ(serveRequests(devB, false), 1);
+
+    // Note: datagram from unknown peer is dropped
+    int foreign = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    const uint8_t fake[] = {0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x03, 0x02, 0xFF, 0xFF};
+    sendTo(foreign, localPort(client), fake, sizeof(fake));
+
+    Timer tm = timer();
+    int done = 0;
+    bool completed[4] = {false, false, false, false};
+    while ((done < 4) && (timer() - tm < 2000))
+    {
+        client.process();
+        for (int i = 0; i < 4; i++)
+        {
+            if (completed[i])
+                continue;
+            status[i] = client.readHoldingRegisters(i, static_cast<uint16_t>(10 + i), 1, &values[i]);
+            if (status[i] != Status_Processing)
+            {
+                completed[i] = true;
+                ++done;
+            }
+        }
+        Modbus::msleep(1);
+    }
+    ASSERT_EQ(done, 4);
+
+    // Note: replies from the same address are matched by transaction id and unit
+    EXPECT_EQ(status[a1], Status_Good);
+    EXPECT_EQ(values[a1], 110);
+    EXPECT_EQ(status[a2], Status_Good);
+    EXPECT_EQ(values[a2], 211);
+    EXPECT_EQ(status[b], Status_Good);
+    EXPECT_EQ(values[b], 312);
+    EXPECT_EQ(status[c], Status_BadUdpReadTimeout);
+    EXPECT_EQ(client.lastStatus(c), Status_BadUdpReadTimeout);
+    EXPECT_EQ(client.pendingCount(), 0);
+
+    // Note: late reply to the timed out request is dropped, reply to the next request is accepted
+    EXPECT_EQ(client.readHoldingRegisters(c, 14, 1, &values[c]), Status_Processing);
+    client.process();
+    EXPECT_TRUE(client.isPending(c));
+    EXPECT_EQ(serveRequests(devC, false), 2);
+    StatusCode r = Status_Processing;
+    tm = timer();
+    while ((r == Status_Processing) && (timer() - tm < 2000))
+    {
+        client.process();
+        r = client.readHoldingRegisters(c, 14, 1, &values[c]);
+        Modbus::msleep(1);
+    }
+    EXPECT_EQ(r, Status_Good);
+    EXPECT_EQ(values[c], 414);
+
+    EXPECT_EQ(client.readHoldingRegisters(c, 14, 1, &values[c]), Status_Processing);
+    client.cancelRequest(c);
+    EXPECT_FALSE(client.isPending(c));
+
+    ::close(foreign);
+    ::close(devA);
+    ::close(devB);
+    ::close(devC);
+}
+
+TEST(ModbusUdpMultiClient, SingleTargetConnected)
+{
+    uint16_t port;
+    int dev = bindLoopback(&port);
+    ASSERT_NE(dev, -1);
+
+    ModbusUdpMultiClient client;
+    client.addTarget("127.0.0.1", port, 1);
+    ASSERT_EQ(client.open(), Status_Good);
+
+    uint16_t value = 0;
+    StatusCode r = client.readHoldingRegisters(0, 5, 1, &value);
+    EXPECT_EQ(r, Status_Processing);
+    EXPECT_EQ(client.process(), Status_Good);
+
+    // Note: socket of the single resolved target is connected, so the kernel drops datagrams of other peers
+    int foreign = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    const uint8_t fake[] = {0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x03, 0x02, 0xFF, 0xFF};
+    sendTo(foreign, localPort(client), fake, sizeof(fake));
+    Modbus::msleep(10);
+    uint8_t buff[16];
+    EXPECT_EQ(::recv(static_cast<int>(reinterpret_cast<intptr_t>(client.handle())), buff, sizeof(buff), MSG_DONTWAIT | MSG_PEEK), -1);
+
+    Timer tm = timer();
+    while ((r == Status_Processing) && (timer() - tm < 2000))
+    {
+        client.process();
+        serveRequests(dev, false);
+        r = client.readHoldingRegisters(0, 5, 1, &value);
+        Modbus::msleep(1);
+    }
+    EXPECT_EQ(r, Status_Good);
+    EXPECT_EQ(value, 105);
+
+    ::close(foreign);
+    ::close(dev);
+}
+
+TEST(ModbusUdpMultiClient, AddTargetKeepsPendingRequest)
+{
+    uint16_t portA, portB;
+    int devA = bindLoopback(&portA);
+    int devB = bindLoopback(&portB);
+    ASSERT_NE(devA, -1);
+    ASSERT_NE(devB, -1);
+
+    ModbusUdpMultiClient client;
+    client.addTarget("127.0.0.1", portA, 1);
+    uint16_t va = 0, vb = 0;
+    EXPECT_EQ(client.readHoldingRegisters(0, 1, 1, &va), Status_Processing);
+    EXPECT_EQ(client.process(), Status_Good);
+    EXPECT_TRUE(client.isPending(0));
+    Handle h = client.handle();
+
+    // Note: new target is added to the open socket, so the request in progress is not dropped
+    int b = client.addTarget("127.0.0.1", portB, 2);
+    EXPECT_EQ(client.readHoldingRegisters(b, 2, 1, &vb), Status_Processing);
+    EXPECT_EQ(client.process(), Status_Good);
+    EXPECT_EQ(client.handle(), h);
+    EXPECT_TRUE(client.isPending(0));
+
+    StatusCode ra = Status_Processing, rb = Status_Processing;
+    Timer tm = timer();
+    while (((ra == Status_Processing) || (rb == Status_Processing)) && (timer() - tm < 2000))
+    {
+        serveRequests(devA, false);
+        serveRequests(devB, false);
+        client.process();
+        if (ra == Status_Processing)
+            ra = client.readHoldingRegisters(0, 1, 1, &va);
+        if (rb == Status_Processing)
+            rb = client.readHoldingRegisters(b, 2, 1, &vb);
+        Modbus::msleep(1);
+    }
+    EXPECT_EQ(ra, Status_Good);
+    EXPECT_EQ(va, 101);
+    EXPECT_EQ(rb, Status_Good);
+    EXPECT_EQ(vb, 202);
+
+    ::close(devA);
+    ::close(devB);
+}
+
+TEST(ModbusUdpMultiClient, FailedResolveFailsOnlyItsTarget)
+{
+    uint16_t port;
+    int dev = bindLoopback(&port);
+    ASSERT_NE(dev, -1);
+
+    ModbusUdpMultiClient client;
+    int good = client.addTarget("127.0.0.1", port, 1);
+    int bad = client.addTarget("modbuslib-test.invalid", port, 2);
+    client.setTimeout(bad, 200);
+    uint16_t vg = 0, vb = 0;
+    EXPECT_EQ(client.readHoldingRegisters(good, 3, 1, &vg), Status_Processing);
+    EXPECT_EQ(client.readHoldingRegisters(bad, 3, 1, &vb), Status_Processing);
+
+    StatusCode rg = Status_Processing, rb = Status_Processing;
+    Timer tm = timer();
+    while (((rg == Status_Processing) || (rb == Status_Processing)) && (timer() - tm < 5000))
+    {
+        EXPECT_EQ(client.process(), Status_Good);
+        serveRequests(dev, false);
+        if (rg == Status_Processing)
+            rg = client.readHoldingRegisters(good, 3, 1, &vg);
+        if (rb == Status_Processing)
+            rb = client.readHoldingRegisters(bad, 3, 1, &vb);
+        Modbus::msleep(1);
+    }
+    EXPECT_EQ(rg, Status_Good);
+    EXPECT_EQ(vg, 103);
+    EXPECT_EQ(rb, Status_BadUdpCreate);
+    EXPECT_TRUE(client.isOpen());
+
+    ::close(dev);
+}
+
+TEST(ModbusUdpMultiClient, RtuOverUdpTargetsByUnit)
+{
+    uint16_t port;
+    int dev = bindLoopback(&port);
+    ASSERT_NE(dev, -1);
+
+    ModbusUdpMultiClient client(RTUvUDP);
+    EXPECT_EQ(client.type(), RTUvUDP);
+    client.addTarget("127.0.0.1", port, 1);
+    client.addTarget("127.0.0.1", port, 2);
+    uint16_t v1 = 0, v2 = 0;
+    EXPECT_EQ(client.readInputRegisters(0, 0, 1, &v1), Status_Processing);
+    EXPECT_EQ(client.readInputRegisters(1, 0, 1, &v2), Status_Processing);
+    EXPECT_EQ(client.process(), Status_Good);
+
+    // Note: RTU frame has no transaction id, replies of the same address are matched by unit
+    uint8_t req[2][16];
+    sockaddr_in peer;
+    socklen_t len = sizeof(peer);
+    Timer tm = timer();
+    int c = 0;
+    while ((c < 2) && (timer() - tm < 2000))
+    {
+        if (::recvfrom(dev, req[c], sizeof(req[c]), MSG_DONTWAIT, reinterpret_cast<sockaddr*>(&peer), &len) == 8)
+            ++c;
+        else
+            Modbus::msleep(1);
+    }
+    ASSERT_EQ(c, 2);
+    for (int i = 1; i >= 0; i--)
+    {
+        uint8_t resp[7] = {req[i][0], 0x04, 0x02, 0x00, static_cast<uint8_t>(req[i][0] * 11), 0, 0};
+        uint16_t crc = crc16(resp, 5);
+        resp[5] = static_cast<uint8_t>(crc);
+        resp[6] = static_cast<uint8_t>(crc >> 8);
+        ::sendto(dev, resp, sizeof(resp), 0, reinterpret_cast<sockaddr*>(&peer), sizeof(peer));
+    }
+
+    StatusCode r1 = Status_Processing, r2 = Status_Processing;
+    tm = timer();
+    while (((r1 == Status_Processing) || (r2 == Status_Processing)) && (timer() - tm < 2000))
+    {
+        client.process();
+        if (r1 == Status_Processing)
+            r1 = client.readInputRegisters(0, 0, 1, &v1);
+        if (r2 == Status_Processing)
+            r2 = client.readInputRegisters(1, 0, 1, &v2);
+        Modbus::msleep(1);
+    }
+    EXPECT_EQ(r1, Status_Good);
+    EXPECT_EQ(v1, 11);
+    EXPECT_EQ(r2, Status_Good);
+    EXPECT_EQ(v2, 22);
+
+    ::close(dev);
+}
+#endif // _WIN32
@@ -2,9 +2,18 @@
 #include <gmock/gmock.h>
 
 #include <ModbusUdpPort.h>
+#include <ModbusServerResource.h>
 #include <ModbusPort_p.h>
 #include <ModbusGlobal.h>
 
+#include "MockModbusDevice.h"
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
 // Helper class to access protected members for testing
 class ModbusUdpPortTestHelper : public ModbusUdpPort
 {
@@ -1382,3 +1391,92 @@ TEST_F(ModbusUdpPortTest, SocketReadDifferentResponseSizes)
     EXPECT_EQ(result, Status_Good);
     EXPECT_EQ(outSize, 252); // 260 - 6 (header) - 1 (unit) - 1 (func)
 }
+
+#ifndef _WIN32
+// Every client requests one register with its own transaction id and offset, server answers the offset as the value
+static uint32_t udpServeClients(ModbusServerResource &server, ModbusUdpPort *udp, uint16_t port, int *clients, int count, uint16_t base)
+{
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    for (int i = 0; i < count; i++)
+    {
+        uint16_t id = static_cast<uint16_t>(base + i);
+        const uint8_t req[] = {static_cast<uint8_t>(id >> 8), static_cast<uint8_t>(id), 0x00, 0x00, 0x00, 0x06,
+                               0x01, 0x03, static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(i), 0x00, 0x01};
+        EXPECT_EQ(::sendto(clients[i], req, sizeof(req), 0, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), static_cast<ssize_t>(sizeof(req)));
+    }
+
+    uint32_t syscalls = udp->syscallCount();
+    for (int i = 0; i < count; i++)
+        server.process();
+    syscalls = udp->syscallCount() - syscalls;
+
+    for (int i = 0; i < count; i++)
+    {
+        uint8_t resp[32];
+        ssize_t sz = -1;
+        Timer tm = timer();
+        while ((sz < 0) && (timer() - tm < 2000))
+        {
+            sz = ::recv(clients[i], resp, sizeof(resp), MSG_DONTWAIT);
+            if (sz < 0)
+            {
+                server.process();
+                Modbus::msleep(1);
+            }
+        }
+        // Note: every client receives the reply to its own request
+        EXPECT_EQ(sz, 11);
+        if (sz != 11)
+            continue;
+        uint16_t id = static_cast<uint16_t>(base + i);
+        EXPECT_EQ((resp[0] << 8) | resp[1], id);
+        EXPECT_EQ(resp[7], 0x03);
+        EXPECT_EQ((resp[9] << 8) | resp[10], i);
+    }
+    return syscalls;
+}
+
+TEST(ModbusUdpServerTest, BatchedRequestsOfManyPeers)
+{
+    const uint16_t port = 50520;
+    const int count = 50;
+    testing::NiceMock<MockModbusDevice> device;
+    ON_CALL(device, readHoldingRegisters(1, testing::_, 1, testing::_))
+        .WillByDefault(testing::Invoke([](uint8_t, uint16_t offset, uint16_t, uint16_t *values) {
+            values[0] = offset;
+            return Status_Good;
+        }));
+    ModbusUdpPort *udp = new ModbusUdpPort(false);
+    udp->setPort(port);
+    ModbusServerResource server(udp, &device);
+    EXPECT_EQ(udp->batchSize(), 32u);
+    server.process();
+    ASSERT_TRUE(udp->isOpen());
+
+    int clients[count];
+    for (int i = 0; i < count; i++)
+    {
+        clients[i] = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        ASSERT_NE(clients[i], -1);
+    }
+
+    uint32_t batched = udpServeClients(server, udp, port, clients, count, 0x100);
+#ifdef __linux__
+    // Note: requests and replies are passed by batches instead of one system call per datagram
+    EXPECT_LT(batched, 10u);
+#endif
+
+    udp->setBatchSize(1);
+    EXPECT_EQ(udp->batchSize(), 1u);
+    uint32_t single = udpServeClients(server, udp, port, clients, count, 0x200);
+    EXPECT_GE(single, 2u * count);
+    EXPECT_LT(batched, single);
+
+    for (int i = 0; i < count; i++)
+        ::close(clients[i]);
+}
+#endif // _WIN32
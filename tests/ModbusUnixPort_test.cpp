@@ -0,0 +1,428 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <ModbusGlobal.h>
+#include <ModbusUnixPort.h>
+#include <ModbusUnixServer.h>
+#include <ModbusTcpPort.h>
+#include <ModbusClientPort.h>
+
+#include "MockModbusDevice.h"
+
+#ifndef _WIN32
+#include <thread>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+using namespace testing;
+using namespace Modbus;
+
+// Returns unique socket name in abstract namespace (Linux) or path in temp directory
+static std::string socketPath(const char *name)
+{
+#ifdef __linux__
+    return std::string("@modbuslib-test-") + std::to_string(::getpid()) + "-" + name;
+#else
+    return std::string("/tmp/modbuslib-test-") + std::to_string(::getpid()) + "-" + name;
+#endif
+}
+
+// Creates listening socket of `type` on `path` (leading '@' means abstract namespace)
+static int listenUnix(const std::string &path, int type)
+{
+    int s = ::socket(AF_UNIX, type, 0);
+    if (s < 0)
+        return -1;
+    sockaddr_un sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    memcpy(sa.sun_path, path.data(), path.size());
+    socklen_t len = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + path.size());
+    if (path[0] == '@')
+        sa.sun_path[0] = '\0';
+    else
+    {
+        ::unlink(path.data());
+        len += 1;
+    }
+    if ((::bind(s, reinterpret_cast<sockaddr*>(&sa), len) != 0) || (::listen(s, 8) != 0))
+    {
+        ::close(s);
+        return -1;
+    }
+    return s;
+}
+
+// Connects raw client socket of `type` to `path`
+static int connectUnix(const std::string &path, int type)
+{
+    int s = ::socket(AF_UNIX, type, 0);
+    if (s < 0)
+        return -1;
+    sockaddr_un sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    memcpy(sa.sun_path, path.data(), path.size());
+    socklen_t len = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + path.size());
+    if (path[0] == '@')
+        sa.sun_path[0] = '\0';
+    else
+        len += 1;
+    if (::connect(s, reinterpret_cast<sockaddr*>(&sa), len) != 0)
+    {
+        ::close(s);
+        return -1;
+    }
+    return s;
+}
+
+// Device accepts one connection and answers every FC03 request for 1 register with value 0x1234
+static void runDevice(int listener)
+{
+    int s = ::accept(listener, nullptr, nullptr);
+    if (s < 0)
+        return;
+    uint8_t buff[260];
+    for (;;)
+    {
+        ssize_t c = 0;
+        while (c < 12)
+        {
+            ssize_t r = ::recv(s, buff + c, sizeof(buff) - c, 0);
+            if (r <= 0)
+            {
+                ::close(s);
+                return;
+            }
+            c += r;
+        }
+        uint8_t resp[11] = { buff[0], buff[1], 0x00, 0x00, 0x00, 0x05, buff[6], MBF_READ_HOLDING_REGISTERS, 0x02, 0x12, 0x34 };
+        ::send(s, resp, sizeof(resp), MSG_NOSIGNAL);
+    }
+}
+
+// Runs `count` blocking FC03 transactions through `port`. Returns average time of transaction (microseconds)
+static uint64_t runTransactions(ModbusPort *port, uint32_t count, double *syscallsPerTransaction)
+{
+    ModbusClientPort client(port);
+    uint16_t value = 0;
+    uint64_t tm = Modbus::timerUs();
+    for (uint32_t i = 0; i < count; i++)
+    {
+        EXPECT_EQ(client.readHoldingRegisters(1, 0, 1, &value), Status_Good);
+        EXPECT_EQ(value, 0x1234);
+    }
+    tm = Modbus::timerUs() - tm;
+    *syscallsPerTransaction = client.syscallsPerTransaction();
+    client.close();
+    return tm / count;
+}
+
+TEST(ModbusUnixPortTest, TypeAndSettings)
+{
+    ModbusUnixPort port;
+    EXPECT_EQ(port.type(), UNIX);
+    EXPECT_EQ(port.isSeqPacket(), MB_UNIX_SEQPACKET_DEFAULT);
+    port.setPath("/run/modbus.sock");
+    EXPECT_STREQ(port.path(), "/run/modbus.sock");
+    EXPECT_STREQ(port.host(), "/run/modbus.sock");
+    port.setSeqPacket(false);
+    EXPECT_FALSE(port.isSeqPacket());
+
+    EXPECT_STREQ(sprotocolType(UNIX), "UNIX");
+    EXPECT_EQ(toprotocolType("UNIX"), UNIX);
+
+    NetSettings net;
+    net.host    = "/run/modbus.sock";
+    net.port    = 0;
+    net.timeout = 1000;
+    net.maxconn = 5;
+    ModbusPort *p = createPort(UNIX, &net, false);
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(p->type(), UNIX);
+    EXPECT_STREQ(static_cast<ModbusUnixPort*>(p)->path(), "/run/modbus.sock");
+    delete p;
+
+    MockModbusDevice device;
+    ModbusServerPort *serv = createServerPort(&device, UNIX, &net, false);
+    ASSERT_NE(serv, nullptr);
+    EXPECT_EQ(serv->type(), UNIX);
+    EXPECT_TRUE(serv->isTcpServer());
+    ModbusUnixServer *unixServer = dynamic_cast<ModbusUnixServer*>(serv);
+    ASSERT_NE(unixServer, nullptr);
+    EXPECT_STREQ(unixServer->path(), "/run/modbus.sock");
+    EXPECT_EQ(unixServer->isSeqPacket(), MB_UNIX_SEQPACKET_DEFAULT);
+    delete serv;
+}
+
+TEST(ModbusUnixPortTest, OpenWithInvalidPath)
+{
+    ModbusUnixPort port(true);
+    port.setPath("");
+    EXPECT_EQ(port.open(), Status_BadTcpCreate);
+
+    MockModbusDevice device;
+    ModbusUnixServer server(&device);
+    EXPECT_STREQ(server.path(), "");
+    EXPECT_EQ(server.open(), Status_BadTcpCreate);
+    EXPECT_FALSE(server.isOpen());
+
+    ModbusUnixPort missing(true);
+    missing.setPath(socketPath("missing").data());
+    missing.setSeqPacket(false);
+    EXPECT_EQ(missing.open(), Status_BadTcpConnect);
+}
+
+// Note: client and server are processed by the same thread, so both use non-blocking ports
+TEST(ModbusUnixPortTest, ClientServerRequest)
+{
+    const bool types[] = { false, true };
+    for (bool seqpacket : types)
+    {
+        std::string path = socketPath(seqpacket ? "seq" : "stream");
+        MockModbusDevice device;
+        ModbusUnixServer server(&device);
+        server.setPath(path.data());
+        server.setSeqPacket(seqpacket);
+        server.process();
+        ASSERT_TRUE(server.isOpen()) << server.lastErrorText();
+
+        EXPECT_CALL(device, readHoldingRegisters(1, 10, 2, _))
+            .Times(3)
+            .WillRepeatedly(Invoke([](uint8_t, uint16_t, uint16_t, uint16_t *values) {
+                values[0] = 0x1234;
+                values[1] = 0x5678;
+                return Status_Good;
+            }));
+
+        ModbusUnixPort *port = new ModbusUnixPort(false);
+        port->setPath(path.data());
+        port->setSeqPacket(seqpacket);
+        port->setTimeout(2000);
+        ModbusClientPort client(port);
+        for (int i = 0; i < 3; i++)
+        {
+            uint16_t values[2] = { 0, 0 };
+            StatusCode r;
+            Timer tm = timer();
+            do
+            {
+                server.process();
+                r = client.readHoldingRegisters(1, 10, 2, values);
+            }
+            while (StatusIsProcessing(r) && (timer() - tm < 2000));
+            ASSERT_EQ(r, Status_Good) << client.lastErrorText();
+            EXPECT_EQ(values[0], 0x1234);
+            EXPECT_EQ(values[1], 0x5678);
+        }
+        EXPECT_EQ(server.connectionCount(), 1u);
+        EXPECT_EQ(port->transactionId(), 3);
+
+        client.close();
+        server.close();
+        server.process();
+    }
+}
+
+TEST(ModbusUnixPortTest, SocketFileRemovedOnClose)
+{
+    std::string path = std::string("/tmp/modbuslib-test-") + std::to_string(::getpid()) + ".sock";
+    // Note: file left by previous instance doesn't prevent server to open
+    int stale = listenUnix(path, SOCK_STREAM);
+    ASSERT_NE(stale, -1);
+    ::close(stale);
+
+    MockModbusDevice device;
+    ModbusUnixServer server(&device);
+    server.setPath(path.data());
+    server.setSeqPacket(false);
+    server.process();
+    ASSERT_TRUE(server.isOpen()) << server.lastErrorText();
+    struct stat st;
+    ASSERT_EQ(::stat(path.data(), &st), 0);
+    EXPECT_TRUE(S_ISSOCK(st.st_mode));
+
+    server.close();
+    server.process();
+    EXPECT_FALSE(server.isOpen());
+    EXPECT_NE(::stat(path.data(), &st), 0);
+}
+
+TEST(ModbusUnixPortTest, OpenKeepsPathInUse)
+{
+    std::string path = std::string("/tmp/modbuslib-test-") + std::to_string(::getpid()) + "-inuse.sock";
+    MockModbusDevice device;
+    ModbusUnixServer server(&device);
+    server.setPath(path.data());
+    server.setSeqPacket(false);
+
+    // Note: path which is not a socket is never removed
+    FILE *f = fopen(path.data(), "w");
+    ASSERT_NE(f, nullptr);
+    fclose(f);
+    EXPECT_EQ(server.open(), Status_BadTcpBind);
+    struct stat st;
+    ASSERT_EQ(::stat(path.data(), &st), 0);
+    EXPECT_TRUE(S_ISREG(st.st_mode));
+    ::unlink(path.data());
+
+    // Note: socket of the running server is never removed
+    int live = listenUnix(path, SOCK_STREAM);
+    ASSERT_NE(live, -1);
+    EXPECT_EQ(server.open(), Status_BadTcpBind);
+    int c = connectUnix(path, SOCK_STREAM);
+    EXPECT_NE(c, -1);
+    if (c != -1)
+        ::close(c);
+    ::close(live);
+
+    // Note: stale socket file of the closed server is removed
+    EXPECT_EQ(server.open(), Status_Good) << server.lastErrorText();
+    server.close();
+    server.process();
+}
+
+#ifdef __linux__
+TEST(ModbusUnixPortTest, SeqPacketChangeReopensServer)
+{
+    std::string path = socketPath("reopen");
+    MockModbusDevice device;
+    ModbusUnixServer server(&device);
+    server.setPath(path.data());
+    server.setSeqPacket(false);
+    server.process();
+    ASSERT_TRUE(server.isOpen()) << server.lastErrorText();
+    int c = connectUnix(path, SOCK_SEQPACKET);
+    EXPECT_EQ(c, -1);
+
+    server.setSeqPacket(true);
+    Timer tm = timer();
+    do
+    {
+        server.process();
+        c = connectUnix(path, SOCK_SEQPACKET);
+    }
+    while ((c == -1) && (timer() - tm < 2000));
+    EXPECT_NE(c, -1);
+    EXPECT_TRUE(server.isOpen());
+    if (c != -1)
+        ::close(c);
+    server.close();
+    server.process();
+}
+
+// Note: every request is a separate message, so requests sent by client without waiting for responses
+// are never merged and every one of them is answered
+TEST(ModbusUnixPortTest, SeqPacketKeepsFrameBoundaries)
+{
+    std::string path = socketPath("pipeline");
+    MockModbusDevice device;
+    ModbusUnixServer server(&device);
+    server.setPath(path.data());
+    server.setSeqPacket(true);
+    server.process();
+    ASSERT_TRUE(server.isOpen()) << server.lastErrorText();
+
+    EXPECT_CALL(device, readHoldingRegisters(1, _, 1, _))
+        .Times(3)
+        .WillRepeatedly(Invoke([](uint8_t, uint16_t offset, uint16_t, uint16_t *values) {
+            values[0] = offset;
+            return Status_Good;
+        }));
+
+    int s = connectUnix(path, SOCK_SEQPACKET);
+    ASSERT_NE(s, -1);
+    for (uint8_t i = 1; i <= 3; i++)
+    {
+        const uint8_t req[] = {0x00, i, 0x00, 0x00, 0x00, 0x06, 0x01, 0x03, 0x00, i, 0x00, 0x01};
+        ASSERT_EQ(::send(s, req, sizeof(req), 0), static_cast<ssize_t>(sizeof(req)));
+    }
+
+    int received = 0;
+    Timer tm = timer();
+    while ((received < 3) && (timer() - tm < 2000))
+    {
+        server.process();
+        uint8_t resp[260];
+        ssize_t c = ::recv(s, resp, sizeof(resp), MSG_DONTWAIT);
+        if (c <= 0)
+        {
+            Modbus::msleep(1);
+            continue;
+        }
+        ++received;
+        // Note: one message is exactly one response
+        ASSERT_EQ(c, 11);
+        EXPECT_EQ(resp[1], received);
+        EXPECT_EQ(resp[7], MBF_READ_HOLDING_REGISTERS);
+        EXPECT_EQ(resp[10], received);
+    }
+    EXPECT_EQ(received, 3);
+
+    ::close(s);
+    server.close();
+    server.process();
+}
+#endif // __linux__
+
+// Note: benchmark of Unix domain socket against loopback TCP, the same blocking transaction path costs
+// one `send()` and one `recv()` for every transport, so time difference is the cost of the transport itself
+TEST(ModbusUnixPortTest, BenchmarkAgainstLoopbackTcp)
+{
+    const uint32_t count = 1000;
+    double syscalls = 0;
+
+    // Loopback TCP
+    int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_NE(listener, -1);
+    sockaddr_in sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sa.sin_port = 0;
+    ASSERT_EQ(::bind(listener, reinterpret_cast<sockaddr*>(&sa), sizeof(sa)), 0);
+    ASSERT_EQ(::listen(listener, 8), 0);
+    socklen_t len = sizeof(sa);
+    ::getsockname(listener, reinterpret_cast<sockaddr*>(&sa), &len);
+    std::thread tcpDevice(runDevice, listener);
+    ModbusTcpPort *tcp = new ModbusTcpPort(true);
+    tcp->setHost("127.0.0.1");
+    tcp->setPort(ntohs(sa.sin_port));
+    tcp->setTimeout(2000);
+    tcp->setSocketOptions(Modbus::lowLatencySocketOptions());
+    uint64_t tcpUs = runTransactions(tcp, count, &syscalls);
+    tcpDevice.join();
+    ::close(listener);
+    RecordProperty("tcpTransactionTimeUs", std::to_string(tcpUs));
+
+    // Unix domain socket of both types
+    const bool types[] = { false, true };
+    for (bool seqpacket : types)
+    {
+#ifndef __linux__
+        if (seqpacket)
+            continue;
+#endif
+        std::string path = socketPath(seqpacket ? "bench-seq" : "bench-stream");
+        listener = listenUnix(path, seqpacket ? SOCK_SEQPACKET : SOCK_STREAM);
+        ASSERT_NE(listener, -1);
+        std::thread device(runDevice, listener);
+        ModbusUnixPort *port = new ModbusUnixPort(true);
+        port->setPath(path.data());
+        port->setSeqPacket(seqpacket);
+        port->setTimeout(2000);
+        uint64_t us = runTransactions(port, count, &syscalls);
+        device.join();
+        ::close(listener);
+        if (path[0] != '@')
+            ::unlink(path.data());
+        EXPECT_DOUBLE_EQ(syscalls, 2.0);
+        RecordProperty(seqpacket ? "unixSeqPacketTransactionTimeUs" : "unixStreamTransactionTimeUs", std::to_string(us));
+    }
+}
+
+#endif // _WIN32
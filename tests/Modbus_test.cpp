@@ -2,6 +2,7 @@
 #include <gmock/gmock-matchers.h>
 
 #include <vector>
+#include <algorithm>
 
 #include <Modbus.h>
 #include <ModbusTcpPort.h>
@@ -117,6 +118,136 @@ TEST(ModbusTest, asciiToBytes)
     EXPECT_THAT(bytes, ElementsAre(0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF));
 }
 
+TEST(ModbusTest, asciiToBytesOddCount)
+{
+    // Note: last odd symbol is most significant tetrabits of the last byte
+    const uint8_t ascii[] = {'1', '2', 'A'};
+    uint8_t bytes[2] = {};
+    EXPECT_EQ(asciiToBytes(ascii, bytes, 3), 2u);
+    EXPECT_EQ(bytes[0], 0x12);
+    EXPECT_EQ(bytes[1], 0xA0);
+    EXPECT_EQ(asciiToBytes(&ascii[2], bytes, 1), 1u);
+    EXPECT_EQ(bytes[0], 0xA0);
+    EXPECT_EQ(asciiToBytes(ascii, bytes, 0), 0u);
+    const uint8_t bad[] = {'1', '2', 'x'};
+    EXPECT_EQ(asciiToBytes(bad, bytes, 3), 0u);
+    EXPECT_EQ(asciiToBytes(&bad[2], bytes, 1), 0u);
+}
+
+TEST(ModbusTest, asciiCodecMatchesScalar)
+{
+    // Note: every length up to several SIMD blocks so SSSE3/AVX2 and scalar tail parts are
+    // compared with straightforward scalar implementation for any CPU selected path
+    const char *hex = "0123456789ABCDEF";
+    for (uint32_t count = 0; count <= 200; count++)
+    {
+        std::vector<uint8_t> bytes(count);
+        uint8_t expectedSum = 0;
+        std::string expectedAscii;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            bytes[i] = static_cast<uint8_t>(i * 151 + count);
+            expectedSum += bytes[i];
+            expectedAscii += hex[bytes[i] >> 4];
+            expectedAscii += hex[bytes[i] & 0x0F];
+        }
+        std::vector<uint8_t> ascii(count*2 + 1);
+        uint8_t sum = 0;
+        ASSERT_EQ(bytesToAsciiLrc(bytes.data(), ascii.data(), count, &sum), count*2);
+        EXPECT_EQ(std::string(ascii.begin(), ascii.begin() + count*2), expectedAscii) << "count=" << count;
+        EXPECT_EQ(sum, expectedSum) << "count=" << count;
+
+        std::vector<uint8_t> out(count + 1);
+        sum = 0;
+        ASSERT_EQ(asciiToBytesLrc(ascii.data(), out.data(), count*2, &sum), count);
+        EXPECT_TRUE(std::equal(bytes.begin(), bytes.end(), out.begin())) << "count=" << count;
+        EXPECT_EQ(sum, expectedSum) << "count=" << count;
+    }
+}
+
+
+TEST(ModbusTest, bytesToAsciiLrcLong)
+{
+    // Note: long buffer to cover vectorized and tail parts of encoding
+    uint8_t bytes[253];
+    for (uint32_t i = 0; i < sizeof(bytes); i++)
+        bytes[i] = static_cast<uint8_t>(i * 37 + 11);
+    std::vector<uint8_t> ascii(sizeof(bytes)*2);
+    uint8_t sum = 0;
+    uint32_t c = bytesToAsciiLrc(bytes, ascii.data(), sizeof(bytes), &sum);
+    ASSERT_EQ(c, ascii.size());
+    EXPECT_EQ(static_cast<uint8_t>(-static_cast<int8_t>(sum)), lrc(bytes, sizeof(bytes)));
+    const char *hex = "0123456789ABCDEF";
+    for (uint32_t i = 0; i < sizeof(bytes); i++)
+    {
+        EXPECT_EQ(ascii[i*2  ], hex[bytes[i] >> 4]);
+        EXPECT_EQ(ascii[i*2+1], hex[bytes[i] & 0x0F]);
+    }
+}
+
+TEST(ModbusTest, asciiToBytesLrcLong)
+{
+    uint8_t bytes[253];
+    for (uint32_t i = 0; i < sizeof(bytes); i++)
+        bytes[i] = static_cast<uint8_t>(i * 53 + 7);
+    std::vector<uint8_t> ascii(sizeof(bytes)*2);
+    bytesToAscii(bytes, ascii.data(), sizeof(bytes));
+
+    std::vector<uint8_t> out(sizeof(bytes));
+    uint8_t sum = 0;
+    uint32_t c = asciiToBytesLrc(ascii.data(), out.data(), static_cast<uint32_t>(ascii.size()), &sum);
+    ASSERT_EQ(c, sizeof(bytes));
+    EXPECT_EQ(memcmp(out.data(), bytes, sizeof(bytes)), 0);
+    EXPECT_EQ(static_cast<uint8_t>(-static_cast<int8_t>(sum)), lrc(bytes, sizeof(bytes)));
+
+    // in-place decoding
+    std::vector<uint8_t> inplace(ascii);
+    sum = 0;
+    c = asciiToBytesLrc(inplace.data(), inplace.data(), static_cast<uint32_t>(inplace.size()), &sum);
+    ASSERT_EQ(c, sizeof(bytes));
+    EXPECT_EQ(memcmp(inplace.data(), bytes, sizeof(bytes)), 0);
+}
+
+TEST(ModbusTest, asciiToBytesLrcBadChar)
+{
+    std::vector<uint8_t> ascii(200, 'A');
+    std::vector<uint8_t> out(100);
+    const uint8_t badChars[] = { 'a', 'f', 'G', '/', ':', '@', ' ', 0x00, 0x80, 0xC1 };
+    for (uint32_t pos : { 0u, 5u, 31u, 63u, 64u, 127u, 199u })
+    {
+        for (uint8_t ch : badChars)
+        {
+            std::vector<uint8_t> a(ascii);
+            a[pos] = ch;
+            uint8_t sum = 0;
+            EXPECT_EQ(asciiToBytesLrc(a.data(), out.data(), static_cast<uint32_t>(a.size()), &sum), 0u) << "pos=" << pos << " ch=" << static_cast<int>(ch);
+            EXPECT_EQ(asciiToBytes(a.data(), out.data(), static_cast<uint32_t>(a.size())), 0u);
+        }
+    }
+}
+
+
+TEST(ModbusTest, serialCharTiming)
+{
+    EXPECT_EQ(serialCharTimeUs(9600, 8, NoParity  , OneStop       ), 1042u); // 10 bits
+    EXPECT_EQ(serialCharTimeUs(9600, 8, EvenParity, OneStop       ), 1146u); // 11 bits
+    EXPECT_EQ(serialCharTimeUs(9600, 8, NoParity  , OneAndHalfStop), 1094u); // 10.5 bits
+    EXPECT_EQ(serialCharTimeUs(9600, 7, EvenParity, TwoStop       ), 1146u); // 11 bits
+    EXPECT_EQ(serialCharTimeUs(0   , 8, NoParity  , OneStop       ), 0u);
+
+    EXPECT_EQ(serialInterFrameDelayUs (19200, 8, EvenParity, OneStop), 2006u);
+    EXPECT_EQ(serialInterCharTimeoutUs(19200, 8, EvenParity, OneStop),  860u);
+    EXPECT_EQ(serialInterFrameDelayUs (38400, 8, EvenParity, OneStop), 1750u);
+    EXPECT_EQ(serialInterCharTimeoutUs(38400, 8, EvenParity, OneStop),  750u);
+}
+
+TEST(ModbusTest, timerUs)
+{
+    uint64_t t1 = timerUs();
+    microsleep(2000);
+    uint64_t t2 = timerUs();
+    EXPECT_GE(t2 - t1, 2000u);
+}
 
 TEST(ModbusTest, toModbusString)
 {
@@ -209,6 +340,33 @@ TEST(ModbusTest, createPortUdp)
     delete port;
 }
 
+TEST(ModbusTest, createPortTcpSocketOptions)
+{
+    NetSettings tcp;
+    tcp.host    = "localhost";
+    tcp.port    = STANDARD_TCP_PORT;
+    tcp.timeout = 5000;
+
+    ModbusPort *p = createPort(TCP, &tcp, false);
+    ASSERT_NE(p, nullptr);
+
+    auto port = static_cast<ModbusTcpPort*>(p);
+    port->setSocketOptions(lowLatencySocketOptions());
+    EXPECT_EQ(port->socketOptions().noDelay, 1);
+    EXPECT_EQ(port->socketOptions().quickAck, 1);
+    EXPECT_EQ(port->socketOptions().keepAlive, 1);
+    EXPECT_EQ(port->socketOptions().userTimeout, 5000u);
+    EXPECT_EQ(port->socketOptions().sendBufferSize, 0u);
+
+    // Note: default profile doesn't set any option
+    port->setSocketOptions(defaultSocketOptions());
+    EXPECT_TRUE(port->isChanged());
+    EXPECT_EQ(port->socketOptions().noDelay, 0);
+    EXPECT_EQ(port->socketOptions().busyPoll, 0u);
+
+    delete port;
+}
+
 TEST(ModbusTest, createPortRtu)
 {
     SerialSettings ser;
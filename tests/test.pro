@@ -22,10 +22,14 @@ SOURCES += \
     Modbus_test.cpp \
     ModbusAddress_test.cpp \
     ModbusClientPort_test.cpp \
+    ModbusClientPortPool_test.cpp \
+    ModbusSubscription_test.cpp \
+    ModbusPollScheduler_test.cpp \
     ModbusServerPort_test.cpp \
     ModbusServerResource_test.cpp \
     ModbusTcpPort_test.cpp \
     ModbusUdpPort_test.cpp \
+    ModbusUdpMultiClient_test.cpp \
     ModbusTcpServer_test.cpp \
     ModbusRtuPort_test.cpp \
     ModbusAscPort_test.cpp \
@@ -33,6 +37,7 @@ SOURCES += \
     ModbusAscOverTcpPort_test.cpp \
     ModbusRtuOverUdpPort_test.cpp \
     ModbusAscOverUdpPort_test.cpp \
+    ModbusUnixPort_test.cpp \
     main.cpp
 
 win32 {